@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "../../../lib/libace_logging_proto.a"
+)
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/ace_logging_server"
+  "../../../bin/ace_logging_server.pdb"
+  "CMakeFiles/ace_logging_server.dir/server.cc.o"
+  "CMakeFiles/ace_logging_server.dir/server.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ace_logging_server.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../../bin/ttcp_asio_async"
+  "../../../bin/ttcp_asio_async.pdb"
+  "CMakeFiles/ttcp_asio_async.dir/common.cc.o"
+  "CMakeFiles/ttcp_asio_async.dir/common.cc.o.d"
+  "CMakeFiles/ttcp_asio_async.dir/main.cc.o"
+  "CMakeFiles/ttcp_asio_async.dir/main.cc.o.d"
+  "CMakeFiles/ttcp_asio_async.dir/ttcp_asio_async.cc.o"
+  "CMakeFiles/ttcp_asio_async.dir/ttcp_asio_async.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ttcp_asio_async.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/examples/ace/ttcp/common.cc" "examples/ace/ttcp/CMakeFiles/ttcp_asio_sync.dir/common.cc.o" "gcc" "examples/ace/ttcp/CMakeFiles/ttcp_asio_sync.dir/common.cc.o.d"
+  "/root/repo/examples/ace/ttcp/main.cc" "examples/ace/ttcp/CMakeFiles/ttcp_asio_sync.dir/main.cc.o" "gcc" "examples/ace/ttcp/CMakeFiles/ttcp_asio_sync.dir/main.cc.o.d"
+  "/root/repo/examples/ace/ttcp/ttcp_asio_sync.cc" "examples/ace/ttcp/CMakeFiles/ttcp_asio_sync.dir/ttcp_asio_sync.cc.o" "gcc" "examples/ace/ttcp/CMakeFiles/ttcp_asio_sync.dir/ttcp_asio_sync.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/muduo/base/CMakeFiles/muduo_base.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
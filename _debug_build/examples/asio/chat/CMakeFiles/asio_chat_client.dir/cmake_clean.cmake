@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/asio_chat_client"
+  "../../../bin/asio_chat_client.pdb"
+  "CMakeFiles/asio_chat_client.dir/client.cc.o"
+  "CMakeFiles/asio_chat_client.dir/client.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/asio_chat_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/asio_chat_server_threaded"
+  "../../../bin/asio_chat_server_threaded.pdb"
+  "CMakeFiles/asio_chat_server_threaded.dir/server_threaded.cc.o"
+  "CMakeFiles/asio_chat_server_threaded.dir/server_threaded.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/asio_chat_server_threaded.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
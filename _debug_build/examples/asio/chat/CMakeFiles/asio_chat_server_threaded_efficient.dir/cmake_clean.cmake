@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/asio_chat_server_threaded_efficient"
+  "../../../bin/asio_chat_server_threaded_efficient.pdb"
+  "CMakeFiles/asio_chat_server_threaded_efficient.dir/server_threaded_efficient.cc.o"
+  "CMakeFiles/asio_chat_server_threaded_efficient.dir/server_threaded_efficient.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/asio_chat_server_threaded_efficient.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
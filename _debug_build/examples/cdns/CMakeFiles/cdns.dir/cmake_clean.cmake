@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/cdns"
+  "../../bin/cdns.pdb"
+  "CMakeFiles/cdns.dir/dns.cc.o"
+  "CMakeFiles/cdns.dir/dns.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cdns.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/hub"
+  "../../bin/hub.pdb"
+  "CMakeFiles/hub.dir/codec.cc.o"
+  "CMakeFiles/hub.dir/codec.cc.o.d"
+  "CMakeFiles/hub.dir/hub.cc.o"
+  "CMakeFiles/hub.dir/hub.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hub.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
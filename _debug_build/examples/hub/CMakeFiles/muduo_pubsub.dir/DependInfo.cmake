@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/examples/hub/codec.cc" "examples/hub/CMakeFiles/muduo_pubsub.dir/codec.cc.o" "gcc" "examples/hub/CMakeFiles/muduo_pubsub.dir/codec.cc.o.d"
+  "/root/repo/examples/hub/pubsub.cc" "examples/hub/CMakeFiles/muduo_pubsub.dir/pubsub.cc.o" "gcc" "examples/hub/CMakeFiles/muduo_pubsub.dir/pubsub.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/muduo/net/CMakeFiles/muduo_net.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/muduo/base/CMakeFiles/muduo_base.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/sub"
+  "../../bin/sub.pdb"
+  "CMakeFiles/sub.dir/sub.cc.o"
+  "CMakeFiles/sub.dir/sub.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sub.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/logdecode"
+  "../../bin/logdecode.pdb"
+  "CMakeFiles/logdecode.dir/logdecode.cc.o"
+  "CMakeFiles/logdecode.dir/logdecode.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/logdecode.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/maxconnection_echo"
+  "../../bin/maxconnection_echo.pdb"
+  "CMakeFiles/maxconnection_echo.dir/echo.cc.o"
+  "CMakeFiles/maxconnection_echo.dir/echo.cc.o.d"
+  "CMakeFiles/maxconnection_echo.dir/main.cc.o"
+  "CMakeFiles/maxconnection_echo.dir/main.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/maxconnection_echo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/memcached_bench"
+  "../../../bin/memcached_bench.pdb"
+  "CMakeFiles/memcached_bench.dir/bench.cc.o"
+  "CMakeFiles/memcached_bench.dir/bench.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/memcached_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../../bin/memcached_footprint"
+  "../../../bin/memcached_footprint.pdb"
+  "CMakeFiles/memcached_footprint.dir/Item.cc.o"
+  "CMakeFiles/memcached_footprint.dir/Item.cc.o.d"
+  "CMakeFiles/memcached_footprint.dir/MemcacheServer.cc.o"
+  "CMakeFiles/memcached_footprint.dir/MemcacheServer.cc.o.d"
+  "CMakeFiles/memcached_footprint.dir/Session.cc.o"
+  "CMakeFiles/memcached_footprint.dir/Session.cc.o.d"
+  "CMakeFiles/memcached_footprint.dir/footprint_test.cc.o"
+  "CMakeFiles/memcached_footprint.dir/footprint_test.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/memcached_footprint.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/multiplex_server"
+  "../../bin/multiplex_server.pdb"
+  "CMakeFiles/multiplex_server.dir/multiplexer.cc.o"
+  "CMakeFiles/multiplex_server.dir/multiplexer.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/multiplex_server.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
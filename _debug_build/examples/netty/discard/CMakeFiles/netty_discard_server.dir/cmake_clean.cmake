@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/netty_discard_server"
+  "../../../bin/netty_discard_server.pdb"
+  "CMakeFiles/netty_discard_server.dir/server.cc.o"
+  "CMakeFiles/netty_discard_server.dir/server.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/netty_discard_server.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/netty_echo_client"
+  "../../../bin/netty_echo_client.pdb"
+  "CMakeFiles/netty_echo_client.dir/client.cc.o"
+  "CMakeFiles/netty_echo_client.dir/client.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/netty_echo_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
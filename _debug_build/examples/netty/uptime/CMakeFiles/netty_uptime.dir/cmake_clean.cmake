@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/netty_uptime"
+  "../../../bin/netty_uptime.pdb"
+  "CMakeFiles/netty_uptime.dir/uptime.cc.o"
+  "CMakeFiles/netty_uptime.dir/uptime.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/netty_uptime.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/pingpong_client"
+  "../../bin/pingpong_client.pdb"
+  "CMakeFiles/pingpong_client.dir/client.cc.o"
+  "CMakeFiles/pingpong_client.dir/client.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pingpong_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/pingpong_server"
+  "../../bin/pingpong_server.pdb"
+  "CMakeFiles/pingpong_server.dir/server.cc.o"
+  "CMakeFiles/pingpong_server.dir/server.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pingpong_server.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/dummyload"
+  "../../bin/dummyload.pdb"
+  "CMakeFiles/dummyload.dir/dummyload.cc.o"
+  "CMakeFiles/dummyload.dir/dummyload.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dummyload.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
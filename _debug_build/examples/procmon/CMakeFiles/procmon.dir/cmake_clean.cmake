@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/procmon"
+  "../../bin/procmon.pdb"
+  "CMakeFiles/procmon.dir/plot.cc.o"
+  "CMakeFiles/procmon.dir/plot.cc.o.d"
+  "CMakeFiles/procmon.dir/procmon.cc.o"
+  "CMakeFiles/procmon.dir/procmon.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/procmon.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/protobuf_codec_all"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/protobuf_codec_all.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
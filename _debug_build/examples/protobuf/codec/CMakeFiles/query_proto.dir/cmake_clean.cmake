@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../lib/libquery_proto.a"
+  "../../../lib/libquery_proto.pdb"
+  "CMakeFiles/query_proto.dir/query.pb.cc.o"
+  "CMakeFiles/query_proto.dir/query.pb.cc.o.d"
+  "query.pb.cc"
+  "query.pb.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/query_proto.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
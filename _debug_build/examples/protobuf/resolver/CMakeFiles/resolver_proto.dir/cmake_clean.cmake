@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../lib/libresolver_proto.a"
+  "../../../lib/libresolver_proto.pdb"
+  "CMakeFiles/resolver_proto.dir/resolver.pb.cc.o"
+  "CMakeFiles/resolver_proto.dir/resolver.pb.cc.o.d"
+  "resolver.pb.cc"
+  "resolver.pb.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/resolver_proto.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/protobuf_rpc_all"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/protobuf_rpc_all.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
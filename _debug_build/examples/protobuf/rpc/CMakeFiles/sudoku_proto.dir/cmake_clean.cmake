@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../lib/libsudoku_proto.a"
+  "../../../lib/libsudoku_proto.pdb"
+  "CMakeFiles/sudoku_proto.dir/sudoku.pb.cc.o"
+  "CMakeFiles/sudoku_proto.dir/sudoku.pb.cc.o.d"
+  "sudoku.pb.cc"
+  "sudoku.pb.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sudoku_proto.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
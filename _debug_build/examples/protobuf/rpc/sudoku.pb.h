@@ -0,0 +1,658 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: sudoku.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_sudoku_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_sudoku_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/service.h>
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_sudoku_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_sudoku_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_sudoku_2eproto;
+namespace sudoku {
+class SudokuRequest;
+struct SudokuRequestDefaultTypeInternal;
+extern SudokuRequestDefaultTypeInternal _SudokuRequest_default_instance_;
+class SudokuResponse;
+struct SudokuResponseDefaultTypeInternal;
+extern SudokuResponseDefaultTypeInternal _SudokuResponse_default_instance_;
+}  // namespace sudoku
+PROTOBUF_NAMESPACE_OPEN
+template<> ::sudoku::SudokuRequest* Arena::CreateMaybeMessage<::sudoku::SudokuRequest>(Arena*);
+template<> ::sudoku::SudokuResponse* Arena::CreateMaybeMessage<::sudoku::SudokuResponse>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace sudoku {
+
+// ===================================================================
+
+class SudokuRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sudoku.SudokuRequest) */ {
+ public:
+  inline SudokuRequest() : SudokuRequest(nullptr) {}
+  ~SudokuRequest() override;
+  explicit PROTOBUF_CONSTEXPR SudokuRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SudokuRequest(const SudokuRequest& from);
+  SudokuRequest(SudokuRequest&& from) noexcept
+    : SudokuRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline SudokuRequest& operator=(const SudokuRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SudokuRequest& operator=(SudokuRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SudokuRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SudokuRequest* internal_default_instance() {
+    return reinterpret_cast<const SudokuRequest*>(
+               &_SudokuRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(SudokuRequest& a, SudokuRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SudokuRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SudokuRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SudokuRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SudokuRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SudokuRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SudokuRequest& from) {
+    SudokuRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SudokuRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sudoku.SudokuRequest";
+  }
+  protected:
+  explicit SudokuRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCheckerboardFieldNumber = 1,
+  };
+  // required string checkerboard = 1;
+  bool has_checkerboard() const;
+  private:
+  bool _internal_has_checkerboard() const;
+  public:
+  void clear_checkerboard();
+  const std::string& checkerboard() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_checkerboard(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_checkerboard();
+  PROTOBUF_NODISCARD std::string* release_checkerboard();
+  void set_allocated_checkerboard(std::string* checkerboard);
+  private:
+  const std::string& _internal_checkerboard() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_checkerboard(const std::string& value);
+  std::string* _internal_mutable_checkerboard();
+  public:
+
+  // @@protoc_insertion_point(class_scope:sudoku.SudokuRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr checkerboard_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sudoku_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SudokuResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sudoku.SudokuResponse) */ {
+ public:
+  inline SudokuResponse() : SudokuResponse(nullptr) {}
+  ~SudokuResponse() override;
+  explicit PROTOBUF_CONSTEXPR SudokuResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SudokuResponse(const SudokuResponse& from);
+  SudokuResponse(SudokuResponse&& from) noexcept
+    : SudokuResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline SudokuResponse& operator=(const SudokuResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SudokuResponse& operator=(SudokuResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SudokuResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SudokuResponse* internal_default_instance() {
+    return reinterpret_cast<const SudokuResponse*>(
+               &_SudokuResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(SudokuResponse& a, SudokuResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SudokuResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SudokuResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SudokuResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SudokuResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SudokuResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SudokuResponse& from) {
+    SudokuResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SudokuResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sudoku.SudokuResponse";
+  }
+  protected:
+  explicit SudokuResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCheckerboardFieldNumber = 2,
+    kSolvedFieldNumber = 1,
+  };
+  // optional string checkerboard = 2;
+  bool has_checkerboard() const;
+  private:
+  bool _internal_has_checkerboard() const;
+  public:
+  void clear_checkerboard();
+  const std::string& checkerboard() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_checkerboard(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_checkerboard();
+  PROTOBUF_NODISCARD std::string* release_checkerboard();
+  void set_allocated_checkerboard(std::string* checkerboard);
+  private:
+  const std::string& _internal_checkerboard() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_checkerboard(const std::string& value);
+  std::string* _internal_mutable_checkerboard();
+  public:
+
+  // optional bool solved = 1 [default = false];
+  bool has_solved() const;
+  private:
+  bool _internal_has_solved() const;
+  public:
+  void clear_solved();
+  bool solved() const;
+  void set_solved(bool value);
+  private:
+  bool _internal_solved() const;
+  void _internal_set_solved(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:sudoku.SudokuResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr checkerboard_;
+    bool solved_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sudoku_2eproto;
+};
+// ===================================================================
+
+class SudokuService_Stub;
+
+class SudokuService : public ::PROTOBUF_NAMESPACE_ID::Service {
+ protected:
+  // This class should be treated as an abstract interface.
+  inline SudokuService() {};
+ public:
+  virtual ~SudokuService();
+
+  typedef SudokuService_Stub Stub;
+
+  static const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* descriptor();
+
+  virtual void Solve(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::sudoku::SudokuRequest* request,
+                       ::sudoku::SudokuResponse* response,
+                       ::google::protobuf::Closure* done);
+
+  // implements Service ----------------------------------------------
+
+  const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* GetDescriptor();
+  void CallMethod(const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method,
+                  ::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                  const ::PROTOBUF_NAMESPACE_ID::Message* request,
+                  ::PROTOBUF_NAMESPACE_ID::Message* response,
+                  ::google::protobuf::Closure* done);
+  const ::PROTOBUF_NAMESPACE_ID::Message& GetRequestPrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
+  const ::PROTOBUF_NAMESPACE_ID::Message& GetResponsePrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
+
+ private:
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(SudokuService);
+};
+
+class SudokuService_Stub : public SudokuService {
+ public:
+  SudokuService_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel);
+  SudokuService_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel,
+                   ::PROTOBUF_NAMESPACE_ID::Service::ChannelOwnership ownership);
+  ~SudokuService_Stub();
+
+  inline ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel() { return channel_; }
+
+  // implements SudokuService ------------------------------------------
+
+  void Solve(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::sudoku::SudokuRequest* request,
+                       ::sudoku::SudokuResponse* response,
+                       ::google::protobuf::Closure* done);
+ private:
+  ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel_;
+  bool owns_channel_;
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(SudokuService_Stub);
+};
+
+
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// SudokuRequest
+
+// required string checkerboard = 1;
+inline bool SudokuRequest::_internal_has_checkerboard() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SudokuRequest::has_checkerboard() const {
+  return _internal_has_checkerboard();
+}
+inline void SudokuRequest::clear_checkerboard() {
+  _impl_.checkerboard_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& SudokuRequest::checkerboard() const {
+  // @@protoc_insertion_point(field_get:sudoku.SudokuRequest.checkerboard)
+  return _internal_checkerboard();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SudokuRequest::set_checkerboard(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.checkerboard_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:sudoku.SudokuRequest.checkerboard)
+}
+inline std::string* SudokuRequest::mutable_checkerboard() {
+  std::string* _s = _internal_mutable_checkerboard();
+  // @@protoc_insertion_point(field_mutable:sudoku.SudokuRequest.checkerboard)
+  return _s;
+}
+inline const std::string& SudokuRequest::_internal_checkerboard() const {
+  return _impl_.checkerboard_.Get();
+}
+inline void SudokuRequest::_internal_set_checkerboard(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.checkerboard_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SudokuRequest::_internal_mutable_checkerboard() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.checkerboard_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SudokuRequest::release_checkerboard() {
+  // @@protoc_insertion_point(field_release:sudoku.SudokuRequest.checkerboard)
+  if (!_internal_has_checkerboard()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.checkerboard_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.checkerboard_.IsDefault()) {
+    _impl_.checkerboard_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SudokuRequest::set_allocated_checkerboard(std::string* checkerboard) {
+  if (checkerboard != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.checkerboard_.SetAllocated(checkerboard, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.checkerboard_.IsDefault()) {
+    _impl_.checkerboard_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:sudoku.SudokuRequest.checkerboard)
+}
+
+// -------------------------------------------------------------------
+
+// SudokuResponse
+
+// optional bool solved = 1 [default = false];
+inline bool SudokuResponse::_internal_has_solved() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SudokuResponse::has_solved() const {
+  return _internal_has_solved();
+}
+inline void SudokuResponse::clear_solved() {
+  _impl_.solved_ = false;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline bool SudokuResponse::_internal_solved() const {
+  return _impl_.solved_;
+}
+inline bool SudokuResponse::solved() const {
+  // @@protoc_insertion_point(field_get:sudoku.SudokuResponse.solved)
+  return _internal_solved();
+}
+inline void SudokuResponse::_internal_set_solved(bool value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.solved_ = value;
+}
+inline void SudokuResponse::set_solved(bool value) {
+  _internal_set_solved(value);
+  // @@protoc_insertion_point(field_set:sudoku.SudokuResponse.solved)
+}
+
+// optional string checkerboard = 2;
+inline bool SudokuResponse::_internal_has_checkerboard() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SudokuResponse::has_checkerboard() const {
+  return _internal_has_checkerboard();
+}
+inline void SudokuResponse::clear_checkerboard() {
+  _impl_.checkerboard_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& SudokuResponse::checkerboard() const {
+  // @@protoc_insertion_point(field_get:sudoku.SudokuResponse.checkerboard)
+  return _internal_checkerboard();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SudokuResponse::set_checkerboard(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.checkerboard_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:sudoku.SudokuResponse.checkerboard)
+}
+inline std::string* SudokuResponse::mutable_checkerboard() {
+  std::string* _s = _internal_mutable_checkerboard();
+  // @@protoc_insertion_point(field_mutable:sudoku.SudokuResponse.checkerboard)
+  return _s;
+}
+inline const std::string& SudokuResponse::_internal_checkerboard() const {
+  return _impl_.checkerboard_.Get();
+}
+inline void SudokuResponse::_internal_set_checkerboard(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.checkerboard_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SudokuResponse::_internal_mutable_checkerboard() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.checkerboard_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SudokuResponse::release_checkerboard() {
+  // @@protoc_insertion_point(field_release:sudoku.SudokuResponse.checkerboard)
+  if (!_internal_has_checkerboard()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.checkerboard_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.checkerboard_.IsDefault()) {
+    _impl_.checkerboard_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SudokuResponse::set_allocated_checkerboard(std::string* checkerboard) {
+  if (checkerboard != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.checkerboard_.SetAllocated(checkerboard, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.checkerboard_.IsDefault()) {
+    _impl_.checkerboard_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:sudoku.SudokuResponse.checkerboard)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace sudoku
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_sudoku_2eproto
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/protobuf_rpc_balancer_raw"
+  "../../../bin/protobuf_rpc_balancer_raw.pdb"
+  "CMakeFiles/protobuf_rpc_balancer_raw.dir/balancer_raw.cc.o"
+  "CMakeFiles/protobuf_rpc_balancer_raw.dir/balancer_raw.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/protobuf_rpc_balancer_raw.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/examples/protobuf/rpcbalancer
+# Build directory: /root/repo/_debug_build/examples/protobuf/rpcbalancer
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
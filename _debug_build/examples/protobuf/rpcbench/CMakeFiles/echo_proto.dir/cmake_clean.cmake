@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../lib/libecho_proto.a"
+  "../../../lib/libecho_proto.pdb"
+  "CMakeFiles/echo_proto.dir/echo.pb.cc.o"
+  "CMakeFiles/echo_proto.dir/echo.pb.cc.o.d"
+  "echo.pb.cc"
+  "echo.pb.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/echo_proto.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/protobuf_rpc_echo_server"
+  "../../../bin/protobuf_rpc_echo_server.pdb"
+  "CMakeFiles/protobuf_rpc_echo_server.dir/server.cc.o"
+  "CMakeFiles/protobuf_rpc_echo_server.dir/server.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/protobuf_rpc_echo_server.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/examples/protobuf/rpcbench
+# Build directory: /root/repo/_debug_build/examples/protobuf/rpcbench
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/roundtrip_udp"
+  "../../bin/roundtrip_udp.pdb"
+  "CMakeFiles/roundtrip_udp.dir/roundtrip_udp.cc.o"
+  "CMakeFiles/roundtrip_udp.dir/roundtrip_udp.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/roundtrip_udp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
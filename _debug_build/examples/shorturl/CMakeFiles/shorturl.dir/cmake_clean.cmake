@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/shorturl"
+  "../../bin/shorturl.pdb"
+  "CMakeFiles/shorturl.dir/shorturl.cc.o"
+  "CMakeFiles/shorturl.dir/shorturl.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/shorturl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/simple_chargen"
+  "../../bin/simple_chargen.pdb"
+  "CMakeFiles/simple_chargen.dir/chargen/chargen.cc.o"
+  "CMakeFiles/simple_chargen.dir/chargen/chargen.cc.o.d"
+  "CMakeFiles/simple_chargen.dir/chargen/main.cc.o"
+  "CMakeFiles/simple_chargen.dir/chargen/main.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simple_chargen.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
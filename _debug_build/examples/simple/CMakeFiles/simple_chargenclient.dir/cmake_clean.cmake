@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/simple_chargenclient"
+  "../../bin/simple_chargenclient.pdb"
+  "CMakeFiles/simple_chargenclient.dir/chargenclient/chargenclient.cc.o"
+  "CMakeFiles/simple_chargenclient.dir/chargenclient/chargenclient.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simple_chargenclient.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/simple_discard"
+  "../../bin/simple_discard.pdb"
+  "CMakeFiles/simple_discard.dir/discard/discard.cc.o"
+  "CMakeFiles/simple_discard.dir/discard/discard.cc.o.d"
+  "CMakeFiles/simple_discard.dir/discard/main.cc.o"
+  "CMakeFiles/simple_discard.dir/discard/main.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simple_discard.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
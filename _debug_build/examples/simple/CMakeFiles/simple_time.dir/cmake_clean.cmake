@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/simple_time"
+  "../../bin/simple_time.pdb"
+  "CMakeFiles/simple_time.dir/time/main.cc.o"
+  "CMakeFiles/simple_time.dir/time/main.cc.o.d"
+  "CMakeFiles/simple_time.dir/time/time.cc.o"
+  "CMakeFiles/simple_time.dir/time/time.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simple_time.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/simple_timeclient"
+  "../../bin/simple_timeclient.pdb"
+  "CMakeFiles/simple_timeclient.dir/timeclient/timeclient.cc.o"
+  "CMakeFiles/simple_timeclient.dir/timeclient/timeclient.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simple_timeclient.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/socks4a"
+  "../../bin/socks4a.pdb"
+  "CMakeFiles/socks4a.dir/socks4a.cc.o"
+  "CMakeFiles/socks4a.dir/socks4a.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/socks4a.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/sudoku_solver_multiloop"
+  "../../bin/sudoku_solver_multiloop.pdb"
+  "CMakeFiles/sudoku_solver_multiloop.dir/server_multiloop.cc.o"
+  "CMakeFiles/sudoku_solver_multiloop.dir/server_multiloop.cc.o.d"
+  "CMakeFiles/sudoku_solver_multiloop.dir/sudoku.cc.o"
+  "CMakeFiles/sudoku_solver_multiloop.dir/sudoku.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sudoku_solver_multiloop.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/sudoku_solver_threadpool"
+  "../../bin/sudoku_solver_threadpool.pdb"
+  "CMakeFiles/sudoku_solver_threadpool.dir/server_threadpool.cc.o"
+  "CMakeFiles/sudoku_solver_threadpool.dir/server_threadpool.cc.o.d"
+  "CMakeFiles/sudoku_solver_threadpool.dir/sudoku.cc.o"
+  "CMakeFiles/sudoku_solver_threadpool.dir/sudoku.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sudoku_solver_threadpool.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
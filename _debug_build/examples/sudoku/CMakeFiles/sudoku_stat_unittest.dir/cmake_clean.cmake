@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/sudoku_stat_unittest"
+  "../../bin/sudoku_stat_unittest.pdb"
+  "CMakeFiles/sudoku_stat_unittest.dir/stat_unittest.cc.o"
+  "CMakeFiles/sudoku_stat_unittest.dir/stat_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sudoku_stat_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
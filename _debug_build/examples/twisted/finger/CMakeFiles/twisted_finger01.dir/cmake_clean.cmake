@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/twisted_finger01"
+  "../../../bin/twisted_finger01.pdb"
+  "CMakeFiles/twisted_finger01.dir/finger01.cc.o"
+  "CMakeFiles/twisted_finger01.dir/finger01.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/twisted_finger01.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
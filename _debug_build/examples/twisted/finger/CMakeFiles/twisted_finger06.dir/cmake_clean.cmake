@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/twisted_finger06"
+  "../../../bin/twisted_finger06.pdb"
+  "CMakeFiles/twisted_finger06.dir/finger06.cc.o"
+  "CMakeFiles/twisted_finger06.dir/finger06.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/twisted_finger06.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
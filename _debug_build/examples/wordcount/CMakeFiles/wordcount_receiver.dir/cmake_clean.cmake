@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/wordcount_receiver"
+  "../../bin/wordcount_receiver.pdb"
+  "CMakeFiles/wordcount_receiver.dir/receiver.cc.o"
+  "CMakeFiles/wordcount_receiver.dir/receiver.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/wordcount_receiver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
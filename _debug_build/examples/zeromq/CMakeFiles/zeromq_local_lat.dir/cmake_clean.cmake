@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/zeromq_local_lat"
+  "../../bin/zeromq_local_lat.pdb"
+  "CMakeFiles/zeromq_local_lat.dir/local_lat.cc.o"
+  "CMakeFiles/zeromq_local_lat.dir/local_lat.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/zeromq_local_lat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,36 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/muduo/base/AsyncLogging.cc" "muduo/base/CMakeFiles/muduo_base.dir/AsyncLogging.cc.o" "gcc" "muduo/base/CMakeFiles/muduo_base.dir/AsyncLogging.cc.o.d"
+  "/root/repo/muduo/base/BinaryLogging.cc" "muduo/base/CMakeFiles/muduo_base.dir/BinaryLogging.cc.o" "gcc" "muduo/base/CMakeFiles/muduo_base.dir/BinaryLogging.cc.o.d"
+  "/root/repo/muduo/base/Condition.cc" "muduo/base/CMakeFiles/muduo_base.dir/Condition.cc.o" "gcc" "muduo/base/CMakeFiles/muduo_base.dir/Condition.cc.o.d"
+  "/root/repo/muduo/base/CountDownLatch.cc" "muduo/base/CMakeFiles/muduo_base.dir/CountDownLatch.cc.o" "gcc" "muduo/base/CMakeFiles/muduo_base.dir/CountDownLatch.cc.o.d"
+  "/root/repo/muduo/base/CurrentThread.cc" "muduo/base/CMakeFiles/muduo_base.dir/CurrentThread.cc.o" "gcc" "muduo/base/CMakeFiles/muduo_base.dir/CurrentThread.cc.o.d"
+  "/root/repo/muduo/base/Date.cc" "muduo/base/CMakeFiles/muduo_base.dir/Date.cc.o" "gcc" "muduo/base/CMakeFiles/muduo_base.dir/Date.cc.o.d"
+  "/root/repo/muduo/base/Exception.cc" "muduo/base/CMakeFiles/muduo_base.dir/Exception.cc.o" "gcc" "muduo/base/CMakeFiles/muduo_base.dir/Exception.cc.o.d"
+  "/root/repo/muduo/base/FileUtil.cc" "muduo/base/CMakeFiles/muduo_base.dir/FileUtil.cc.o" "gcc" "muduo/base/CMakeFiles/muduo_base.dir/FileUtil.cc.o.d"
+  "/root/repo/muduo/base/LogCompressor.cc" "muduo/base/CMakeFiles/muduo_base.dir/LogCompressor.cc.o" "gcc" "muduo/base/CMakeFiles/muduo_base.dir/LogCompressor.cc.o.d"
+  "/root/repo/muduo/base/LogFile.cc" "muduo/base/CMakeFiles/muduo_base.dir/LogFile.cc.o" "gcc" "muduo/base/CMakeFiles/muduo_base.dir/LogFile.cc.o.d"
+  "/root/repo/muduo/base/LogStream.cc" "muduo/base/CMakeFiles/muduo_base.dir/LogStream.cc.o" "gcc" "muduo/base/CMakeFiles/muduo_base.dir/LogStream.cc.o.d"
+  "/root/repo/muduo/base/Logging.cc" "muduo/base/CMakeFiles/muduo_base.dir/Logging.cc.o" "gcc" "muduo/base/CMakeFiles/muduo_base.dir/Logging.cc.o.d"
+  "/root/repo/muduo/base/ProcessInfo.cc" "muduo/base/CMakeFiles/muduo_base.dir/ProcessInfo.cc.o" "gcc" "muduo/base/CMakeFiles/muduo_base.dir/ProcessInfo.cc.o.d"
+  "/root/repo/muduo/base/Thread.cc" "muduo/base/CMakeFiles/muduo_base.dir/Thread.cc.o" "gcc" "muduo/base/CMakeFiles/muduo_base.dir/Thread.cc.o.d"
+  "/root/repo/muduo/base/ThreadPool.cc" "muduo/base/CMakeFiles/muduo_base.dir/ThreadPool.cc.o" "gcc" "muduo/base/CMakeFiles/muduo_base.dir/ThreadPool.cc.o.d"
+  "/root/repo/muduo/base/TimeZone.cc" "muduo/base/CMakeFiles/muduo_base.dir/TimeZone.cc.o" "gcc" "muduo/base/CMakeFiles/muduo_base.dir/TimeZone.cc.o.d"
+  "/root/repo/muduo/base/Timestamp.cc" "muduo/base/CMakeFiles/muduo_base.dir/Timestamp.cc.o" "gcc" "muduo/base/CMakeFiles/muduo_base.dir/Timestamp.cc.o.d"
+  "/root/repo/muduo/base/WorkStealingThreadPool.cc" "muduo/base/CMakeFiles/muduo_base.dir/WorkStealingThreadPool.cc.o" "gcc" "muduo/base/CMakeFiles/muduo_base.dir/WorkStealingThreadPool.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
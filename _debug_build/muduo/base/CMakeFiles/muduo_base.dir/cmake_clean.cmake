@@ -0,0 +1,45 @@
+file(REMOVE_RECURSE
+  "../../lib/libmuduo_base.a"
+  "../../lib/libmuduo_base.pdb"
+  "CMakeFiles/muduo_base.dir/AsyncLogging.cc.o"
+  "CMakeFiles/muduo_base.dir/AsyncLogging.cc.o.d"
+  "CMakeFiles/muduo_base.dir/BinaryLogging.cc.o"
+  "CMakeFiles/muduo_base.dir/BinaryLogging.cc.o.d"
+  "CMakeFiles/muduo_base.dir/Condition.cc.o"
+  "CMakeFiles/muduo_base.dir/Condition.cc.o.d"
+  "CMakeFiles/muduo_base.dir/CountDownLatch.cc.o"
+  "CMakeFiles/muduo_base.dir/CountDownLatch.cc.o.d"
+  "CMakeFiles/muduo_base.dir/CurrentThread.cc.o"
+  "CMakeFiles/muduo_base.dir/CurrentThread.cc.o.d"
+  "CMakeFiles/muduo_base.dir/Date.cc.o"
+  "CMakeFiles/muduo_base.dir/Date.cc.o.d"
+  "CMakeFiles/muduo_base.dir/Exception.cc.o"
+  "CMakeFiles/muduo_base.dir/Exception.cc.o.d"
+  "CMakeFiles/muduo_base.dir/FileUtil.cc.o"
+  "CMakeFiles/muduo_base.dir/FileUtil.cc.o.d"
+  "CMakeFiles/muduo_base.dir/LogCompressor.cc.o"
+  "CMakeFiles/muduo_base.dir/LogCompressor.cc.o.d"
+  "CMakeFiles/muduo_base.dir/LogFile.cc.o"
+  "CMakeFiles/muduo_base.dir/LogFile.cc.o.d"
+  "CMakeFiles/muduo_base.dir/LogStream.cc.o"
+  "CMakeFiles/muduo_base.dir/LogStream.cc.o.d"
+  "CMakeFiles/muduo_base.dir/Logging.cc.o"
+  "CMakeFiles/muduo_base.dir/Logging.cc.o.d"
+  "CMakeFiles/muduo_base.dir/ProcessInfo.cc.o"
+  "CMakeFiles/muduo_base.dir/ProcessInfo.cc.o.d"
+  "CMakeFiles/muduo_base.dir/Thread.cc.o"
+  "CMakeFiles/muduo_base.dir/Thread.cc.o.d"
+  "CMakeFiles/muduo_base.dir/ThreadPool.cc.o"
+  "CMakeFiles/muduo_base.dir/ThreadPool.cc.o.d"
+  "CMakeFiles/muduo_base.dir/TimeZone.cc.o"
+  "CMakeFiles/muduo_base.dir/TimeZone.cc.o.d"
+  "CMakeFiles/muduo_base.dir/Timestamp.cc.o"
+  "CMakeFiles/muduo_base.dir/Timestamp.cc.o.d"
+  "CMakeFiles/muduo_base.dir/WorkStealingThreadPool.cc.o"
+  "CMakeFiles/muduo_base.dir/WorkStealingThreadPool.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/muduo_base.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/asynclogging_bench"
+  "../../../bin/asynclogging_bench.pdb"
+  "CMakeFiles/asynclogging_bench.dir/AsyncLogging_bench.cc.o"
+  "CMakeFiles/asynclogging_bench.dir/AsyncLogging_bench.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/asynclogging_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
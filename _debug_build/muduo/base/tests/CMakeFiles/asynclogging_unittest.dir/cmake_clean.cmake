@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/asynclogging_unittest"
+  "../../../bin/asynclogging_unittest.pdb"
+  "CMakeFiles/asynclogging_unittest.dir/AsyncLogging_unittest.cc.o"
+  "CMakeFiles/asynclogging_unittest.dir/AsyncLogging_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/asynclogging_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/atomic_unittest"
+  "../../../bin/atomic_unittest.pdb"
+  "CMakeFiles/atomic_unittest.dir/Atomic_unittest.cc.o"
+  "CMakeFiles/atomic_unittest.dir/Atomic_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/atomic_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
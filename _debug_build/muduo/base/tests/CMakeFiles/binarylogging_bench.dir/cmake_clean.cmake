@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/binarylogging_bench"
+  "../../../bin/binarylogging_bench.pdb"
+  "CMakeFiles/binarylogging_bench.dir/BinaryLogging_bench.cc.o"
+  "CMakeFiles/binarylogging_bench.dir/BinaryLogging_bench.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/binarylogging_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
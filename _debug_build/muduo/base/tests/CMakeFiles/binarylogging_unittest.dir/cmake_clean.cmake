@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/binarylogging_unittest"
+  "../../../bin/binarylogging_unittest.pdb"
+  "CMakeFiles/binarylogging_unittest.dir/BinaryLogging_unittest.cc.o"
+  "CMakeFiles/binarylogging_unittest.dir/BinaryLogging_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/binarylogging_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/blockingqueue_test"
+  "../../../bin/blockingqueue_test.pdb"
+  "CMakeFiles/blockingqueue_test.dir/BlockingQueue_test.cc.o"
+  "CMakeFiles/blockingqueue_test.dir/BlockingQueue_test.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/blockingqueue_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
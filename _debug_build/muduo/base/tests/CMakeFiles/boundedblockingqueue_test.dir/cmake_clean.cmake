@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/boundedblockingqueue_test"
+  "../../../bin/boundedblockingqueue_test.pdb"
+  "CMakeFiles/boundedblockingqueue_test.dir/BoundedBlockingQueue_test.cc.o"
+  "CMakeFiles/boundedblockingqueue_test.dir/BoundedBlockingQueue_test.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/boundedblockingqueue_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
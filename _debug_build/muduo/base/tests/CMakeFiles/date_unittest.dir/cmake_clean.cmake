@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/date_unittest"
+  "../../../bin/date_unittest.pdb"
+  "CMakeFiles/date_unittest.dir/Date_unittest.cc.o"
+  "CMakeFiles/date_unittest.dir/Date_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/date_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/inlinefunction_unittest"
+  "../../../bin/inlinefunction_unittest.pdb"
+  "CMakeFiles/inlinefunction_unittest.dir/InlineFunction_unittest.cc.o"
+  "CMakeFiles/inlinefunction_unittest.dir/InlineFunction_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/inlinefunction_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
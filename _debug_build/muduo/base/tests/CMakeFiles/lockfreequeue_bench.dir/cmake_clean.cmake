@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/lockfreequeue_bench"
+  "../../../bin/lockfreequeue_bench.pdb"
+  "CMakeFiles/lockfreequeue_bench.dir/LockFreeQueue_bench.cc.o"
+  "CMakeFiles/lockfreequeue_bench.dir/LockFreeQueue_bench.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lockfreequeue_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/lockfreequeue_unittest"
+  "../../../bin/lockfreequeue_unittest.pdb"
+  "CMakeFiles/lockfreequeue_unittest.dir/LockFreeQueue_unittest.cc.o"
+  "CMakeFiles/lockfreequeue_unittest.dir/LockFreeQueue_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lockfreequeue_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
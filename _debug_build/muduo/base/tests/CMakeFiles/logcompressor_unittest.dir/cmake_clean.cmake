@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/logcompressor_unittest"
+  "../../../bin/logcompressor_unittest.pdb"
+  "CMakeFiles/logcompressor_unittest.dir/LogCompressor_unittest.cc.o"
+  "CMakeFiles/logcompressor_unittest.dir/LogCompressor_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/logcompressor_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/logfile_bench"
+  "../../../bin/logfile_bench.pdb"
+  "CMakeFiles/logfile_bench.dir/LogFile_bench.cc.o"
+  "CMakeFiles/logfile_bench.dir/LogFile_bench.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/logfile_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/logfile_unittest"
+  "../../../bin/logfile_unittest.pdb"
+  "CMakeFiles/logfile_unittest.dir/LogFile_unittest.cc.o"
+  "CMakeFiles/logfile_unittest.dir/LogFile_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/logfile_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/logging_test"
+  "../../../bin/logging_test.pdb"
+  "CMakeFiles/logging_test.dir/Logging_test.cc.o"
+  "CMakeFiles/logging_test.dir/Logging_test.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/logging_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/logging_unittest"
+  "../../../bin/logging_unittest.pdb"
+  "CMakeFiles/logging_unittest.dir/Logging_unittest.cc.o"
+  "CMakeFiles/logging_unittest.dir/Logging_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/logging_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
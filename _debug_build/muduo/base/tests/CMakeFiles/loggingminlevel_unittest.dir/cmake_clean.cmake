@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/loggingminlevel_unittest"
+  "../../../bin/loggingminlevel_unittest.pdb"
+  "CMakeFiles/loggingminlevel_unittest.dir/LoggingMinLevel_unittest.cc.o"
+  "CMakeFiles/loggingminlevel_unittest.dir/LoggingMinLevel_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/loggingminlevel_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/logstream_bench"
+  "../../../bin/logstream_bench.pdb"
+  "CMakeFiles/logstream_bench.dir/LogStream_bench.cc.o"
+  "CMakeFiles/logstream_bench.dir/LogStream_bench.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/logstream_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
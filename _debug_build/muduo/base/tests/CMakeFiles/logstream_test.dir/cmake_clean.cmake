@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/logstream_test"
+  "../../../bin/logstream_test.pdb"
+  "CMakeFiles/logstream_test.dir/LogStream_test.cc.o"
+  "CMakeFiles/logstream_test.dir/LogStream_test.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/logstream_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/logstreamconvert_bench"
+  "../../../bin/logstreamconvert_bench.pdb"
+  "CMakeFiles/logstreamconvert_bench.dir/LogStreamConvert_bench.cc.o"
+  "CMakeFiles/logstreamconvert_bench.dir/LogStreamConvert_bench.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/logstreamconvert_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
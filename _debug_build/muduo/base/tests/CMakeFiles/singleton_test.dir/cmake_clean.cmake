@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/singleton_test"
+  "../../../bin/singleton_test.pdb"
+  "CMakeFiles/singleton_test.dir/Singleton_test.cc.o"
+  "CMakeFiles/singleton_test.dir/Singleton_test.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/singleton_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/thread_test"
+  "../../../bin/thread_test.pdb"
+  "CMakeFiles/thread_test.dir/Thread_test.cc.o"
+  "CMakeFiles/thread_test.dir/Thread_test.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/thread_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/threadlocal_test"
+  "../../../bin/threadlocal_test.pdb"
+  "CMakeFiles/threadlocal_test.dir/ThreadLocal_test.cc.o"
+  "CMakeFiles/threadlocal_test.dir/ThreadLocal_test.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/threadlocal_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
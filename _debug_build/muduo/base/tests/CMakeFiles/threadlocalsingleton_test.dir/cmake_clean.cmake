@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/threadlocalsingleton_test"
+  "../../../bin/threadlocalsingleton_test.pdb"
+  "CMakeFiles/threadlocalsingleton_test.dir/ThreadLocalSingleton_test.cc.o"
+  "CMakeFiles/threadlocalsingleton_test.dir/ThreadLocalSingleton_test.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/threadlocalsingleton_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/threadpool_bench"
+  "../../../bin/threadpool_bench.pdb"
+  "CMakeFiles/threadpool_bench.dir/ThreadPool_bench.cc.o"
+  "CMakeFiles/threadpool_bench.dir/ThreadPool_bench.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/threadpool_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
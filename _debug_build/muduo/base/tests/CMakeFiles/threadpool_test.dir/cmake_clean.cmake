@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/threadpool_test"
+  "../../../bin/threadpool_test.pdb"
+  "CMakeFiles/threadpool_test.dir/ThreadPool_test.cc.o"
+  "CMakeFiles/threadpool_test.dir/ThreadPool_test.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/threadpool_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
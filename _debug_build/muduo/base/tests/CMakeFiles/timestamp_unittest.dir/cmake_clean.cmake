@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/timestamp_unittest"
+  "../../../bin/timestamp_unittest.pdb"
+  "CMakeFiles/timestamp_unittest.dir/Timestamp_unittest.cc.o"
+  "CMakeFiles/timestamp_unittest.dir/Timestamp_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/timestamp_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/workstealingthreadpool_unittest"
+  "../../../bin/workstealingthreadpool_unittest.pdb"
+  "CMakeFiles/workstealingthreadpool_unittest.dir/WorkStealingThreadPool_unittest.cc.o"
+  "CMakeFiles/workstealingthreadpool_unittest.dir/WorkStealingThreadPool_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/workstealingthreadpool_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
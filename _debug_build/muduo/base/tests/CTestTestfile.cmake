@@ -0,0 +1,40 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/muduo/base/tests
+# Build directory: /root/repo/_debug_build/muduo/base/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(asynclogging_unittest "/root/repo/_debug_build/bin/asynclogging_unittest")
+set_tests_properties(asynclogging_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/base/tests/CMakeLists.txt;10;add_test;/root/repo/muduo/base/tests/CMakeLists.txt;0;")
+add_test(atomic_unittest "/root/repo/_debug_build/bin/atomic_unittest")
+set_tests_properties(atomic_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/base/tests/CMakeLists.txt;14;add_test;/root/repo/muduo/base/tests/CMakeLists.txt;0;")
+add_test(binarylogging_unittest "/root/repo/_debug_build/bin/binarylogging_unittest")
+set_tests_properties(binarylogging_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/base/tests/CMakeLists.txt;22;add_test;/root/repo/muduo/base/tests/CMakeLists.txt;0;")
+add_test(date_unittest "/root/repo/_debug_build/bin/date_unittest")
+set_tests_properties(date_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/base/tests/CMakeLists.txt;36;add_test;/root/repo/muduo/base/tests/CMakeLists.txt;0;")
+add_test(exception_test "/root/repo/_debug_build/bin/exception_test")
+set_tests_properties(exception_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/base/tests/CMakeLists.txt;40;add_test;/root/repo/muduo/base/tests/CMakeLists.txt;0;")
+add_test(fileutil_test "/root/repo/_debug_build/bin/fileutil_test")
+set_tests_properties(fileutil_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/base/tests/CMakeLists.txt;44;add_test;/root/repo/muduo/base/tests/CMakeLists.txt;0;")
+add_test(gzipfile_test "/root/repo/_debug_build/bin/gzipfile_test")
+set_tests_properties(gzipfile_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/base/tests/CMakeLists.txt;52;add_test;/root/repo/muduo/base/tests/CMakeLists.txt;0;")
+add_test(inlinefunction_unittest "/root/repo/_debug_build/bin/inlinefunction_unittest")
+set_tests_properties(inlinefunction_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/base/tests/CMakeLists.txt;58;add_test;/root/repo/muduo/base/tests/CMakeLists.txt;0;")
+add_test(lockfreequeue_unittest "/root/repo/_debug_build/bin/lockfreequeue_unittest")
+set_tests_properties(lockfreequeue_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/base/tests/CMakeLists.txt;67;add_test;/root/repo/muduo/base/tests/CMakeLists.txt;0;")
+add_test(logfile_unittest "/root/repo/_debug_build/bin/logfile_unittest")
+set_tests_properties(logfile_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/base/tests/CMakeLists.txt;79;add_test;/root/repo/muduo/base/tests/CMakeLists.txt;0;")
+add_test(logcompressor_unittest "/root/repo/_debug_build/bin/logcompressor_unittest")
+set_tests_properties(logcompressor_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/base/tests/CMakeLists.txt;85;add_test;/root/repo/muduo/base/tests/CMakeLists.txt;0;")
+add_test(logging_unittest "/root/repo/_debug_build/bin/logging_unittest")
+set_tests_properties(logging_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/base/tests/CMakeLists.txt;94;add_test;/root/repo/muduo/base/tests/CMakeLists.txt;0;")
+add_test(loggingminlevel_unittest "/root/repo/_debug_build/bin/loggingminlevel_unittest")
+set_tests_properties(loggingminlevel_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/base/tests/CMakeLists.txt;100;add_test;/root/repo/muduo/base/tests/CMakeLists.txt;0;")
+add_test(logstream_test "/root/repo/_debug_build/bin/logstream_test")
+set_tests_properties(logstream_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/base/tests/CMakeLists.txt;112;add_test;/root/repo/muduo/base/tests/CMakeLists.txt;0;")
+add_test(timestamp_unittest "/root/repo/_debug_build/bin/timestamp_unittest")
+set_tests_properties(timestamp_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/base/tests/CMakeLists.txt;147;add_test;/root/repo/muduo/base/tests/CMakeLists.txt;0;")
+add_test(timezone_unittest "/root/repo/_debug_build/bin/timezone_unittest")
+set_tests_properties(timezone_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/base/tests/CMakeLists.txt;151;add_test;/root/repo/muduo/base/tests/CMakeLists.txt;0;")
+add_test(workstealingthreadpool_unittest "/root/repo/_debug_build/bin/workstealingthreadpool_unittest")
+set_tests_properties(workstealingthreadpool_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/base/tests/CMakeLists.txt;156;add_test;/root/repo/muduo/base/tests/CMakeLists.txt;0;")
@@ -0,0 +1,42 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/muduo/net/Acceptor.cc" "muduo/net/CMakeFiles/muduo_net.dir/Acceptor.cc.o" "gcc" "muduo/net/CMakeFiles/muduo_net.dir/Acceptor.cc.o.d"
+  "/root/repo/muduo/net/Buffer.cc" "muduo/net/CMakeFiles/muduo_net.dir/Buffer.cc.o" "gcc" "muduo/net/CMakeFiles/muduo_net.dir/Buffer.cc.o.d"
+  "/root/repo/muduo/net/Channel.cc" "muduo/net/CMakeFiles/muduo_net.dir/Channel.cc.o" "gcc" "muduo/net/CMakeFiles/muduo_net.dir/Channel.cc.o.d"
+  "/root/repo/muduo/net/ConnectionContext.cc" "muduo/net/CMakeFiles/muduo_net.dir/ConnectionContext.cc.o" "gcc" "muduo/net/CMakeFiles/muduo_net.dir/ConnectionContext.cc.o.d"
+  "/root/repo/muduo/net/Connector.cc" "muduo/net/CMakeFiles/muduo_net.dir/Connector.cc.o" "gcc" "muduo/net/CMakeFiles/muduo_net.dir/Connector.cc.o.d"
+  "/root/repo/muduo/net/EventLoop.cc" "muduo/net/CMakeFiles/muduo_net.dir/EventLoop.cc.o" "gcc" "muduo/net/CMakeFiles/muduo_net.dir/EventLoop.cc.o.d"
+  "/root/repo/muduo/net/EventLoopThread.cc" "muduo/net/CMakeFiles/muduo_net.dir/EventLoopThread.cc.o" "gcc" "muduo/net/CMakeFiles/muduo_net.dir/EventLoopThread.cc.o.d"
+  "/root/repo/muduo/net/EventLoopThreadPool.cc" "muduo/net/CMakeFiles/muduo_net.dir/EventLoopThreadPool.cc.o" "gcc" "muduo/net/CMakeFiles/muduo_net.dir/EventLoopThreadPool.cc.o.d"
+  "/root/repo/muduo/net/IdleTimingWheel.cc" "muduo/net/CMakeFiles/muduo_net.dir/IdleTimingWheel.cc.o" "gcc" "muduo/net/CMakeFiles/muduo_net.dir/IdleTimingWheel.cc.o.d"
+  "/root/repo/muduo/net/InetAddress.cc" "muduo/net/CMakeFiles/muduo_net.dir/InetAddress.cc.o" "gcc" "muduo/net/CMakeFiles/muduo_net.dir/InetAddress.cc.o.d"
+  "/root/repo/muduo/net/Poller.cc" "muduo/net/CMakeFiles/muduo_net.dir/Poller.cc.o" "gcc" "muduo/net/CMakeFiles/muduo_net.dir/Poller.cc.o.d"
+  "/root/repo/muduo/net/Resolver.cc" "muduo/net/CMakeFiles/muduo_net.dir/Resolver.cc.o" "gcc" "muduo/net/CMakeFiles/muduo_net.dir/Resolver.cc.o.d"
+  "/root/repo/muduo/net/Socket.cc" "muduo/net/CMakeFiles/muduo_net.dir/Socket.cc.o" "gcc" "muduo/net/CMakeFiles/muduo_net.dir/Socket.cc.o.d"
+  "/root/repo/muduo/net/SocketsOps.cc" "muduo/net/CMakeFiles/muduo_net.dir/SocketsOps.cc.o" "gcc" "muduo/net/CMakeFiles/muduo_net.dir/SocketsOps.cc.o.d"
+  "/root/repo/muduo/net/TcpClient.cc" "muduo/net/CMakeFiles/muduo_net.dir/TcpClient.cc.o" "gcc" "muduo/net/CMakeFiles/muduo_net.dir/TcpClient.cc.o.d"
+  "/root/repo/muduo/net/TcpClientPool.cc" "muduo/net/CMakeFiles/muduo_net.dir/TcpClientPool.cc.o" "gcc" "muduo/net/CMakeFiles/muduo_net.dir/TcpClientPool.cc.o.d"
+  "/root/repo/muduo/net/TcpConnection.cc" "muduo/net/CMakeFiles/muduo_net.dir/TcpConnection.cc.o" "gcc" "muduo/net/CMakeFiles/muduo_net.dir/TcpConnection.cc.o.d"
+  "/root/repo/muduo/net/TcpServer.cc" "muduo/net/CMakeFiles/muduo_net.dir/TcpServer.cc.o" "gcc" "muduo/net/CMakeFiles/muduo_net.dir/TcpServer.cc.o.d"
+  "/root/repo/muduo/net/Timer.cc" "muduo/net/CMakeFiles/muduo_net.dir/Timer.cc.o" "gcc" "muduo/net/CMakeFiles/muduo_net.dir/Timer.cc.o.d"
+  "/root/repo/muduo/net/TimerQueue.cc" "muduo/net/CMakeFiles/muduo_net.dir/TimerQueue.cc.o" "gcc" "muduo/net/CMakeFiles/muduo_net.dir/TimerQueue.cc.o.d"
+  "/root/repo/muduo/net/poller/DefaultPoller.cc" "muduo/net/CMakeFiles/muduo_net.dir/poller/DefaultPoller.cc.o" "gcc" "muduo/net/CMakeFiles/muduo_net.dir/poller/DefaultPoller.cc.o.d"
+  "/root/repo/muduo/net/poller/EPollPoller.cc" "muduo/net/CMakeFiles/muduo_net.dir/poller/EPollPoller.cc.o" "gcc" "muduo/net/CMakeFiles/muduo_net.dir/poller/EPollPoller.cc.o.d"
+  "/root/repo/muduo/net/poller/PollPoller.cc" "muduo/net/CMakeFiles/muduo_net.dir/poller/PollPoller.cc.o" "gcc" "muduo/net/CMakeFiles/muduo_net.dir/poller/PollPoller.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/muduo/base/CMakeFiles/muduo_base.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
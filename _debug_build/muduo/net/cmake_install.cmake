@@ -0,0 +1,79 @@
+# Install script for directory: /root/repo/muduo/net
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "debug")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE STATIC_LIBRARY FILES "/root/repo/_debug_build/lib/libmuduo_net.a")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/muduo/net" TYPE FILE FILES
+    "/root/repo/muduo/net/Buffer.h"
+    "/root/repo/muduo/net/Callbacks.h"
+    "/root/repo/muduo/net/Channel.h"
+    "/root/repo/muduo/net/ConnectionContext.h"
+    "/root/repo/muduo/net/Endian.h"
+    "/root/repo/muduo/net/EventLoop.h"
+    "/root/repo/muduo/net/EventLoopThread.h"
+    "/root/repo/muduo/net/EventLoopThreadPool.h"
+    "/root/repo/muduo/net/InetAddress.h"
+    "/root/repo/muduo/net/Resolver.h"
+    "/root/repo/muduo/net/TcpClient.h"
+    "/root/repo/muduo/net/TcpClientPool.h"
+    "/root/repo/muduo/net/TcpConnection.h"
+    "/root/repo/muduo/net/TcpServer.h"
+    "/root/repo/muduo/net/TimerId.h"
+    )
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for each subdirectory.
+  include("/root/repo/_debug_build/muduo/net/http/cmake_install.cmake")
+  include("/root/repo/_debug_build/muduo/net/inspect/cmake_install.cmake")
+  include("/root/repo/_debug_build/muduo/net/coro/cmake_install.cmake")
+  include("/root/repo/_debug_build/muduo/net/tests/cmake_install.cmake")
+  include("/root/repo/_debug_build/muduo/net/protobuf/cmake_install.cmake")
+  include("/root/repo/_debug_build/muduo/net/protorpc/cmake_install.cmake")
+
+endif()
+
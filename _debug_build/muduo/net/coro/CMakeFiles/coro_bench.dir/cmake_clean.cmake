@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/coro_bench"
+  "../../../bin/coro_bench.pdb"
+  "CMakeFiles/coro_bench.dir/tests/Coro_bench.cc.o"
+  "CMakeFiles/coro_bench.dir/tests/Coro_bench.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/coro_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
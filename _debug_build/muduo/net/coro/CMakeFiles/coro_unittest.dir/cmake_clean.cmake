@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/coro_unittest"
+  "../../../bin/coro_unittest.pdb"
+  "CMakeFiles/coro_unittest.dir/tests/Coro_unittest.cc.o"
+  "CMakeFiles/coro_unittest.dir/tests/Coro_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/coro_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
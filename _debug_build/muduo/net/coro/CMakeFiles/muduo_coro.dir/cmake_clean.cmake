@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../lib/libmuduo_coro.a"
+  "../../../lib/libmuduo_coro.pdb"
+  "CMakeFiles/muduo_coro.dir/CoroStream.cc.o"
+  "CMakeFiles/muduo_coro.dir/CoroStream.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/muduo_coro.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
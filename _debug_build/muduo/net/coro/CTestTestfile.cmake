@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/muduo/net/coro
+# Build directory: /root/repo/_debug_build/muduo/net/coro
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(coro_unittest "/root/repo/_debug_build/bin/coro_unittest")
+set_tests_properties(coro_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/net/coro/CMakeLists.txt;22;add_test;/root/repo/muduo/net/coro/CMakeLists.txt;0;")
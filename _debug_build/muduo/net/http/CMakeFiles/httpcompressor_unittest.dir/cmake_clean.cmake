@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/httpcompressor_unittest"
+  "../../../bin/httpcompressor_unittest.pdb"
+  "CMakeFiles/httpcompressor_unittest.dir/tests/HttpCompressor_unittest.cc.o"
+  "CMakeFiles/httpcompressor_unittest.dir/tests/HttpCompressor_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/httpcompressor_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
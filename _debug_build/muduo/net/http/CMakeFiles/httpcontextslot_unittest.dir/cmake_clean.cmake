@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/httpcontextslot_unittest"
+  "../../../bin/httpcontextslot_unittest.pdb"
+  "CMakeFiles/httpcontextslot_unittest.dir/tests/HttpContextSlot_unittest.cc.o"
+  "CMakeFiles/httpcontextslot_unittest.dir/tests/HttpContextSlot_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/httpcontextslot_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/httppipeline_bench"
+  "../../../bin/httppipeline_bench.pdb"
+  "CMakeFiles/httppipeline_bench.dir/tests/HttpPipeline_bench.cc.o"
+  "CMakeFiles/httppipeline_bench.dir/tests/HttpPipeline_bench.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/httppipeline_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/httprequest_unittest"
+  "../../../bin/httprequest_unittest.pdb"
+  "CMakeFiles/httprequest_unittest.dir/tests/HttpRequest_unittest.cc.o"
+  "CMakeFiles/httprequest_unittest.dir/tests/HttpRequest_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/httprequest_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/httprouter_bench"
+  "../../../bin/httprouter_bench.pdb"
+  "CMakeFiles/httprouter_bench.dir/tests/HttpRouter_bench.cc.o"
+  "CMakeFiles/httprouter_bench.dir/tests/HttpRouter_bench.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/httprouter_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
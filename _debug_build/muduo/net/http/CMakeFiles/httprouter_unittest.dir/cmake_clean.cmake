@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/httprouter_unittest"
+  "../../../bin/httprouter_unittest.pdb"
+  "CMakeFiles/httprouter_unittest.dir/tests/HttpRouter_unittest.cc.o"
+  "CMakeFiles/httprouter_unittest.dir/tests/HttpRouter_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/httprouter_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
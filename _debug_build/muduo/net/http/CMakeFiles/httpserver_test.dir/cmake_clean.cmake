@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/httpserver_test"
+  "../../../bin/httpserver_test.pdb"
+  "CMakeFiles/httpserver_test.dir/tests/HttpServer_test.cc.o"
+  "CMakeFiles/httpserver_test.dir/tests/HttpServer_test.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/httpserver_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
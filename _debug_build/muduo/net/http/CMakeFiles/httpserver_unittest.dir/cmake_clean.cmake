@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/httpserver_unittest"
+  "../../../bin/httpserver_unittest.pdb"
+  "CMakeFiles/httpserver_unittest.dir/tests/HttpServer_unittest.cc.o"
+  "CMakeFiles/httpserver_unittest.dir/tests/HttpServer_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/httpserver_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
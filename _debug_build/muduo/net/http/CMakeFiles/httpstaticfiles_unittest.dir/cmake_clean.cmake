@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/httpstaticfiles_unittest"
+  "../../../bin/httpstaticfiles_unittest.pdb"
+  "CMakeFiles/httpstaticfiles_unittest.dir/tests/HttpStaticFiles_unittest.cc.o"
+  "CMakeFiles/httpstaticfiles_unittest.dir/tests/HttpStaticFiles_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/httpstaticfiles_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
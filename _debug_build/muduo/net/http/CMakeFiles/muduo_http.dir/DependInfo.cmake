@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/muduo/net/http/HttpCompressor.cc" "muduo/net/http/CMakeFiles/muduo_http.dir/HttpCompressor.cc.o" "gcc" "muduo/net/http/CMakeFiles/muduo_http.dir/HttpCompressor.cc.o.d"
+  "/root/repo/muduo/net/http/HttpContext.cc" "muduo/net/http/CMakeFiles/muduo_http.dir/HttpContext.cc.o" "gcc" "muduo/net/http/CMakeFiles/muduo_http.dir/HttpContext.cc.o.d"
+  "/root/repo/muduo/net/http/HttpResponse.cc" "muduo/net/http/CMakeFiles/muduo_http.dir/HttpResponse.cc.o" "gcc" "muduo/net/http/CMakeFiles/muduo_http.dir/HttpResponse.cc.o.d"
+  "/root/repo/muduo/net/http/HttpRouter.cc" "muduo/net/http/CMakeFiles/muduo_http.dir/HttpRouter.cc.o" "gcc" "muduo/net/http/CMakeFiles/muduo_http.dir/HttpRouter.cc.o.d"
+  "/root/repo/muduo/net/http/HttpServer.cc" "muduo/net/http/CMakeFiles/muduo_http.dir/HttpServer.cc.o" "gcc" "muduo/net/http/CMakeFiles/muduo_http.dir/HttpServer.cc.o.d"
+  "/root/repo/muduo/net/http/HttpStaticFiles.cc" "muduo/net/http/CMakeFiles/muduo_http.dir/HttpStaticFiles.cc.o" "gcc" "muduo/net/http/CMakeFiles/muduo_http.dir/HttpStaticFiles.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/muduo/net/CMakeFiles/muduo_net.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/muduo/base/CMakeFiles/muduo_base.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "../../../lib/libmuduo_http.a"
+  "../../../lib/libmuduo_http.pdb"
+  "CMakeFiles/muduo_http.dir/HttpCompressor.cc.o"
+  "CMakeFiles/muduo_http.dir/HttpCompressor.cc.o.d"
+  "CMakeFiles/muduo_http.dir/HttpContext.cc.o"
+  "CMakeFiles/muduo_http.dir/HttpContext.cc.o.d"
+  "CMakeFiles/muduo_http.dir/HttpResponse.cc.o"
+  "CMakeFiles/muduo_http.dir/HttpResponse.cc.o.d"
+  "CMakeFiles/muduo_http.dir/HttpRouter.cc.o"
+  "CMakeFiles/muduo_http.dir/HttpRouter.cc.o.d"
+  "CMakeFiles/muduo_http.dir/HttpServer.cc.o"
+  "CMakeFiles/muduo_http.dir/HttpServer.cc.o.d"
+  "CMakeFiles/muduo_http.dir/HttpStaticFiles.cc.o"
+  "CMakeFiles/muduo_http.dir/HttpStaticFiles.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/muduo_http.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
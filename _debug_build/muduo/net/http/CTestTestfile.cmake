@@ -0,0 +1,18 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/muduo/net/http
+# Build directory: /root/repo/_debug_build/muduo/net/http
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(httpcompressor_unittest "/root/repo/_debug_build/bin/httpcompressor_unittest")
+set_tests_properties(httpcompressor_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/net/http/CMakeLists.txt;48;add_test;/root/repo/muduo/net/http/CMakeLists.txt;0;")
+add_test(httpcontextslot_unittest "/root/repo/_debug_build/bin/httpcontextslot_unittest")
+set_tests_properties(httpcontextslot_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/net/http/CMakeLists.txt;53;add_test;/root/repo/muduo/net/http/CMakeLists.txt;0;")
+add_test(httprequest_unittest "/root/repo/_debug_build/bin/httprequest_unittest")
+set_tests_properties(httprequest_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/net/http/CMakeLists.txt;57;add_test;/root/repo/muduo/net/http/CMakeLists.txt;0;")
+add_test(httprouter_unittest "/root/repo/_debug_build/bin/httprouter_unittest")
+set_tests_properties(httprouter_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/net/http/CMakeLists.txt;61;add_test;/root/repo/muduo/net/http/CMakeLists.txt;0;")
+add_test(httpserver_unittest "/root/repo/_debug_build/bin/httpserver_unittest")
+set_tests_properties(httpserver_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/net/http/CMakeLists.txt;65;add_test;/root/repo/muduo/net/http/CMakeLists.txt;0;")
+add_test(httpstaticfiles_unittest "/root/repo/_debug_build/bin/httpstaticfiles_unittest")
+set_tests_properties(httpstaticfiles_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/net/http/CMakeLists.txt;69;add_test;/root/repo/muduo/net/http/CMakeLists.txt;0;")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../../lib/libmuduo_inspect.a"
+  "../../../lib/libmuduo_inspect.pdb"
+  "CMakeFiles/muduo_inspect.dir/Inspector.cc.o"
+  "CMakeFiles/muduo_inspect.dir/Inspector.cc.o.d"
+  "CMakeFiles/muduo_inspect.dir/PerformanceInspector.cc.o"
+  "CMakeFiles/muduo_inspect.dir/PerformanceInspector.cc.o.d"
+  "CMakeFiles/muduo_inspect.dir/ProcessInspector.cc.o"
+  "CMakeFiles/muduo_inspect.dir/ProcessInspector.cc.o.d"
+  "CMakeFiles/muduo_inspect.dir/SystemInspector.cc.o"
+  "CMakeFiles/muduo_inspect.dir/SystemInspector.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/muduo_inspect.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/muduo/net/inspect
+# Build directory: /root/repo/_debug_build/muduo/net/inspect
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
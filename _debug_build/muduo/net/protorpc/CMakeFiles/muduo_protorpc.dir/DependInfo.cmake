@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/muduo/net/protorpc/RpcChannel.cc" "muduo/net/protorpc/CMakeFiles/muduo_protorpc.dir/RpcChannel.cc.o" "gcc" "muduo/net/protorpc/CMakeFiles/muduo_protorpc.dir/RpcChannel.cc.o.d"
+  "/root/repo/muduo/net/protorpc/RpcServer.cc" "muduo/net/protorpc/CMakeFiles/muduo_protorpc.dir/RpcServer.cc.o" "gcc" "muduo/net/protorpc/CMakeFiles/muduo_protorpc.dir/RpcServer.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/muduo/net/protorpc/CMakeFiles/muduo_protorpc_wire.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/muduo/net/protobuf/CMakeFiles/muduo_protobuf_codec.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/muduo/net/CMakeFiles/muduo_net.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/muduo/base/CMakeFiles/muduo_base.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../../lib/libmuduo_protorpc_wire.a"
+  "../../../lib/libmuduo_protorpc_wire.pdb"
+  "CMakeFiles/muduo_protorpc_wire.dir/RpcCodec.cc.o"
+  "CMakeFiles/muduo_protorpc_wire.dir/RpcCodec.cc.o.d"
+  "CMakeFiles/muduo_protorpc_wire.dir/rpc.pb.cc.o"
+  "CMakeFiles/muduo_protorpc_wire.dir/rpc.pb.cc.o.d"
+  "rpc.pb.cc"
+  "rpc.pb.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/muduo_protorpc_wire.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/admissioncontrol_unittest"
+  "../../../bin/admissioncontrol_unittest.pdb"
+  "CMakeFiles/admissioncontrol_unittest.dir/AdmissionControl_unittest.cc.o"
+  "CMakeFiles/admissioncontrol_unittest.dir/AdmissionControl_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/admissioncontrol_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
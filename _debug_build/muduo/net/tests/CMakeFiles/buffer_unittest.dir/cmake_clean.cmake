@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/buffer_unittest"
+  "../../../bin/buffer_unittest.pdb"
+  "CMakeFiles/buffer_unittest.dir/Buffer_unittest.cc.o"
+  "CMakeFiles/buffer_unittest.dir/Buffer_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/buffer_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
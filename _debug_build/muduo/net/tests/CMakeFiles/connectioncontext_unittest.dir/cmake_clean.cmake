@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/connectioncontext_unittest"
+  "../../../bin/connectioncontext_unittest.pdb"
+  "CMakeFiles/connectioncontext_unittest.dir/ConnectionContext_unittest.cc.o"
+  "CMakeFiles/connectioncontext_unittest.dir/ConnectionContext_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/connectioncontext_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
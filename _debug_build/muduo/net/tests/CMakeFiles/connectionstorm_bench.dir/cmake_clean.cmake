@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/connectionstorm_bench"
+  "../../../bin/connectionstorm_bench.pdb"
+  "CMakeFiles/connectionstorm_bench.dir/ConnectionStorm_bench.cc.o"
+  "CMakeFiles/connectionstorm_bench.dir/ConnectionStorm_bench.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/connectionstorm_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/echoclient_unittest"
+  "../../../bin/echoclient_unittest.pdb"
+  "CMakeFiles/echoclient_unittest.dir/EchoClient_unittest.cc.o"
+  "CMakeFiles/echoclient_unittest.dir/EchoClient_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/echoclient_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/eventloopthread_unittest"
+  "../../../bin/eventloopthread_unittest.pdb"
+  "CMakeFiles/eventloopthread_unittest.dir/EventLoopThread_unittest.cc.o"
+  "CMakeFiles/eventloopthread_unittest.dir/EventLoopThread_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/eventloopthread_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
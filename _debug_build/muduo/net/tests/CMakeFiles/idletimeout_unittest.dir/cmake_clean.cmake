@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/idletimeout_unittest"
+  "../../../bin/idletimeout_unittest.pdb"
+  "CMakeFiles/idletimeout_unittest.dir/IdleTimeout_unittest.cc.o"
+  "CMakeFiles/idletimeout_unittest.dir/IdleTimeout_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/idletimeout_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
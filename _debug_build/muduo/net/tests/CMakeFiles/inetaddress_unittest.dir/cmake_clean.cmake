@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/inetaddress_unittest"
+  "../../../bin/inetaddress_unittest.pdb"
+  "CMakeFiles/inetaddress_unittest.dir/InetAddress_unittest.cc.o"
+  "CMakeFiles/inetaddress_unittest.dir/InetAddress_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/inetaddress_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
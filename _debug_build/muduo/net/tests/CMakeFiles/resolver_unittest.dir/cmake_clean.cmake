@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/resolver_unittest"
+  "../../../bin/resolver_unittest.pdb"
+  "CMakeFiles/resolver_unittest.dir/Resolver_unittest.cc.o"
+  "CMakeFiles/resolver_unittest.dir/Resolver_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/resolver_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/tcpclient_reg1"
+  "../../../bin/tcpclient_reg1.pdb"
+  "CMakeFiles/tcpclient_reg1.dir/TcpClient_reg1.cc.o"
+  "CMakeFiles/tcpclient_reg1.dir/TcpClient_reg1.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tcpclient_reg1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/tcpclient_reg3"
+  "../../../bin/tcpclient_reg3.pdb"
+  "CMakeFiles/tcpclient_reg3.dir/TcpClient_reg3.cc.o"
+  "CMakeFiles/tcpclient_reg3.dir/TcpClient_reg3.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tcpclient_reg3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
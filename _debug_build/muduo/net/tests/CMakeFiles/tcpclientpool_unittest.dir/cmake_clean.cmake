@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/tcpclientpool_unittest"
+  "../../../bin/tcpclientpool_unittest.pdb"
+  "CMakeFiles/tcpclientpool_unittest.dir/TcpClientPool_unittest.cc.o"
+  "CMakeFiles/tcpclientpool_unittest.dir/TcpClientPool_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tcpclientpool_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
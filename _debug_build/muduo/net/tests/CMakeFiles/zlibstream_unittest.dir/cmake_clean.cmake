@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/zlibstream_unittest"
+  "../../../bin/zlibstream_unittest.pdb"
+  "CMakeFiles/zlibstream_unittest.dir/ZlibStream_unittest.cc.o"
+  "CMakeFiles/zlibstream_unittest.dir/ZlibStream_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/zlibstream_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
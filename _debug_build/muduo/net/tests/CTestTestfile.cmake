@@ -0,0 +1,22 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/muduo/net/tests
+# Build directory: /root/repo/_debug_build/muduo/net/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(admissioncontrol_unittest "/root/repo/_debug_build/bin/admissioncontrol_unittest")
+set_tests_properties(admissioncontrol_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/net/tests/CMakeLists.txt;4;add_test;/root/repo/muduo/net/tests/CMakeLists.txt;0;")
+add_test(connectioncontext_unittest "/root/repo/_debug_build/bin/connectioncontext_unittest")
+set_tests_properties(connectioncontext_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/net/tests/CMakeLists.txt;13;add_test;/root/repo/muduo/net/tests/CMakeLists.txt;0;")
+add_test(buffer_unittest "/root/repo/_debug_build/bin/buffer_unittest")
+set_tests_properties(buffer_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/net/tests/CMakeLists.txt;37;add_test;/root/repo/muduo/net/tests/CMakeLists.txt;0;")
+add_test(inetaddress_unittest "/root/repo/_debug_build/bin/inetaddress_unittest")
+set_tests_properties(inetaddress_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/net/tests/CMakeLists.txt;41;add_test;/root/repo/muduo/net/tests/CMakeLists.txt;0;")
+add_test(idletimeout_unittest "/root/repo/_debug_build/bin/idletimeout_unittest")
+set_tests_properties(idletimeout_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/net/tests/CMakeLists.txt;54;add_test;/root/repo/muduo/net/tests/CMakeLists.txt;0;")
+add_test(resolver_unittest "/root/repo/_debug_build/bin/resolver_unittest")
+set_tests_properties(resolver_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/net/tests/CMakeLists.txt;60;add_test;/root/repo/muduo/net/tests/CMakeLists.txt;0;")
+add_test(tcpclientpool_unittest "/root/repo/_debug_build/bin/tcpclientpool_unittest")
+set_tests_properties(tcpclientpool_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/net/tests/CMakeLists.txt;75;add_test;/root/repo/muduo/net/tests/CMakeLists.txt;0;")
+add_test(timerqueue_unittest "/root/repo/_debug_build/bin/timerqueue_unittest")
+set_tests_properties(timerqueue_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/net/tests/CMakeLists.txt;80;add_test;/root/repo/muduo/net/tests/CMakeLists.txt;0;")
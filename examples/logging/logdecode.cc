@@ -0,0 +1,71 @@
+// Decodes log files written with LOG_BIN_*, text lines are kept as is.
+//
+// Usage: logdecode [-l] file...
+//   Pass all files of one process, in order, since a call site reached
+//   after a file was opened is described only in that file.
+//   -l prints times in local time, as given by /etc/localtime.
+
+#include "muduo/base/BinaryLogging.h"
+
+#include <string>
+#include <vector>
+
+#include <stdio.h>
+#include <string.h>
+
+bool readFile(const char* filename, std::string* content)
+{
+  FILE* fp = ::fopen(filename, "rb");
+  if (fp == NULL)
+  {
+    perror(filename);
+    return false;
+  }
+  char buf[64 * 1024];
+  size_t n;
+  while ((n = ::fread(buf, 1, sizeof buf, fp)) > 0)
+  {
+    content->append(buf, n);
+  }
+  ::fclose(fp);
+  return true;
+}
+
+int main(int argc, char* argv[])
+{
+  muduo::BinaryLogDecoder decoder;
+  int first = 1;
+  if (argc > 1 && strcmp(argv[1], "-l") == 0)
+  {
+    decoder.setTimeZone(muduo::TimeZone("/etc/localtime"));
+    ++first;
+  }
+  if (first >= argc)
+  {
+    fprintf(stderr, "Usage: %s [-l] file...\n", argv[0]);
+    return 1;
+  }
+
+  std::vector<std::string> contents(argc - first);
+  for (int i = first; i < argc; ++i)
+  {
+    std::string& content = contents[i - first];
+    if (!readFile(argv[i], &content))
+      return 1;
+    if (!decoder.addSites(content))
+      fprintf(stderr, "%s: corrupted site record\n", argv[i]);
+  }
+
+  int status = 0;
+  for (int i = first; i < argc; ++i)
+  {
+    muduo::string text;
+    if (!decoder.decode(contents[i - first], &text))
+    {
+      fprintf(stderr, "%s: corrupted, stopped after %zd bytes of text\n", argv[i], text.size());
+      status = 1;
+    }
+    fwrite(text.data(), 1, text.size(), stdout);
+  }
+  return status;
+}
@@ -159,7 +159,7 @@ class Procmon : noncopyable
     if (req.path() == "/")
     {
       resp->setContentType("text/html");
-      fillOverview(req.query());
+      fillOverview(req.query().as_string());
       resp->setBody(response_.retrieveAllAsString());
     }
     else if (req.path() == "/cmdline")
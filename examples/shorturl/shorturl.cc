@@ -22,18 +22,18 @@ void onRequest(const HttpRequest& req, HttpResponse* resp)
   LOG_INFO << "Headers " << req.methodString() << " " << req.path();
   if (!benchmark)
   {
-    const std::map<string, string>& headers = req.headers();
-    for (std::map<string, string>::const_iterator it = headers.begin();
+    const std::vector<HttpRequest::Header>& headers = req.headers();
+    for (std::vector<HttpRequest::Header>::const_iterator it = headers.begin();
         it != headers.end();
         ++it)
     {
-      LOG_DEBUG << it->first << ": " << it->second;
+      LOG_DEBUG << it->field << ": " << it->value;
     }
   }
 
   // TODO: support PUT and DELETE to create new redirections on-the-fly.
 
-  std::map<string, string>::const_iterator it = redirections.find(req.path());
+  std::map<string, string>::const_iterator it = redirections.find(req.path().as_string());
   if (it != redirections.end())
   {
     resp->setStatusCode(HttpResponse::k301MovedPermanently);
@@ -7,14 +7,137 @@
 #include "muduo/base/LogFile.h"
 #include "muduo/base/Timestamp.h"
 
+#include <algorithm>
+
 #include <stdio.h>
+#include <string.h>
 
 using namespace muduo;
 
+namespace muduo
+{
+namespace detail
+{
+
+// A byte ring filled by one thread without locking, and drained by
+// whoever holds the mutex of its AsyncLogging.
+class StagingBuffer : noncopyable
+{
+ public:
+  StagingBuffer(int64_t owner, size_t capacity)
+    : owner_(owner),
+      mask_(capacity - 1),
+      data_(new char[capacity]),
+      tail_(0),
+      cachedHead_(0),
+      head_(0),
+      retired_(false),
+      closed_(false)
+  {
+    assert((capacity & mask_) == 0);
+  }
+
+  int64_t owner() const { return owner_; }
+  size_t capacity() const { return mask_ + 1; }
+
+  // by the filling thread
+
+  bool tryAppend(const char* logline, size_t len)
+  {
+    const size_t tail = tail_.load(std::memory_order_relaxed);
+    if (len > capacity() - (tail - cachedHead_))
+    {
+      cachedHead_ = head_.load(std::memory_order_acquire);
+      if (len > capacity() - (tail - cachedHead_))
+        return false;
+    }
+    const size_t offset = tail & mask_;
+    const size_t first = std::min(len, capacity() - offset);
+    memcpy(&data_[offset], logline, first);
+    memcpy(&data_[0], logline + first, len - first);
+    tail_.store(tail + len, std::memory_order_release);
+    return true;
+  }
+
+  // the thread has exited, nothing more will be appended
+  void retire() { retired_.store(true, std::memory_order_release); }
+
+  // by the draining thread
+
+  bool retired() const { return retired_.load(std::memory_order_acquire); }
+
+  /// Contiguous readable bytes, up to the end of the ring.
+  size_t peek(const char** data) const
+  {
+    const size_t head = head_.load(std::memory_order_relaxed);
+    const size_t tail = tail_.load(std::memory_order_acquire);
+    const size_t offset = head & mask_;
+    *data = &data_[offset];
+    return std::min(tail - head, capacity() - offset);
+  }
+
+  void retrieve(size_t len)
+  {
+    head_.store(head_.load(std::memory_order_relaxed) + len, std::memory_order_release);
+  }
+
+  // the AsyncLogging has gone
+  void close() { closed_.store(true, std::memory_order_release); }
+  bool closed() const { return closed_.load(std::memory_order_acquire); }
+
+ private:
+  typedef char Padding[64];
+
+  const int64_t owner_;
+  const size_t mask_;
+  const std::unique_ptr<char[]> data_;
+  Padding pad0_;
+  std::atomic<size_t> tail_;
+  size_t cachedHead_;
+  Padding pad1_;
+  std::atomic<size_t> head_;
+  std::atomic<bool> retired_;
+  std::atomic<bool> closed_;
+};
+
+}  // namespace detail
+}  // namespace muduo
+
+namespace
+{
+
+std::atomic<int64_t> g_numCreated(0);
+
+// one staging buffer per thread, for the AsyncLogging it logs to first
+struct ThreadStaging
+{
+  ~ThreadStaging();
+
+  std::shared_ptr<detail::StagingBuffer> buffer;
+};
+
+thread_local ThreadStaging t_staging;
+// t_staging may not be touched after its destruction at thread exit
+__thread bool t_stagingDestroyed = false;
+
+ThreadStaging::~ThreadStaging()
+{
+  t_stagingDestroyed = true;
+  if (buffer)
+  {
+    buffer->retire();
+  }
+}
+
+}  // namespace
+
+const size_t AsyncLogging::kDefaultStagingSize;
+
 AsyncLogging::AsyncLogging(const string& basename,
                            off_t rollSize,
                            int flushInterval)
-  : flushInterval_(flushInterval),
+  : id_(++g_numCreated),
+    flushInterval_(flushInterval),
     running_(false),
     basename_(basename),
     rollSize_(rollSize),
@@ -24,16 +147,123 @@ AsyncLogging::AsyncLogging(const string& basename,
     cond_(mutex_),
     currentBuffer_(new Buffer),
     nextBuffer_(new Buffer),
-    buffers_()
+    buffers_(),
+    stagingSize_(kDefaultStagingSize),
+    useMmap_(false),
+    syncOnFlush_(false)
 {
   currentBuffer_->bzero();
   nextBuffer_->bzero();
   buffers_.reserve(16);
 }
 
+AsyncLogging::~AsyncLogging()
+{
+  if (running_)
+  {
+    stop();
+  }
+  muduo::MutexLockGuard lock(mutex_);
+  for (const auto& staging : stagingBuffers_)
+  {
+    staging->close();
+  }
+}
+
+void AsyncLogging::setStagingSize(size_t bytes)
+{
+  assert(!running_);
+  // a drained chunk must fit in a Buffer
+  bytes = std::min(bytes, static_cast<size_t>(detail::kLargeBuffer / 4));
+  stagingSize_ = 0;
+  if (bytes > 0)
+  {
+    stagingSize_ = 1;
+    while (stagingSize_ < bytes)
+      stagingSize_ <<= 1;
+  }
+}
+
 void AsyncLogging::append(const char* logline, int len)
 {
+  detail::StagingBuffer* staging = stagingBuffer();
+  if (staging && staging->tryAppend(logline, static_cast<size_t>(len)))
+  {
+    return;
+  }
+
+  muduo::MutexLockGuard lock(mutex_);
+  if (staging)
+  {
+    // hands over what is staged first, to keep the order of lines
+    drainLocked(staging);
+  }
+  appendLocked(logline, len);
+}
+
+detail::StagingBuffer* AsyncLogging::stagingBuffer()
+{
+  if (stagingSize_ == 0 || t_stagingDestroyed)
+  {
+    return NULL;
+  }
+
+  StagingBufferPtr& buffer = t_staging.buffer;
+  if (buffer && buffer->owner() == id_)
+  {
+    return buffer.get();
+  }
+  if (buffer && !buffer->closed())
+  {
+    // this thread logs to another AsyncLogging as well, takes the mutex here
+    return NULL;
+  }
+
+  if (buffer)
+  {
+    buffer->retire();
+  }
+  buffer.reset(new detail::StagingBuffer(id_, stagingSize_));
   muduo::MutexLockGuard lock(mutex_);
+  stagingBuffers_.push_back(buffer);
+  return buffer.get();
+}
+
+void AsyncLogging::drainLocked(detail::StagingBuffer* staging)
+{
+  // twice for a wrapped around ring
+  for (int i = 0; i < 2; ++i)
+  {
+    const char* data = NULL;
+    size_t len = staging->peek(&data);
+    if (len == 0)
+      break;
+    appendLocked(data, static_cast<int>(len));
+    staging->retrieve(len);
+  }
+}
+
+void AsyncLogging::collectLocked()
+{
+  auto it = stagingBuffers_.begin();
+  while (it != stagingBuffers_.end())
+  {
+    // checked before draining, so the last lines of the thread are seen
+    bool retired = (*it)->retired();
+    drainLocked(it->get());
+    if (retired)
+    {
+      it = stagingBuffers_.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
+  }
+}
+
+void AsyncLogging::appendLocked(const char* logline, int len)
+{
   if (currentBuffer_->avail() > len)
   {
     currentBuffer_->append(logline, len);
@@ -59,7 +289,8 @@ void AsyncLogging::threadFunc()
 {
   assert(running_ == true);
   latch_.countDown();
-  LogFile output(basename_, rollSize_, false);
+  LogFile output(basename_, rollSize_, false, flushInterval_, 1024, useMmap_, syncOnFlush_);
+  output.setRollCallback(rollCallback_);
   BufferPtr newBuffer1(new Buffer);
   BufferPtr newBuffer2(new Buffer);
   newBuffer1->bzero();
@@ -78,6 +309,7 @@ void AsyncLogging::threadFunc()
       {
         cond_.waitForSeconds(flushInterval_);
       }
+      collectLocked();
       buffers_.push_back(std::move(currentBuffer_));
       currentBuffer_ = std::move(newBuffer1);
       buffersToWrite.swap(buffers_);
@@ -131,6 +363,17 @@ void AsyncLogging::threadFunc()
     buffersToWrite.clear();
     output.flush();
   }
+
+  // what was appended before stop()
+  muduo::MutexLockGuard lock(mutex_);
+  collectLocked();
+  for (const auto& buffer : buffers_)
+  {
+    output.append(buffer->data(), buffer->length());
+  }
+  buffers_.clear();
+  output.append(currentBuffer_->data(), currentBuffer_->length());
+  currentBuffer_->reset();
   output.flush();
 }
 
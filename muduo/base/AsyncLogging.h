@@ -9,32 +9,59 @@
 #include "muduo/base/BlockingQueue.h"
 #include "muduo/base/BoundedBlockingQueue.h"
 #include "muduo/base/CountDownLatch.h"
+#include "muduo/base/LogFile.h"
 #include "muduo/base/Mutex.h"
 #include "muduo/base/Thread.h"
 #include "muduo/base/LogStream.h"
 
 #include <atomic>
+#include <memory>
 #include <vector>
 
 namespace muduo
 {
 
+namespace detail
+{
+class StagingBuffer;
+}  // namespace detail
+
+///
+/// Writes log lines to LogFile in a background thread.
+///
+/// Each thread that logs gets a staging buffer of its own, which it
+/// fills without locking.  The background thread collects them every
+/// flushInterval seconds, or the thread hands its buffer over when full.
+/// Lines of one thread keep their order, lines of different threads
+/// may be written out of timestamp order, by up to flushInterval seconds.
+///
 class AsyncLogging : noncopyable
 {
  public:
+  static const size_t kDefaultStagingSize = 64 * 1024;
 
   AsyncLogging(const string& basename,
                off_t rollSize,
                int flushInterval = 3);
 
-  ~AsyncLogging()
-  {
-    if (running_)
-    {
-      stop();
-    }
-  }
+  ~AsyncLogging();
+
+  /// Size of per-thread staging buffers, rounded up to a power of 2.
+  /// 0 makes every append() lock a mutex shared by all threads.
+  /// Must be called before @c start.
+  void setStagingSize(size_t bytes);
+
+  /// See LogFile::setRollCallback, called in the background thread.
+  /// Must be called before @c start.
+  void setRollCallback(LogFile::RollCallback cb) { rollCallback_ = std::move(cb); }
+
+  /// Writes through FileUtil::MmapAppendFile instead of stdio, and with
+  /// @c syncOnFlush waits for each flush to be on disk.
+  /// Must be called before @c start.
+  void setUseMmap(bool on, bool syncOnFlush = false)
+  { useMmap_ = on; syncOnFlush_ = syncOnFlush; }
 
+  /// Thread safe.
   void append(const char* logline, int len);
 
   void start()
@@ -54,11 +81,17 @@ class AsyncLogging : noncopyable
  private:
 
   void threadFunc();
+  detail::StagingBuffer* stagingBuffer();
+  void appendLocked(const char* logline, int len) REQUIRES(mutex_);
+  void drainLocked(detail::StagingBuffer* staging) REQUIRES(mutex_);
+  void collectLocked() REQUIRES(mutex_);
 
   typedef muduo::detail::FixedBuffer<muduo::detail::kLargeBuffer> Buffer;
   typedef std::vector<std::unique_ptr<Buffer>> BufferVector;
   typedef BufferVector::value_type BufferPtr;
+  typedef std::shared_ptr<detail::StagingBuffer> StagingBufferPtr;
 
+  const int64_t id_;
   const int flushInterval_;
   std::atomic<bool> running_;
   const string basename_;
@@ -70,6 +103,12 @@ class AsyncLogging : noncopyable
   BufferPtr currentBuffer_ GUARDED_BY(mutex_);
   BufferPtr nextBuffer_ GUARDED_BY(mutex_);
   BufferVector buffers_ GUARDED_BY(mutex_);
+  size_t stagingSize_;
+  LogFile::RollCallback rollCallback_;
+  bool useMmap_;
+  bool syncOnFlush_;
+  // also shared with the threads that fill them
+  std::vector<StagingBufferPtr> stagingBuffers_ GUARDED_BY(mutex_);
 };
 
 }  // namespace muduo
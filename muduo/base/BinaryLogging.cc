@@ -0,0 +1,346 @@
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+//
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+
+#include "muduo/base/BinaryLogging.h"
+
+#include "muduo/base/CurrentThread.h"
+#include "muduo/base/Timestamp.h"
+
+#include <atomic>
+
+#include <stdio.h>
+
+namespace muduo
+{
+// in Logging.cc
+extern Logger::OutputFunc g_output;
+extern const char* LogLevelName[Logger::NUM_LOG_LEVELS];
+}  // namespace muduo
+
+using namespace muduo;
+using namespace muduo::binlog;
+
+namespace
+{
+
+std::atomic<uint32_t> g_numSites(0);
+// the site reached last
+std::atomic<const BinaryLogSite*> g_lastSite(NULL);
+
+void putVarint(BinaryLogStream::Buffer* buffer, uint64_t v)
+{
+  char* end = encodeVarint(buffer->current(), v);
+  buffer->add(static_cast<size_t>(end - buffer->current()));
+}
+
+void putString(BinaryLogStream::Buffer* buffer, const char* str, size_t len)
+{
+  len = std::min(len, static_cast<size_t>(255));
+  putVarint(buffer, len);
+  buffer->append(str, len);
+}
+
+void writeHeader(BinaryLogStream::Buffer* buffer, RecordType type)
+{
+  *buffer->current() = static_cast<char>(type);
+  buffer->add(kHeaderLength);
+}
+
+// fills in the payload length
+void finishRecord(BinaryLogStream::Buffer* buffer)
+{
+  char* start = buffer->current() - buffer->length();
+  uint16_t length = static_cast<uint16_t>(buffer->length() - kHeaderLength);
+  memcpy(start + 1, &length, sizeof length);
+}
+
+class Reader
+{
+ public:
+  explicit Reader(StringPiece data)
+    : p_(data.data()),
+      end_(data.data() + data.size())
+  {
+  }
+
+  bool empty() const { return p_ == end_; }
+
+  bool getVarint(uint64_t* v)
+  {
+    *v = 0;
+    for (int shift = 0; shift < 64 && p_ < end_; shift += 7)
+    {
+      uint8_t byte = static_cast<uint8_t>(*p_++);
+      *v |= static_cast<uint64_t>(byte & 0x7f) << shift;
+      if ((byte & 0x80) == 0)
+        return true;
+    }
+    return false;
+  }
+
+  bool getBytes(void* out, size_t len)
+  {
+    if (static_cast<size_t>(end_ - p_) < len)
+      return false;
+    memcpy(out, p_, len);
+    p_ += len;
+    return true;
+  }
+
+  bool getString(StringPiece* str)
+  {
+    uint64_t len = 0;
+    if (!getVarint(&len) || static_cast<uint64_t>(end_ - p_) < len)
+      return false;
+    str->set(p_, static_cast<int>(len));
+    p_ += len;
+    return true;
+  }
+
+  bool getByte(uint8_t* byte)
+  {
+    return getBytes(byte, 1);
+  }
+
+ private:
+  const char* p_;
+  const char* end_;
+};
+
+// Calls @c onRecord(type, payload) for records, @c onText(line) for text lines.
+template<typename OnRecord, typename OnText>
+bool forEachRecord(StringPiece data, OnRecord onRecord, OnText onText)
+{
+  const char* p = data.data();
+  const char* end = p + data.size();
+  while (p < end)
+  {
+    uint8_t type = static_cast<uint8_t>(*p);
+    if (type == kSiteRecord || type == kEventRecord)
+    {
+      uint16_t length = 0;
+      if (end - p < kHeaderLength)
+        return false;
+      memcpy(&length, p + 1, sizeof length);
+      if (end - p - kHeaderLength < length)
+        return false;
+      if (!onRecord(type, StringPiece(p + kHeaderLength, length)))
+        return false;
+      p += kHeaderLength + length;
+    }
+    else
+    {
+      const char* eol = static_cast<const char*>(memchr(p, '\n', end - p));
+      const char* next = eol ? eol + 1 : end;
+      onText(StringPiece(p, static_cast<int>(next - p)));
+      p = next;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+BinaryLogSite::BinaryLogSite(Logger::SourceFile file, int line,
+                             Logger::LogLevel level, const char* func)
+  : id_(++g_numSites),
+    level_(level),
+    file_(file),
+    line_(line),
+    func_(func),
+    next_(g_lastSite.load())
+{
+  // for LOG_BIN_SYSERR
+  int savedErrno = errno;
+  BinaryLogStream::Buffer buffer;
+  record(&buffer);
+  g_output(buffer.data(), buffer.length());
+  while (!g_lastSite.compare_exchange_weak(next_, this))
+  {
+  }
+  errno = savedErrno;
+}
+
+string BinaryLogSite::allRecords()
+{
+  string records;
+  for (const BinaryLogSite* site = g_lastSite.load(); site != NULL; site = site->next_)
+  {
+    BinaryLogStream::Buffer buffer;
+    site->record(&buffer);
+    records.append(buffer.data(), buffer.length());
+  }
+  return records;
+}
+
+void BinaryLogSite::record(BinaryLogStream::Buffer* buffer) const
+{
+  writeHeader(buffer, kSiteRecord);
+  putVarint(buffer, id_);
+  char levelByte = static_cast<char>(level_);
+  buffer->append(&levelByte, 1);
+  putVarint(buffer, static_cast<uint64_t>(line_));
+  putString(buffer, file_.data_, static_cast<size_t>(file_.size_));
+  putString(buffer, func_, strlen(func_));
+  finishRecord(buffer);
+}
+
+BinaryLogger::BinaryLogger(const BinaryLogSite& site, int savedErrno)
+  : level_(site.level())
+{
+  BinaryLogStream::Buffer* buffer = &stream_.buffer();
+  writeHeader(buffer, kEventRecord);
+  putVarint(buffer, site.id());
+  int64_t now = Timestamp::now().microSecondsSinceEpoch();
+  buffer->append(reinterpret_cast<const char*>(&now), sizeof now);
+  putVarint(buffer, static_cast<uint64_t>(CurrentThread::tid()));
+  putVarint(buffer, static_cast<uint64_t>(savedErrno));
+}
+
+BinaryLogger::~BinaryLogger()
+{
+  BinaryLogStream::Buffer* buffer = &stream_.buffer();
+  finishRecord(buffer);
+  g_output(buffer->data(), buffer->length());
+}
+
+bool BinaryLogDecoder::addSites(StringPiece data)
+{
+  return forEachRecord(data,
+      [this](uint8_t type, StringPiece payload)
+      {
+        if (type != kSiteRecord)
+          return true;
+        Reader reader(payload);
+        uint64_t id = 0, line = 0;
+        uint8_t level = 0;
+        StringPiece file, func;
+        if (!reader.getVarint(&id) || !reader.getByte(&level) || !reader.getVarint(&line)
+            || !reader.getString(&file) || !reader.getString(&func)
+            || level >= Logger::NUM_LOG_LEVELS)
+          return false;
+        Site& site = sites_[static_cast<uint32_t>(id)];
+        site.level = static_cast<Logger::LogLevel>(level);
+        site.line = static_cast<int>(line);
+        site.file = file.as_string();
+        site.func = func.as_string();
+        return true;
+      },
+      [](StringPiece) {});
+}
+
+bool BinaryLogDecoder::decode(StringPiece data, string* out) const
+{
+  return forEachRecord(data,
+      [this, out](uint8_t type, StringPiece payload)
+      {
+        if (type != kEventRecord)
+          return true;
+        LogStream line;
+        bool ok = decodeEvent(payload, &line);
+        out->append(line.buffer().data(), line.buffer().length());
+        return ok;
+      },
+      [out](StringPiece text) { out->append(text.data(), text.size()); });
+}
+
+// the same text as Logger
+bool BinaryLogDecoder::decodeEvent(StringPiece payload, LogStream* line) const
+{
+  Reader reader(payload);
+  uint64_t id = 0, tid = 0, savedErrno = 0;
+  int64_t microSecondsSinceEpoch = 0;
+  if (!reader.getVarint(&id)
+      || !reader.getBytes(&microSecondsSinceEpoch, sizeof microSecondsSinceEpoch)
+      || !reader.getVarint(&tid) || !reader.getVarint(&savedErrno))
+    return false;
+
+  time_t seconds = static_cast<time_t>(microSecondsSinceEpoch / Timestamp::kMicroSecondsPerSecond);
+  int microseconds = static_cast<int>(microSecondsSinceEpoch % Timestamp::kMicroSecondsPerSecond);
+  struct tm tm_time;
+  if (timeZone_.valid())
+  {
+    tm_time = timeZone_.toLocalTime(seconds);
+  }
+  else
+  {
+    ::gmtime_r(&seconds, &tm_time);
+  }
+  char buf[64];
+  int len = snprintf(buf, sizeof buf, "%4d%02d%02d %02d:%02d:%02d.%06d%s%5d ",
+                     tm_time.tm_year + 1900, tm_time.tm_mon + 1, tm_time.tm_mday,
+                     tm_time.tm_hour, tm_time.tm_min, tm_time.tm_sec, microseconds,
+                     timeZone_.valid() ? " " : "Z ", static_cast<int>(tid));
+  line->append(buf, len);
+
+  std::map<uint32_t, Site>::const_iterator it = sites_.find(static_cast<uint32_t>(id));
+  const Site* site = it != sites_.end() ? &it->second : NULL;
+  line->append(site ? LogLevelName[site->level] : "?     ", 6);
+  if (savedErrno != 0)
+  {
+    *line << strerror_tl(static_cast<int>(savedErrno)) << " (errno=" << savedErrno << ") ";
+  }
+  if (site && site->level <= Logger::DEBUG)
+  {
+    *line << site->func << ' ';
+  }
+
+  bool ok = true;
+  while (ok && !reader.empty())
+  {
+    uint8_t tag = 0;
+    uint64_t v = 0;
+    reader.getByte(&tag);
+    switch (tag)
+    {
+      case kSigned:
+        ok = reader.getVarint(&v);
+        *line << static_cast<int64_t>((v >> 1) ^ (~(v & 1) + 1));
+        break;
+      case kUnsigned:
+        ok = reader.getVarint(&v);
+        *line << v;
+        break;
+      case kDouble:
+      {
+        double d = 0;
+        ok = reader.getBytes(&d, sizeof d);
+        *line << d;
+        break;
+      }
+      case kChar:
+        ok = reader.getVarint(&v);
+        *line << static_cast<char>(v);
+        break;
+      case kBool:
+        ok = reader.getVarint(&v);
+        *line << (v != 0);
+        break;
+      case kString:
+      {
+        StringPiece str;
+        ok = reader.getString(&str);
+        *line << str;
+        break;
+      }
+      case kPointer:
+        ok = reader.getVarint(&v);
+        *line << reinterpret_cast<const void*>(static_cast<uintptr_t>(v));
+        break;
+      default:
+        ok = false;
+    }
+  }
+
+  if (site)
+  {
+    *line << " - " << site->file << ':' << site->line << '\n';
+  }
+  else
+  {
+    *line << " - <unknown site " << id << ">\n";
+  }
+  return ok;
+}
@@ -0,0 +1,274 @@
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+//
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+
+#ifndef MUDUO_BASE_BINARYLOGGING_H
+#define MUDUO_BASE_BINARYLOGGING_H
+
+#include "muduo/base/Logging.h"
+#include "muduo/base/TimeZone.h"
+
+#include <algorithm>
+#include <map>
+
+#include <errno.h>
+
+namespace muduo
+{
+
+///
+/// Binary logging, for hot and verbose log statements.
+///
+///   LOG_BIN_TRACE << "read " << n << " bytes from fd " << fd;
+///
+/// is written as the id of its call site, a raw timestamp and the raw
+/// arguments, no formatting on the calling thread.  Each call site is
+/// described by a site record with its file, line, level and function
+/// when first reached, and LogFile describes all sites reached so far
+/// again at the start of each file.  Records go to Logger::setOutput()
+/// like text lines, and both can be mixed in one file.
+/// BinaryLogDecoder turns them into the same text as LOG_*.
+///
+/// Record: u8 type, u16 payload length, payload; host byte order.
+///   site:  varint id, u8 level, varint line, string file, string func
+///   event: varint site id, i64 microseconds since epoch, varint tid,
+///          varint errno, then tagged arguments
+/// Integers are varints, signed ones zigzag encoded,
+/// strings are a varint length and the bytes.
+///
+
+namespace binlog
+{
+enum RecordType
+{
+  kSiteRecord = 0xB1,
+  kEventRecord = 0xB2,
+};
+
+enum ArgumentTag
+{
+  kSigned = 1,
+  kUnsigned,
+  kDouble,
+  kChar,
+  kBool,
+  kString,
+  kPointer,
+};
+
+const int kHeaderLength = 3;
+
+inline char* encodeVarint(char* p, uint64_t v)
+{
+  while (v >= 0x80)
+  {
+    *p++ = static_cast<char>(v | 0x80);
+    v >>= 7;
+  }
+  *p++ = static_cast<char>(v);
+  return p;
+}
+
+inline uint64_t zigzag(int64_t v)
+{
+  return (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63);
+}
+}  // namespace binlog
+
+/// A LOG_BIN_* statement, constructed once.
+class BinaryLogSite : noncopyable
+{
+ public:
+  /// Outputs the site record.
+  BinaryLogSite(Logger::SourceFile file, int line, Logger::LogLevel level, const char* func);
+
+  uint32_t id() const { return id_; }
+  Logger::LogLevel level() const { return level_; }
+
+  /// Thread safe.
+  /// The site records of all sites reached so far.
+  static string allRecords();
+
+ private:
+  void record(detail::FixedBuffer<detail::kSmallBuffer>* buffer) const;
+
+  const uint32_t id_;
+  const Logger::LogLevel level_;
+  const Logger::SourceFile file_;
+  const int line_;
+  const char* const func_;
+  // the site reached before
+  const BinaryLogSite* next_;
+};
+
+class BinaryLogStream : noncopyable
+{
+  typedef BinaryLogStream self;
+ public:
+  typedef detail::FixedBuffer<detail::kSmallBuffer> Buffer;
+
+  self& operator<<(bool v) { return tagged(binlog::kBool, v ? 1 : 0); }
+  self& operator<<(char v) { return tagged(binlog::kChar, static_cast<unsigned char>(v)); }
+
+  self& operator<<(short v) { return signedInt(v); }
+  self& operator<<(int v) { return signedInt(v); }
+  self& operator<<(long v) { return signedInt(v); }
+  self& operator<<(long long v) { return signedInt(v); }
+  self& operator<<(unsigned short v) { return unsignedInt(v); }
+  self& operator<<(unsigned int v) { return unsignedInt(v); }
+  self& operator<<(unsigned long v) { return unsignedInt(v); }
+  self& operator<<(unsigned long long v) { return unsignedInt(v); }
+
+  self& operator<<(const void* p)
+  {
+    return tagged(binlog::kPointer, reinterpret_cast<uintptr_t>(p));
+  }
+
+  self& operator<<(float v) { return *this << static_cast<double>(v); }
+  self& operator<<(double v)
+  {
+    if (buffer_.avail() > kMaxArgumentSize)
+    {
+      char* p = buffer_.current();
+      *p++ = static_cast<char>(binlog::kDouble);
+      memcpy(p, &v, sizeof v);
+      buffer_.add(1 + sizeof v);
+    }
+    return *this;
+  }
+
+  self& operator<<(const char* str)
+  {
+    return str ? appendString(str, strlen(str)) : appendString("(null)", 6);
+  }
+  self& operator<<(const unsigned char* str)
+  {
+    return operator<<(reinterpret_cast<const char*>(str));
+  }
+  self& operator<<(const string& v) { return appendString(v.data(), v.size()); }
+  self& operator<<(const StringPiece& v) { return appendString(v.data(), v.size()); }
+
+  const Buffer& buffer() const { return buffer_; }
+  Buffer& buffer() { return buffer_; }
+
+ private:
+  // a tag and a varint
+  static const int kMaxArgumentSize = 11;
+
+  template<typename T>
+  self& signedInt(T v) { return tagged(binlog::kSigned, binlog::zigzag(v)); }
+
+  template<typename T>
+  self& unsignedInt(T v) { return tagged(binlog::kUnsigned, v); }
+
+  self& tagged(binlog::ArgumentTag tag, uint64_t v)
+  {
+    if (buffer_.avail() > kMaxArgumentSize)
+    {
+      char* p = buffer_.current();
+      *p++ = static_cast<char>(tag);
+      char* end = binlog::encodeVarint(p, v);
+      buffer_.add(static_cast<size_t>(end - p + 1));
+    }
+    return *this;
+  }
+
+  // truncated to what fits
+  self& appendString(const char* data, size_t len)
+  {
+    if (buffer_.avail() > kMaxArgumentSize)
+    {
+      len = std::min(len, static_cast<size_t>(buffer_.avail() - kMaxArgumentSize - 1));
+      char* p = buffer_.current();
+      *p++ = static_cast<char>(binlog::kString);
+      char* end = binlog::encodeVarint(p, len);
+      memcpy(end, data, len);
+      buffer_.add(static_cast<size_t>(end - p + 1) + len);
+    }
+    return *this;
+  }
+
+  Buffer buffer_;
+};
+
+class BinaryLogger : noncopyable
+{
+ public:
+  BinaryLogger(const BinaryLogSite& site, int savedErrno = 0);
+  ~BinaryLogger();
+
+  BinaryLogStream& stream() { return stream_; }
+
+ private:
+  BinaryLogStream stream_;
+  const Logger::LogLevel level_;
+};
+
+///
+/// Turns binary log records back into text, text lines are kept as is.
+///
+/// Each file describes the sites reached before it was opened, others are
+/// described when first reached, and the lines of other threads may come
+/// before that, so feed a whole file to addSites() before decoding it.
+///
+class BinaryLogDecoder : noncopyable
+{
+ public:
+  /// Local time of @c tz instead of UTC.
+  void setTimeZone(const TimeZone& tz) { timeZone_ = tz; }
+
+  /// Learns the site records in @c data.  Returns false if corrupted.
+  bool addSites(StringPiece data);
+
+  /// Appends @c data as text to @c out.
+  /// Returns false if corrupted, what was decoded is kept.
+  bool decode(StringPiece data, string* out) const;
+
+ private:
+  struct Site
+  {
+    Logger::LogLevel level;
+    int line;
+    string file;
+    string func;
+  };
+
+  bool decodeEvent(StringPiece payload, LogStream* line) const;
+
+  std::map<uint32_t, Site> sites_;
+  TimeZone timeZone_;
+};
+
+#define MUDUO_BINARY_LOG_SITE(level) \
+  [](const char* func) -> const muduo::BinaryLogSite& { \
+    static const muduo::BinaryLogSite site(__FILE__, __LINE__, level, func); \
+    return site; }(__func__)
+
+// Same caution as LOG_*, do not use in an unbraced if-else.
+#define LOG_BIN_TRACE if (MUDUO_LOG_ENABLED(TRACE)) \
+  muduo::BinaryLogger(MUDUO_BINARY_LOG_SITE(muduo::Logger::TRACE)).stream()
+#define LOG_BIN_DEBUG if (MUDUO_LOG_ENABLED(DEBUG)) \
+  muduo::BinaryLogger(MUDUO_BINARY_LOG_SITE(muduo::Logger::DEBUG)).stream()
+#define LOG_BIN_INFO if (MUDUO_LOG_ENABLED(INFO)) \
+  muduo::BinaryLogger(MUDUO_BINARY_LOG_SITE(muduo::Logger::INFO)).stream()
+#if MUDUO_MIN_LOG_LEVEL <= 3
+#define LOG_BIN_WARN muduo::BinaryLogger(MUDUO_BINARY_LOG_SITE(muduo::Logger::WARN)).stream()
+#else
+#define LOG_BIN_WARN while (false) \
+  muduo::BinaryLogger(MUDUO_BINARY_LOG_SITE(muduo::Logger::WARN)).stream()
+#endif
+#if MUDUO_MIN_LOG_LEVEL <= 4
+#define LOG_BIN_ERROR muduo::BinaryLogger(MUDUO_BINARY_LOG_SITE(muduo::Logger::ERROR)).stream()
+#define LOG_BIN_SYSERR \
+  muduo::BinaryLogger(MUDUO_BINARY_LOG_SITE(muduo::Logger::ERROR), errno).stream()
+#else
+#define LOG_BIN_ERROR while (false) \
+  muduo::BinaryLogger(MUDUO_BINARY_LOG_SITE(muduo::Logger::ERROR)).stream()
+#define LOG_BIN_SYSERR while (false) \
+  muduo::BinaryLogger(MUDUO_BINARY_LOG_SITE(muduo::Logger::ERROR), errno).stream()
+#endif
+
+}  // namespace muduo
+
+#endif  // MUDUO_BASE_BINARYLOGGING_H
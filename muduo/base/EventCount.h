@@ -0,0 +1,102 @@
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+//
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+
+#ifndef MUDUO_BASE_EVENTCOUNT_H
+#define MUDUO_BASE_EVENTCOUNT_H
+
+#include "muduo/base/noncopyable.h"
+
+#include <atomic>
+
+#include <limits.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace muduo
+{
+
+///
+/// Lets threads sleep until a lock-free condition may have changed,
+/// the Condition of code that has no mutex.  Built on a futex.
+///
+/// Waiter:
+///   while (!ready())
+///   {
+///     int key = ec.prepareWait();
+///     if (ready())
+///     {
+///       ec.cancelWait();
+///       break;
+///     }
+///     ec.wait(key);
+///   }
+///
+/// Notifier, after making ready() true:
+///   ec.notify();
+///
+/// notify() is only a fence and a load when nobody waits.
+///
+class EventCount : noncopyable
+{
+ public:
+  EventCount()
+    : epoch_(0),
+      waiters_(0)
+  {
+  }
+
+  int prepareWait()
+  {
+    int key = epoch_.load();
+    waiters_.fetch_add(1);
+    return key;
+  }
+
+  void cancelWait()
+  {
+    waiters_.fetch_sub(1);
+  }
+
+  /// Returns at once if notify() was called after prepareWait().
+  /// May wake up spuriously.
+  void wait(int key)
+  {
+    ::syscall(SYS_futex, reinterpret_cast<int*>(&epoch_), FUTEX_WAIT_PRIVATE,
+              key, NULL, NULL, 0);
+    waiters_.fetch_sub(1);
+  }
+
+  /// Returns the number of threads woken up.
+  int notify(int n = 1)
+  {
+    // orders the caller's stores before the load of waiters_,
+    // pairs with the fetch_add in prepareWait()
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiters_.load(std::memory_order_relaxed) > 0)
+    {
+      epoch_.fetch_add(1);
+      long woken = ::syscall(SYS_futex, reinterpret_cast<int*>(&epoch_), FUTEX_WAKE_PRIVATE,
+                             n, NULL, NULL, 0);
+      return woken > 0 ? static_cast<int>(woken) : 0;
+    }
+    return 0;
+  }
+
+  int notifyAll()
+  {
+    return notify(INT_MAX);
+  }
+
+ private:
+  static_assert(sizeof(std::atomic<int>) == sizeof(int), "futex word must be an int");
+
+  std::atomic<int> epoch_;
+  std::atomic<int> waiters_;
+};
+
+}  // namespace muduo
+
+#endif  // MUDUO_BASE_EVENTCOUNT_H
@@ -6,10 +6,14 @@
 #include "muduo/base/FileUtil.h"
 #include "muduo/base/Logging.h"
 
+#include <algorithm>
+
 #include <assert.h>
 #include <errno.h>
 #include <fcntl.h>
 #include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
 
@@ -49,7 +53,7 @@ void FileUtil::AppendFile::append(const char* logline, const size_t len)
     remain = len - n; // remain -= x
   }
 
-  writtenBytes_ += len;
+  writtenBytes_ += n;
 }
 
 void FileUtil::AppendFile::flush()                                                                      // 使用fflush刷新缓冲区
@@ -179,3 +183,138 @@ template int FileUtil::ReadSmallFile::readToString(
     string* content,
     int64_t*, int64_t*, int64_t*);
 
+
+namespace
+{
+const off_t kPageSize = ::sysconf(_SC_PAGESIZE);
+}  // namespace
+
+FileUtil::MmapAppendFile::MmapAppendFile(StringArg filename, bool syncOnFlush)
+  : filename_(filename.c_str()),
+    fd_(::open(filename.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644)),
+    syncOnFlush_(syncOnFlush),
+    chunk_(NULL),
+    chunkOffset_(0),
+    chunkUsed_(0),
+    chunkFlushed_(0),
+    fileSize_(0),
+    writtenBytes_(0)
+{
+  assert(fd_ >= 0);
+  struct stat st;
+  if (::fstat(fd_, &st) == 0)
+  {
+    fileSize_ = st.st_size;                                                                             // 追加到已有内容之后
+  }
+}
+
+FileUtil::MmapAppendFile::~MmapAppendFile()
+{
+  if (fallback_)
+  {
+    // truncated already, when falling back
+    fallback_.reset();
+  }
+  else
+  {
+    unmapChunk();
+    if (::ftruncate(fd_, fileSize_) != 0)                                                               // 去掉预分配但没有写的部分
+    {
+      fprintf(stderr, "MmapAppendFile: ftruncate failed %s\n", strerror_tl(errno));
+    }
+  }
+  ::close(fd_);
+}
+
+void FileUtil::MmapAppendFile::append(const char* logline, size_t len)
+{
+  while (len > 0 && !fallback_)
+  {
+    if (chunk_ == NULL || chunkUsed_ == kChunkSize)
+    {
+      unmapChunk();
+      if (!mapChunk())
+      {
+        fallBack();
+        break;
+      }
+    }
+    size_t n = std::min(len, kChunkSize - chunkUsed_);
+    memcpy(chunk_ + chunkUsed_, logline, n);
+    chunkUsed_ += n;
+    fileSize_ += n;
+    writtenBytes_ += n;
+    logline += n;
+    len -= n;
+  }
+  if (fallback_ && len > 0)
+  {
+    off_t before = fallback_->writtenBytes();
+    fallback_->append(logline, len);
+    writtenBytes_ += fallback_->writtenBytes() - before;
+  }
+}
+
+void FileUtil::MmapAppendFile::flush()
+{
+  if (fallback_)
+  {
+    fallback_->flush();
+    if (syncOnFlush_)
+    {
+      ::fdatasync(fd_);
+    }
+  }
+  else if (chunk_ != NULL && chunkUsed_ > chunkFlushed_)
+  {
+    size_t start = chunkFlushed_ & ~static_cast<size_t>(kPageSize - 1);
+    ::msync(chunk_ + start, chunkUsed_ - start, syncOnFlush_ ? MS_SYNC : MS_ASYNC);
+    chunkFlushed_ = chunkUsed_;
+  }
+}
+
+// No space, or no fallocate, write(2) through stdio rather than risk
+// SIGBUS, and don't try fallocate again for every line.
+void FileUtil::MmapAppendFile::fallBack()
+{
+  fprintf(stderr, "MmapAppendFile: %s falls back to stdio, fallocate failed %s\n",
+          filename_.c_str(), strerror_tl(errno));
+  if (::ftruncate(fd_, fileSize_) != 0)                                                                 // 让AppendFile接着已写的内容追加
+  {
+    fprintf(stderr, "MmapAppendFile: ftruncate failed %s\n", strerror_tl(errno));
+  }
+  fallback_.reset(new AppendFile(filename_));
+}
+
+// maps [fileSize_ rounded down to a page, + kChunkSize), allocated on disk
+bool FileUtil::MmapAppendFile::mapChunk()
+{
+  assert(chunk_ == NULL);
+  chunkOffset_ = fileSize_ & ~(kPageSize - 1);
+  if (::fallocate(fd_, 0, chunkOffset_, kChunkSize) != 0)
+  {
+    return false;
+  }
+  void* p = ::mmap(NULL, kChunkSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, chunkOffset_);
+  if (p == MAP_FAILED)
+  {
+    fprintf(stderr, "MmapAppendFile: mmap failed %s\n", strerror_tl(errno));
+    return false;
+  }
+  ::madvise(p, kChunkSize, MADV_SEQUENTIAL);
+  chunk_ = static_cast<char*>(p);
+  chunkUsed_ = static_cast<size_t>(fileSize_ - chunkOffset_);
+  chunkFlushed_ = chunkUsed_;
+  return true;
+}
+
+void FileUtil::MmapAppendFile::unmapChunk()
+{
+  if (chunk_ != NULL)
+  {
+    // dirty pages are written back by the kernel after munmap anyway
+    ::msync(chunk_, chunkUsed_, syncOnFlush_ ? MS_SYNC : MS_ASYNC);
+    ::munmap(chunk_, kChunkSize);
+    chunk_ = NULL;
+  }
+}
@@ -10,6 +10,9 @@
 
 #include "muduo/base/noncopyable.h"
 #include "muduo/base/StringPiece.h"
+
+#include <memory>
+
 #include <sys/types.h>  // for off_t
 
 namespace muduo
@@ -82,6 +85,49 @@ class AppendFile : noncopyable
   off_t writtenBytes_;                                                              // 记录已向日志文件中写入的字节数
 };
 
+// not thread safe
+///
+/// Appends by copying into a shared mapping of the file, no write(2) and
+/// no stdio buffer.  The file is extended and mapped kChunkSize at a time,
+/// and truncated to what was written when closed; after a crash it may end
+/// with up to kChunkSize of NUL bytes.  If a chunk can't be allocated, the
+/// file system has no fallocate or is full, the rest of the file is
+/// written through AppendFile.
+///
+class MmapAppendFile : noncopyable
+{
+ public:
+  static const size_t kChunkSize = 4 * 1024 * 1024;
+
+  /// flush() waits for the written pages to be on disk if @c syncOnFlush,
+  /// otherwise it only starts writing them back.
+  explicit MmapAppendFile(StringArg filename, bool syncOnFlush = false);
+
+  ~MmapAppendFile();
+
+  void append(const char* logline, size_t len);
+
+  void flush();
+
+  off_t writtenBytes() const { return writtenBytes_; }
+
+ private:
+  bool mapChunk();
+  void unmapChunk();
+  void fallBack();
+
+  const string filename_;
+  int fd_;
+  const bool syncOnFlush_;
+  char* chunk_;
+  off_t chunkOffset_;                                                               // 映射区在文件中的偏移
+  size_t chunkUsed_;
+  size_t chunkFlushed_;                                                             // 映射区中已经flush的字节数
+  off_t fileSize_;                                                                  // 实际写入的文件长度
+  off_t writtenBytes_;
+  std::unique_ptr<AppendFile> fallback_;                                            // 分配不了映射区之后代替它
+};
+
 }  // namespace FileUtil
 }  // namespace muduo
 
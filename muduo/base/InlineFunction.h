@@ -0,0 +1,240 @@
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+//
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+//
+// This is a public header file, it must only include public header files.
+
+#ifndef MUDUO_BASE_INLINEFUNCTION_H
+#define MUDUO_BASE_INLINEFUNCTION_H
+
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <assert.h>
+#include <stddef.h>
+
+namespace muduo
+{
+
+namespace detail
+{
+// an empty function pointer or std::function makes an empty InlineFunction,
+// as they do with std::function
+
+template<typename F>
+bool isEmptyCallable(const F&) { return false; }
+
+template<typename R, typename... Args>
+bool isEmptyCallable(R (*f)(Args...)) { return f == NULL; }
+
+template<typename R, typename C>
+bool isEmptyCallable(R C::*f) { return f == NULL; }
+
+template<typename Signature>
+bool isEmptyCallable(const std::function<Signature>& f) { return !f; }
+}  // namespace detail
+
+template<typename Signature, size_t kInlineSize = 64>
+class InlineFunction;
+
+///
+/// A move-only std::function that keeps callables of up to
+/// @c kInlineSize bytes in the object itself, without touching the heap.
+/// The default fits a member function pointer plus a shared_ptr and
+/// a string, what most EventLoop::runInLoop() posts bind.
+/// Bigger callables, or those whose move may throw, go to the heap.
+///
+/// Being move-only, it also takes callables that are, like lambdas
+/// capturing a unique_ptr.
+///
+template<typename R, typename... Args, size_t kInlineSize>
+class InlineFunction<R (Args...), kInlineSize>
+{
+ public:
+  InlineFunction() noexcept
+    : ops_(NULL)
+  {
+  }
+
+  InlineFunction(std::nullptr_t) noexcept
+    : ops_(NULL)
+  {
+  }
+
+  template<typename F,
+           typename = typename std::enable_if<
+               !std::is_same<typename std::decay<F>::type, InlineFunction>::value>::type>
+  InlineFunction(F&& f)
+    : ops_(NULL)
+  {
+    typedef typename std::decay<F>::type Callable;
+    if (!detail::isEmptyCallable(f))
+    {
+      init<Callable>(std::forward<F>(f), std::integral_constant<bool, fitsInline<Callable>()>());
+    }
+  }
+
+  InlineFunction(InlineFunction&& rhs) noexcept
+    : ops_(rhs.ops_)
+  {
+    if (ops_)
+    {
+      ops_->relocate(&storage_, &rhs.storage_);
+      rhs.ops_ = NULL;
+    }
+  }
+
+  InlineFunction& operator=(InlineFunction&& rhs) noexcept
+  {
+    if (this != &rhs)
+    {
+      reset();
+      if (rhs.ops_)
+      {
+        rhs.ops_->relocate(&storage_, &rhs.storage_);
+        ops_ = rhs.ops_;
+        rhs.ops_ = NULL;
+      }
+    }
+    return *this;
+  }
+
+  InlineFunction& operator=(std::nullptr_t) noexcept
+  {
+    reset();
+    return *this;
+  }
+
+  InlineFunction(const InlineFunction&) = delete;
+  InlineFunction& operator=(const InlineFunction&) = delete;
+
+  ~InlineFunction()
+  {
+    reset();
+  }
+
+  void swap(InlineFunction& rhs) noexcept
+  {
+    InlineFunction tmp(std::move(rhs));
+    rhs = std::move(*this);
+    *this = std::move(tmp);
+  }
+
+  explicit operator bool() const noexcept { return ops_ != NULL; }
+
+  /// Like std::function, calls the callable even if it is not const.
+  R operator()(Args... args) const
+  {
+    assert(ops_ != NULL);
+    return ops_->invoke(const_cast<Storage*>(&storage_), std::forward<Args>(args)...);
+  }
+
+ private:
+  typedef typename std::aligned_storage<kInlineSize, alignof(void*)>::type Storage;
+
+  struct Ops
+  {
+    R (*invoke)(void* storage, Args&&... args);
+    // move constructs into @c to and destroys @c from
+    void (*relocate)(void* to, void* from);
+    void (*destroy)(void* storage);
+  };
+
+  template<typename F>
+  static constexpr bool fitsInline()
+  {
+    return sizeof(F) <= sizeof(Storage)
+        && alignof(Storage) % alignof(F) == 0
+        && std::is_nothrow_move_constructible<F>::value;
+  }
+
+  template<typename F>
+  struct InlineOps
+  {
+    static F* get(void* storage) { return static_cast<F*>(storage); }
+
+    static R invoke(void* storage, Args&&... args)
+    {
+      return (*get(storage))(std::forward<Args>(args)...);
+    }
+
+    static void relocate(void* to, void* from)
+    {
+      new (to) F(std::move(*get(from)));
+      get(from)->~F();
+    }
+
+    static void destroy(void* storage)
+    {
+      get(storage)->~F();
+    }
+
+    static const Ops* ops()
+    {
+      static const Ops kOps = { &invoke, &relocate, &destroy };
+      return &kOps;
+    }
+  };
+
+  // the storage holds an owning F*
+  template<typename F>
+  struct HeapOps
+  {
+    static F*& get(void* storage) { return *static_cast<F**>(storage); }
+
+    static R invoke(void* storage, Args&&... args)
+    {
+      return (*get(storage))(std::forward<Args>(args)...);
+    }
+
+    static void relocate(void* to, void* from)
+    {
+      new (to) F*(get(from));
+    }
+
+    static void destroy(void* storage)
+    {
+      delete get(storage);
+    }
+
+    static const Ops* ops()
+    {
+      static const Ops kOps = { &invoke, &relocate, &destroy };
+      return &kOps;
+    }
+  };
+
+  template<typename F, typename G>
+  void init(G&& f, std::true_type /* inline */)
+  {
+    new (&storage_) F(std::forward<G>(f));
+    ops_ = InlineOps<F>::ops();
+  }
+
+  template<typename F, typename G>
+  void init(G&& f, std::false_type /* inline */)
+  {
+    new (&storage_) F*(new F(std::forward<G>(f)));
+    ops_ = HeapOps<F>::ops();
+  }
+
+  void reset() noexcept
+  {
+    if (ops_)
+    {
+      const Ops* ops = ops_;
+      ops_ = NULL;
+      ops->destroy(&storage_);
+    }
+  }
+
+  Storage storage_;
+  const Ops* ops_;
+};
+
+}  // namespace muduo
+
+#endif  // MUDUO_BASE_INLINEFUNCTION_H
@@ -0,0 +1,193 @@
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+//
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+
+#include "muduo/base/LogCompressor.h"
+
+#include "muduo/base/CurrentThread.h"
+#include "muduo/base/GzipFile.h"
+#include "muduo/base/Logging.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <ctype.h>
+#include <dirent.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+using namespace muduo;
+
+namespace
+{
+
+const char kSuffix[] = ".log.gz";
+
+// linux/ioprio.h
+const int kIoprioWhoProcess = 1;
+const int kIoprioClassIdle = 3;
+const int kIoprioClassShift = 13;
+
+// a compressed file of basename, named by LogFile::getLogFileName
+bool isArchive(const string& basename, const char* name)
+{
+  size_t len = strlen(name);
+  return len > basename.size() + 1 + sizeof kSuffix
+      && memcmp(name, basename.data(), basename.size()) == 0
+      && name[basename.size()] == '.'
+      && isdigit(static_cast<unsigned char>(name[basename.size() + 1]))
+      && strcmp(name + len - (sizeof kSuffix - 1), kSuffix) == 0;
+}
+
+}  // namespace
+
+LogCompressor::LogCompressor(const string& basename, int maxFiles, off_t maxBytes)
+  : basename_(basename),
+    maxFiles_(maxFiles),
+    maxBytes_(maxBytes),
+    running_(false),
+    compressed_(0),
+    thread_(std::bind(&LogCompressor::threadFunc, this), "LogCompressor")
+{
+}
+
+LogCompressor::~LogCompressor()
+{
+  if (running_)
+  {
+    stop();
+  }
+}
+
+void LogCompressor::start()
+{
+  assert(!running_);
+  running_ = true;
+  thread_.start();
+}
+
+void LogCompressor::stop()
+{
+  assert(running_);
+  running_ = false;
+  queue_.put(string());
+  thread_.join();
+}
+
+void LogCompressor::add(const string& filename)
+{
+  assert(!filename.empty());
+  queue_.put(filename);
+}
+
+void LogCompressor::threadFunc()
+{
+  // nice 19 and idle I/O, for this thread only, failures don't matter
+  ::setpriority(PRIO_PROCESS, static_cast<id_t>(CurrentThread::tid()), 19);
+  ::syscall(SYS_ioprio_set, kIoprioWhoProcess, CurrentThread::tid(),
+            kIoprioClassIdle << kIoprioClassShift);
+
+  for (;;)
+  {
+    string filename = queue_.take();
+    if (filename.empty())
+    {
+      break;
+    }
+    if (compress(filename))
+    {
+      ++compressed_;
+    }
+    removeOld();
+  }
+}
+
+// filename.gz, then removes filename
+bool LogCompressor::compress(const string& filename)
+{
+  FILE* in = ::fopen(filename.c_str(), "rbe");
+  if (in == NULL)
+  {
+    fprintf(stderr, "LogCompressor: cannot open %s: %s\n", filename.c_str(), strerror_tl(errno));
+    return false;
+  }
+
+  string gzname = filename + ".gz";
+  bool ok = false;
+  {
+    GzipFile out = GzipFile::openForWriteTruncate(gzname);
+    if (out.valid())
+    {
+      char buf[64 * 1024];
+      size_t n = 0;
+      ok = true;
+      while (ok && (n = ::fread(buf, 1, sizeof buf, in)) > 0)
+      {
+        ok = out.write(StringPiece(buf, static_cast<int>(n))) == static_cast<int>(n);
+      }
+      ok = ok && !::ferror(in);
+    }
+  }
+  ::fclose(in);
+
+  if (ok)
+  {
+    ::unlink(filename.c_str());
+  }
+  else
+  {
+    fprintf(stderr, "LogCompressor: failed to compress %s\n", filename.c_str());
+    ::unlink(gzname.c_str());
+  }
+  return ok;
+}
+
+void LogCompressor::removeOld()
+{
+  if (maxFiles_ <= 0 && maxBytes_ <= 0)
+  {
+    return;
+  }
+
+  std::vector<std::pair<string, off_t>> archives;
+  DIR* dir = ::opendir(".");
+  if (dir == NULL)
+  {
+    return;
+  }
+  while (struct dirent* entry = ::readdir(dir))
+  {
+    struct stat st;
+    if (isArchive(basename_, entry->d_name) && ::stat(entry->d_name, &st) == 0)
+    {
+      archives.emplace_back(entry->d_name, st.st_size);
+    }
+  }
+  ::closedir(dir);
+
+  // the names start with the time they were created
+  std::sort(archives.begin(), archives.end());
+  off_t total = 0;
+  for (const auto& archive : archives)
+  {
+    total += archive.second;
+  }
+  size_t count = archives.size();
+  for (const auto& archive : archives)
+  {
+    bool tooMany = maxFiles_ > 0 && count > static_cast<size_t>(maxFiles_);
+    bool tooLarge = maxBytes_ > 0 && total > maxBytes_;
+    if (!tooMany && !tooLarge)
+    {
+      break;
+    }
+    ::unlink(archive.first.c_str());
+    --count;
+    total -= archive.second;
+  }
+}
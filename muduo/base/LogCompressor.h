@@ -0,0 +1,66 @@
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+//
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+
+#ifndef MUDUO_BASE_LOGCOMPRESSOR_H
+#define MUDUO_BASE_LOGCOMPRESSOR_H
+
+#include "muduo/base/BlockingQueue.h"
+#include "muduo/base/Thread.h"
+#include "muduo/base/Types.h"
+
+#include <atomic>
+
+namespace muduo
+{
+
+///
+/// Gzips rolled log files in a background thread of the lowest CPU and
+/// I/O priority, and removes the oldest compressed ones beyond a count
+/// or a total size.
+///
+///   LogCompressor compressor(basename, 30, 10*1000*1000*1000LL);
+///   compressor.start();
+///   AsyncLogging log(basename, rollSize);
+///   log.setRollCallback([&compressor](const string& f) { compressor.add(f); });
+///
+/// foo.20190101-120000.host.1234.log becomes foo.20190101-120000.host.1234.log.gz,
+/// in the current directory, like LogFile.
+///
+class LogCompressor : noncopyable
+{
+ public:
+  /// Keeps at most @c maxFiles compressed files of @c basename, and at
+  /// most @c maxBytes of them in total, 0 for no limit.
+  explicit LogCompressor(const string& basename, int maxFiles = 0, off_t maxBytes = 0);
+  ~LogCompressor();
+
+  void start();
+
+  /// Compresses the files already added, then stops.
+  void stop();
+
+  /// Thread safe, doesn't wait for the compression.
+  void add(const string& filename);
+
+  /// Number of files compressed so far.
+  int compressed() const { return compressed_; }
+
+ private:
+  void threadFunc();
+  bool compress(const string& filename);
+  void removeOld();
+
+  const string basename_;
+  const int maxFiles_;
+  const off_t maxBytes_;
+  bool running_;
+  std::atomic<int> compressed_;
+  BlockingQueue<string> queue_;
+  Thread thread_;
+};
+
+}  // namespace muduo
+
+#endif  // MUDUO_BASE_LOGCOMPRESSOR_H
@@ -5,6 +5,7 @@
 
 #include "muduo/base/LogFile.h"
 
+#include "muduo/base/BinaryLogging.h"
 #include "muduo/base/FileUtil.h"
 #include "muduo/base/ProcessInfo.h"
 
@@ -18,11 +19,15 @@ LogFile::LogFile(const string& basename,
                  off_t rollSize,
                  bool threadSafe,
                  int flushInterval,
-                 int checkEveryN)
+                 int checkEveryN,
+                 bool useMmap,
+                 bool syncOnFlush)
   : basename_(basename),
     rollSize_(rollSize),
     flushInterval_(flushInterval),
     checkEveryN_(checkEveryN),
+    useMmap_(useMmap),
+    syncOnFlush_(syncOnFlush),
     count_(0),
     mutex_(threadSafe ? new MutexLock : NULL),
     startOfPeriod_(0),
@@ -53,19 +58,35 @@ void LogFile::flush()
   if (mutex_)
   {
     MutexLockGuard lock(*mutex_);
-    file_->flush();
+    flush_unlocked();
   }
   else
   {
-    file_->flush();
+    flush_unlocked();
   }
 }
 
+void LogFile::flush_unlocked()
+{
+  if (mmapFile_)
+    mmapFile_->flush();
+  else
+    file_->flush();
+}
+
+off_t LogFile::writtenBytes() const
+{
+  return mmapFile_ ? mmapFile_->writtenBytes() : file_->writtenBytes();
+}
+
 void LogFile::append_unlocked(const char* logline, int len)
 {
-  file_->append(logline, len);
+  if (mmapFile_)
+    mmapFile_->append(logline, len);
+  else
+    file_->append(logline, len);
 
-  if (file_->writtenBytes() > rollSize_)                                    // 如果已向日志文件写入的字节数大于日志滚动门限值，此时应该进行日志滚动
+  if (writtenBytes() > rollSize_)                                    // 如果已向日志文件写入的字节数大于日志滚动门限值，此时应该进行日志滚动
   {
     rollFile();
   }
@@ -84,7 +105,7 @@ void LogFile::append_unlocked(const char* logline, int len)
       else if (now - lastFlush_ > flushInterval_)                           // 时间间隔大于刷新间隔，此时要进行flush
       {
         lastFlush_ = now;
-        file_->flush();
+        flush_unlocked();
       }
     }
   }
@@ -101,7 +122,28 @@ bool LogFile::rollFile()
     lastRoll_ = now;
     lastFlush_ = now;
     startOfPeriod_ = start;
-    file_.reset(new FileUtil::AppendFile(filename));                            // unique_ptr智能指针ret()函数先释放原来指向的对象，在指向新new出来的对象
+    if (useMmap_)
+    {
+      mmapFile_.reset(new FileUtil::MmapAppendFile(filename, syncOnFlush_));
+    }
+    else
+    {
+      file_.reset(new FileUtil::AppendFile(filename));                          // unique_ptr智能指针ret()函数先释放原来指向的对象，在指向新new出来的对象
+    }
+    // LOG_BIN_* records of this file may be of sites described in the last
+    string sites = BinaryLogSite::allRecords();
+    if (!sites.empty())
+    {
+      if (mmapFile_)
+        mmapFile_->append(sites.data(), sites.size());
+      else
+        file_->append(sites.data(), sites.size());
+    }
+    filename_.swap(filename);
+    if (!filename.empty() && rollCallback_)                                     // 原来的日志文件已经关闭
+    {
+      rollCallback_(filename);
+    }
     return true;
   }
   return false;
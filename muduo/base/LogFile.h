@@ -9,6 +9,7 @@
 #include "muduo/base/Mutex.h"
 #include "muduo/base/Types.h"
 
+#include <functional>
 #include <memory>
 
 namespace muduo
@@ -17,24 +18,36 @@ namespace muduo
 namespace FileUtil
 {
 class AppendFile;
+class MmapAppendFile;
 }
 
 class LogFile : noncopyable                                                 // 该类用于实现日志滚动
 {
  public:
+  typedef std::function<void (const string& filename)> RollCallback;
+
   LogFile(const string& basename,
           off_t rollSize,
           bool threadSafe = true,                                           // 是否需要线程安全，如果是多线程环境下，需要线程安全，如果是单线程使用，则不需要保证线程安全，默认情况是采用线程安全
           int flushInterval = 3,                                            // 指定多少秒将日志写入文件中，默认是3秒
-          int checkEveryN = 1024);                                          // 指定计数器count_比较标准
+          int checkEveryN = 1024,                                           // 指定计数器count_比较标准
+          bool useMmap = false,                                             // 用FileUtil::MmapAppendFile写，省去write(2)
+          bool syncOnFlush = false);                                        // useMmap时flush()等待写到磁盘，见FileUtil::MmapAppendFile
   ~LogFile();
 
   void append(const char* logline, int len);                                // 加锁方式向日志文件追加内容
   void flush();                                                             // 刷新缓冲区
   bool rollFile();                                                          // 切换日志文件
 
+  /// Called with the name of each file rolled over, after it is closed,
+  /// in the thread that appends, so it must not block, see LogCompressor.
+  /// Must be called before appending.
+  void setRollCallback(RollCallback cb) { rollCallback_ = std::move(cb); }
+
  private:
   void append_unlocked(const char* logline, int len);                       // 无锁方式向日志文件追加内容
+  void flush_unlocked();
+  off_t writtenBytes() const;
 
   static string getLogFileName(const string& basename, time_t* now);        // 获取日志文件的名称
 
@@ -42,6 +55,8 @@ class LogFile : noncopyable                                                 // 
   const off_t rollSize_;                                                    // 用来指示日志文件多大时切换日志文件 -- 比如1G，off_t类型是
   const int flushInterval_;                                                 // 写到日志文件的时间间隔，并不是每次打印日志都会直接输出到硬盘上，这样效率低
   const int checkEveryN_;                                                   // 计数器比较的标准
+  const bool useMmap_;
+  const bool syncOnFlush_;
 
   int count_;                                                               // 计数器，和checkEveryN_比较，如果相等就判断是否到了该将日志写到硬盘文件上？是不是文件的大小达到了rollSize_?
 
@@ -50,6 +65,9 @@ class LogFile : noncopyable                                                 // 
   time_t lastRoll_;                                                         // 上一次日志滚动的时间
   time_t lastFlush_;                                                        // 上一次日志写入文件的时间
   std::unique_ptr<FileUtil::AppendFile> file_;                              // AppendFile类智能指针
+  std::unique_ptr<FileUtil::MmapAppendFile> mmapFile_;                      // useMmap_时代替file_
+  string filename_;                                                         // 当前日志文件的名称
+  RollCallback rollCallback_;                                               // 日志文件滚动后的回调，比如交给LogCompressor压缩
 
   const static int kRollPerSeconds_ = 60*60*24;                             // 表示24小时
 };
@@ -6,6 +6,7 @@
 #include "muduo/base/LogStream.h"
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <type_traits>
 #include <assert.h>
@@ -23,7 +24,6 @@
 using namespace muduo;
 using namespace muduo::detail;
 
-// TODO: better itoa.
 #if defined(__clang__)
 #pragma clang diagnostic ignored "-Wtautological-compare"
 #else
@@ -35,35 +35,57 @@ namespace muduo
 namespace detail
 {
 
-const char digits[] = "9876543210123456789";                                            // 十进制数字数组，
-const char* zero = digits + 9;                                                  
-static_assert(sizeof(digits) == 20, "wrong number of digits");                          // 算上尾部的\0是20字节
+const char digitPairs[] =                                                               // 00到99两位一组，一次转换两位
+  "00010203040506070809"
+  "10111213141516171819"
+  "20212223242526272829"
+  "30313233343536373839"
+  "40414243444546474849"
+  "50515253545556575859"
+  "60616263646566676869"
+  "70717273747576777879"
+  "80818283848586878889"
+  "90919293949596979899";
+static_assert(sizeof(digitPairs) == 201, "wrong number of digitPairs");
 
 const char digitsHex[] = "0123456789ABCDEF";                                            // 十六进制数字数组
 static_assert(sizeof digitsHex == 17, "wrong number of digitsHex");                     // 算上尾部的\0是17字节
 
-// Efficient Integer to String Conversions, by Matthew Wilson.                          -- 高效的将整型转换成字符串函数
+// Two digits per division, from the end of a scratch buffer, no reverse.
 template<typename T>
-size_t convert(char buf[], T value)                                                     //  
+size_t convert(char buf[], T value)
 {
-  T i = value;
-  char* p = buf;
+  typedef typename std::make_unsigned<T>::type U;
+  U i = value < 0 ? static_cast<U>(static_cast<U>(0) - static_cast<U>(value))            // 取绝对值，最小的负数也不会溢出
+                  : static_cast<U>(value);
+  char scratch[24];
+  char* p = scratch + sizeof scratch;
 
-  do
+  while (i >= 100)
   {
-    int lsd = static_cast<int>(i % 10);                                                 // 取最后一位
-    i /= 10;
-    *p++ = zero[lsd];                                                                   // *p = zero[lsd]; ++p;
-  } while (i != 0);                                                                     // 从数字的低位取到高位
-
-  if (value < 0)                                                                        // 如果为负数，最后填一个负号
-  { 
-    *p++ = '-';
+    size_t pair = static_cast<size_t>(i % 100) * 2;                                     // 取最后两位
+    i /= 100;
+    p -= 2;
+    memcpy(p, digitPairs + pair, 2);
+  }
+  if (i < 10)
+  {
+    *--p = static_cast<char>('0' + i);
+  }
+  else
+  {
+    p -= 2;
+    memcpy(p, digitPairs + static_cast<size_t>(i) * 2, 2);
   }
-  *p = '\0';
-  std::reverse(buf, p);                                                                 // 字符串翻转
 
-  return p - buf;
+  if (value < 0)                                                                        // 如果为负数，最前面填一个负号
+  {
+    *--p = '-';
+  }
+  size_t len = static_cast<size_t>(scratch + sizeof scratch - p);
+  memcpy(buf, p, len);
+  buf[len] = '\0';
+  return len;
 }
 
 size_t convertHex(char buf[], uintptr_t value)                                          // 将16进制数转换成字符串，存放在buf中，思路同十进制整型的转换
@@ -84,6 +106,332 @@ size_t convertHex(char buf[], uintptr_t value)
   return p - buf;
 }
 
+// Grisu2 by Florian Loitsch, "Printing Floating-Point Numbers Quickly and
+// Accurately with Integers", PLDI 2010, after the implementation of Milo Yip.
+// The digits always read back to the same double, and are the shortest
+// such for all but a few doubles, which get one more digit.
+namespace
+{
+
+const int kDiySignificandSize = 64;
+const int kDpSignificandSize = 52;
+const int kDpExponentBias = 0x3FF + kDpSignificandSize;
+const int kDpMinExponent = -kDpExponentBias;
+const uint64_t kDpExponentMask = UINT64_C(0x7FF0000000000000);
+const uint64_t kDpSignificandMask = UINT64_C(0x000FFFFFFFFFFFFF);
+const uint64_t kDpHiddenBit = UINT64_C(0x0010000000000000);
+
+// f * 2^e
+struct DiyFp
+{
+  DiyFp(uint64_t fp, int exp) : f(fp), e(exp) {}
+
+  explicit DiyFp(double d)
+  {
+    uint64_t u;
+    memcpy(&u, &d, sizeof u);
+    int biasedExponent = static_cast<int>((u & kDpExponentMask) >> kDpSignificandSize);
+    uint64_t significand = u & kDpSignificandMask;
+    if (biasedExponent != 0)
+    {
+      f = significand + kDpHiddenBit;
+      e = biasedExponent - kDpExponentBias;
+    }
+    else                                                                                // 非规格化数
+    {
+      f = significand;
+      e = kDpMinExponent + 1;
+    }
+  }
+
+  DiyFp operator-(const DiyFp& rhs) const
+  {
+    return DiyFp(f - rhs.f, e);
+  }
+
+  // rounded upper 64 bits of the product
+  DiyFp operator*(const DiyFp& rhs) const
+  {
+    unsigned __int128 p = static_cast<unsigned __int128>(f) * rhs.f;
+    uint64_t h = static_cast<uint64_t>(p >> 64);
+    uint64_t l = static_cast<uint64_t>(p);
+    if (l & (UINT64_C(1) << 63))
+      ++h;
+    return DiyFp(h, e + rhs.e + 64);
+  }
+
+  DiyFp normalize() const
+  {
+    int s = __builtin_clzll(f);
+    return DiyFp(f << s, e - s);
+  }
+
+  DiyFp normalizeBoundary() const
+  {
+    DiyFp res = *this;
+    while (!(res.f & (kDpHiddenBit << 1)))
+    {
+      res.f <<= 1;
+      res.e--;
+    }
+    res.f <<= (kDiySignificandSize - kDpSignificandSize - 2);
+    res.e = res.e - (kDiySignificandSize - kDpSignificandSize - 2);
+    return res;
+  }
+
+  // the halfway points to the neighbouring doubles, with the same exponent
+  void normalizedBoundaries(DiyFp* minus, DiyFp* plus) const
+  {
+    DiyFp pl = DiyFp((f << 1) + 1, e - 1).normalizeBoundary();
+    DiyFp mi = (f == kDpHiddenBit) ? DiyFp((f << 2) - 1, e - 2) : DiyFp((f << 1) - 1, e - 1);
+    mi.f <<= mi.e - pl.e;
+    mi.e = pl.e;
+    *plus = pl;
+    *minus = mi;
+  }
+
+  uint64_t f;
+  int e;
+};
+
+// 10^-348, 10^-340, ..., 10^340, normalized
+const uint64_t kCachedPowersF[] =
+{
+  UINT64_C(0xfa8fd5a0081c0288), UINT64_C(0xbaaee17fa23ebf76), UINT64_C(0x8b16fb203055ac76),
+  UINT64_C(0xcf42894a5dce35ea), UINT64_C(0x9a6bb0aa55653b2d), UINT64_C(0xe61acf033d1a45df),
+  UINT64_C(0xab70fe17c79ac6ca), UINT64_C(0xff77b1fcbebcdc4f), UINT64_C(0xbe5691ef416bd60c),
+  UINT64_C(0x8dd01fad907ffc3c), UINT64_C(0xd3515c2831559a83), UINT64_C(0x9d71ac8fada6c9b5),
+  UINT64_C(0xea9c227723ee8bcb), UINT64_C(0xaecc49914078536d), UINT64_C(0x823c12795db6ce57),
+  UINT64_C(0xc21094364dfb5637), UINT64_C(0x9096ea6f3848984f), UINT64_C(0xd77485cb25823ac7),
+  UINT64_C(0xa086cfcd97bf97f4), UINT64_C(0xef340a98172aace5), UINT64_C(0xb23867fb2a35b28e),
+  UINT64_C(0x84c8d4dfd2c63f3b), UINT64_C(0xc5dd44271ad3cdba), UINT64_C(0x936b9fcebb25c996),
+  UINT64_C(0xdbac6c247d62a584), UINT64_C(0xa3ab66580d5fdaf6), UINT64_C(0xf3e2f893dec3f126),
+  UINT64_C(0xb5b5ada8aaff80b8), UINT64_C(0x87625f056c7c4a8b), UINT64_C(0xc9bcff6034c13053),
+  UINT64_C(0x964e858c91ba2655), UINT64_C(0xdff9772470297ebd), UINT64_C(0xa6dfbd9fb8e5b88f),
+  UINT64_C(0xf8a95fcf88747d94), UINT64_C(0xb94470938fa89bcf), UINT64_C(0x8a08f0f8bf0f156b),
+  UINT64_C(0xcdb02555653131b6), UINT64_C(0x993fe2c6d07b7fac), UINT64_C(0xe45c10c42a2b3b06),
+  UINT64_C(0xaa242499697392d3), UINT64_C(0xfd87b5f28300ca0e), UINT64_C(0xbce5086492111aeb),
+  UINT64_C(0x8cbccc096f5088cc), UINT64_C(0xd1b71758e219652c), UINT64_C(0x9c40000000000000),
+  UINT64_C(0xe8d4a51000000000), UINT64_C(0xad78ebc5ac620000), UINT64_C(0x813f3978f8940984),
+  UINT64_C(0xc097ce7bc90715b3), UINT64_C(0x8f7e32ce7bea5c70), UINT64_C(0xd5d238a4abe98068),
+  UINT64_C(0x9f4f2726179a2245), UINT64_C(0xed63a231d4c4fb27), UINT64_C(0xb0de65388cc8ada8),
+  UINT64_C(0x83c7088e1aab65db), UINT64_C(0xc45d1df942711d9a), UINT64_C(0x924d692ca61be758),
+  UINT64_C(0xda01ee641a708dea), UINT64_C(0xa26da3999aef774a), UINT64_C(0xf209787bb47d6b85),
+  UINT64_C(0xb454e4a179dd1877), UINT64_C(0x865b86925b9bc5c2), UINT64_C(0xc83553c5c8965d3d),
+  UINT64_C(0x952ab45cfa97a0b3), UINT64_C(0xde469fbd99a05fe3), UINT64_C(0xa59bc234db398c25),
+  UINT64_C(0xf6c69a72a3989f5c), UINT64_C(0xb7dcbf5354e9bece), UINT64_C(0x88fcf317f22241e2),
+  UINT64_C(0xcc20ce9bd35c78a5), UINT64_C(0x98165af37b2153df), UINT64_C(0xe2a0b5dc971f303a),
+  UINT64_C(0xa8d9d1535ce3b396), UINT64_C(0xfb9b7cd9a4a7443c), UINT64_C(0xbb764c4ca7a44410),
+  UINT64_C(0x8bab8eefb6409c1a), UINT64_C(0xd01fef10a657842c), UINT64_C(0x9b10a4e5e9913129),
+  UINT64_C(0xe7109bfba19c0c9d), UINT64_C(0xac2820d9623bf429), UINT64_C(0x80444b5e7aa7cf85),
+  UINT64_C(0xbf21e44003acdd2d), UINT64_C(0x8e679c2f5e44ff8f), UINT64_C(0xd433179d9c8cb841),
+  UINT64_C(0x9e19db92b4e31ba9), UINT64_C(0xeb96bf6ebadf77d9), UINT64_C(0xaf87023b9bf0ee6b),
+};
+const int16_t kCachedPowersE[] =
+{
+  -1220, -1193, -1166, -1140, -1113, -1087, -1060, -1034, -1007, -980, -954, -927,
+  -901, -874, -847, -821, -794, -768, -741, -715, -688, -661, -635, -608,
+  -582, -555, -529, -502, -475, -449, -422, -396, -369, -343, -316, -289,
+  -263, -236, -210, -183, -157, -130, -103, -77, -50, -24, 3, 30,
+  56, 83, 109, 136, 162, 189, 216, 242, 269, 295, 322, 348,
+  375, 402, 428, 455, 481, 508, 534, 561, 588, 614, 641, 667,
+  694, 720, 747, 774, 800, 827, 853, 880, 907, 933, 960, 986,
+  1013, 1039, 1066,
+};
+
+const uint64_t kPow10[] =
+{
+  UINT64_C(1), UINT64_C(10), UINT64_C(100), UINT64_C(1000), UINT64_C(10000),
+  UINT64_C(100000), UINT64_C(1000000), UINT64_C(10000000), UINT64_C(100000000),
+  UINT64_C(1000000000), UINT64_C(10000000000), UINT64_C(100000000000),
+  UINT64_C(1000000000000), UINT64_C(10000000000000), UINT64_C(100000000000000),
+  UINT64_C(1000000000000000), UINT64_C(10000000000000000), UINT64_C(100000000000000000),
+  UINT64_C(1000000000000000000), UINT64_C(10000000000000000000),
+};
+
+// c = 10^-K, such that c * 2^e has its binary exponent in [-60, -32]
+DiyFp getCachedPower(int e, int* K)
+{
+  double dk = (-61 - e) * 0.30102999566398114 + 347;                                    // log10(2)
+  int k = static_cast<int>(dk);
+  if (dk - k > 0.0)
+    k++;
+  unsigned index = static_cast<unsigned>((k >> 3) + 1);
+  *K = -(-348 + static_cast<int>(index * 8));
+  return DiyFp(kCachedPowersF[index], kCachedPowersE[index]);
+}
+
+// moves the last digit towards w, while it stays in the unsafe interval
+void grisuRound(char* buffer, int len, uint64_t delta, uint64_t rest,
+                uint64_t tenKappa, uint64_t wpw)
+{
+  while (rest < wpw && delta - rest >= tenKappa &&
+         (rest + tenKappa < wpw || wpw - rest > rest + tenKappa - wpw))
+  {
+    buffer[len - 1]--;
+    rest += tenKappa;
+  }
+}
+
+int countDecimalDigit32(uint32_t n)
+{
+  int count = 1;
+  while (count < 10 && n >= kPow10[count])
+    ++count;
+  return count;
+}
+
+void digitGen(const DiyFp& W, const DiyFp& Mp, uint64_t delta, char* buffer, int* len, int* K)
+{
+  const DiyFp one(UINT64_C(1) << -Mp.e, Mp.e);
+  const DiyFp wpw = Mp - W;
+  uint32_t p1 = static_cast<uint32_t>(Mp.f >> -one.e);                                 // 整数部分
+  uint64_t p2 = Mp.f & (one.f - 1);                                                    // 小数部分
+  int kappa = countDecimalDigit32(p1);
+  *len = 0;
+
+  while (kappa > 0)
+  {
+    uint32_t pow10 = static_cast<uint32_t>(kPow10[kappa - 1]);
+    uint32_t d = p1 / pow10;
+    p1 %= pow10;
+    if (d || *len)
+      buffer[(*len)++] = static_cast<char>('0' + d);
+    kappa--;
+    uint64_t tmp = (static_cast<uint64_t>(p1) << -one.e) + p2;
+    if (tmp <= delta)
+    {
+      *K += kappa;
+      grisuRound(buffer, *len, delta, tmp, kPow10[kappa] << -one.e, wpw.f);
+      return;
+    }
+  }
+
+  for (;;)
+  {
+    p2 *= 10;
+    delta *= 10;
+    char d = static_cast<char>(p2 >> -one.e);
+    if (d || *len)
+      buffer[(*len)++] = static_cast<char>('0' + d);
+    p2 &= one.f - 1;
+    kappa--;
+    if (p2 < delta)
+    {
+      *K += kappa;
+      int index = -kappa;
+      grisuRound(buffer, *len, delta, p2, one.f, wpw.f * (index < 20 ? kPow10[index] : 0));
+      return;
+    }
+  }
+}
+
+// value > 0, value = buffer[0, len) * 10^K
+void grisu2(double value, char* buffer, int* len, int* K)
+{
+  const DiyFp v(value);
+  DiyFp mMinus(0, 0), mPlus(0, 0);
+  v.normalizedBoundaries(&mMinus, &mPlus);
+
+  const DiyFp cmk = getCachedPower(mPlus.e, K);
+  const DiyFp W = v.normalize() * cmk;
+  DiyFp Wp = mPlus * cmk;
+  DiyFp Wm = mMinus * cmk;
+  Wm.f++;
+  Wp.f--;
+  digitGen(W, Wp, Wp.f - Wm.f, buffer, len, K);
+}
+
+char* writeExponent(int K, char* p)
+{
+  *p++ = 'e';
+  if (K < 0)
+  {
+    *p++ = '-';
+    K = -K;
+  }
+  else
+  {
+    *p++ = '+';
+  }
+  if (K >= 100)
+  {
+    *p++ = static_cast<char>('0' + K / 100);
+    K %= 100;
+  }
+  memcpy(p, digitPairs + K * 2, 2);                                                     // 至少两位，同printf
+  return p + 2;
+}
+
+}  // namespace
+
+// Like printf("%.17g"), but with the shortest digits that read back to @c value:
+// 0.1 is "0.1", 1e+100 is "1e+100", 0.1+0.2 is "0.30000000000000004".
+size_t convertDouble(char buf[], double value)
+{
+  char* p = buf;
+  if (std::signbit(value))
+  {
+    *p++ = '-';
+    value = -value;
+  }
+
+  if (std::isnan(value) || std::isinf(value))
+  {
+    memcpy(p, std::isnan(value) ? "nan" : "inf", 4);
+    return static_cast<size_t>(p - buf) + 3;
+  }
+  if (value == 0.0)
+  {
+    memcpy(p, "0", 2);
+    return static_cast<size_t>(p - buf) + 1;
+  }
+
+  char digits[20];
+  int length = 0;
+  int K = 0;
+  grisu2(value, digits, &length, &K);
+
+  const int kk = length + K;                                                            // 10^(kk-1) <= value < 10^kk
+  if (kk - 1 >= -4 && kk - 1 < 17)                                                      // 同%g，指数在[-4, 17)时不用科学计数法
+  {
+    if (K >= 0)                                                                         // 整数，补零
+    {
+      memcpy(p, digits, length);
+      memset(p + length, '0', K);
+      p += kk;
+    }
+    else if (kk > 0)                                                                    // 小数点在中间
+    {
+      memcpy(p, digits, kk);
+      p[kk] = '.';
+      memcpy(p + kk + 1, digits + kk, length - kk);
+      p += length + 1;
+    }
+    else                                                                                // 0.00ddd
+    {
+      p[0] = '0';
+      p[1] = '.';
+      memset(p + 2, '0', -kk);
+      memcpy(p + 2 - kk, digits, length);
+      p += 2 - kk + length;
+    }
+  }
+  else
+  {
+    *p++ = digits[0];
+    if (length > 1)
+    {
+      *p++ = '.';
+      memcpy(p, digits + 1, length - 1);
+      p += length - 1;
+    }
+    p = writeExponent(kk - 1, p);
+  }
+  *p = '\0';
+  return static_cast<size_t>(p - buf);
+}
+
 template class FixedBuffer<kSmallBuffer>;
 template class FixedBuffer<kLargeBuffer>;
 
@@ -225,6 +573,8 @@ void LogStream::staticCheck()
 {
   static_assert(kMaxNumericSize - 10 > std::numeric_limits<double>::digits10,           // std::numeric_limits<double>::digits10 -- double类型数据在十进制下的最大位数 -- 15位
                 "kMaxNumericSize is large enough");
+  static_assert(kMaxNumericSize > std::numeric_limits<double>::max_digits10 + 8,      // 符号、小数点、e-308和结尾的\0
+                "kMaxNumericSize is large enough");
   static_assert(kMaxNumericSize - 10 > std::numeric_limits<long double>::digits10,      // std::numeric_limits<long double>::digits10 -- long double类型数据在十进制下的最大位数 -- 15位
                 "kMaxNumericSize is large enough");
   static_assert(kMaxNumericSize - 10 > std::numeric_limits<long>::digits10,             // std::numeric_limits<long>::digits10 -- long类型数据在十进制下的最大位数 -- 9位
@@ -305,12 +655,11 @@ LogStream& LogStream::operator<<(const void* p)
   return *this;
 }
 
-// FIXME: replace this with Grisu3 by Florian Loitsch.
 LogStream& LogStream::operator<<(double v)
 {
   if (buffer_.avail() >= kMaxNumericSize)
   {
-    int len = snprintf(buffer_.current(), kMaxNumericSize, "%.12g", v);                 // 使用snprintf将double浮点数转换成字符串
+    size_t len = convertDouble(buffer_.current(), v);                                   // 最短的、能原样读回的十进制表示
     buffer_.add(len);
   }
   return *this;
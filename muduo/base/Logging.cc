@@ -66,27 +66,6 @@ const char* LogLevelName[Logger::NUM_LOG_LEVELS] =
   "FATAL ",
 };                                                                                                  // 日志级别，字符串数组，用枚举元素的值作为数组index
 
-// helper class for known string length at compile time                                             -- 帮助类，为了知道字符串的长度和编译时间
-class T                                                                                             // 将字符串和字符串长度封装在一起
-{
- public:
-  T(const char* str, unsigned len)
-    :str_(str),
-     len_(len)
-  {
-    assert(strlen(str) == len_);
-  }
-
-  const char* str_;
-  const unsigned len_;
-};
-
-inline LogStream& operator<<(LogStream& s, T v)                                                     // 重载全局的<<操作符??
-{
-  s.append(v.str_, v.len_);
-  return s;
-}
-
 inline LogStream& operator<<(LogStream& s, const Logger::SourceFile& v)                             // 函数重载
 {
   s.append(v.data_, v.size_);
@@ -122,14 +101,16 @@ Logger::Impl::Impl(LogLevel level, int savedErrno, const SourceFile& file, int l
 {
   formatTime();                                                                                     // 格式化时间
   CurrentThread::tid();                                                                             // 获取当前线程的tid
-  stream_ << T(CurrentThread::tidString(), CurrentThread::tidStringLength());                       // 输出线程tid
-  stream_ << T(LogLevelName[level], 6);                                                             // 输出日志级别
+  stream_.append(CurrentThread::tidString(), CurrentThread::tidStringLength());                     // 输出线程tid
+  stream_.append(LogLevelName[level], 6);                                                           // 输出日志级别
   if (savedErrno != 0)                                                                              // errno不为0时输出"errno说明 (errno=xxx)"
   {
     stream_ << strerror_tl(savedErrno) << " (errno=" << savedErrno << ") ";
   }
 }
 
+// "20190101 12:00:00.123456Z ", or without 'Z' in g_logTimeZone.
+// The part up to seconds is formatted once a second per thread.
 void Logger::Impl::formatTime()
 {
   int64_t microSecondsSinceEpoch = time_.microSecondsSinceEpoch();
@@ -148,23 +129,29 @@ void Logger::Impl::formatTime()
       ::gmtime_r(&seconds, &tm_time); // FIXME TimeZone::fromUtcTime
     }
 
-    int len = snprintf(t_time, sizeof(t_time), "%4d%02d%02d %02d:%02d:%02d",
+    int len = snprintf(t_time, sizeof(t_time), "%4d%02d%02d %02d:%02d:%02d.",
         tm_time.tm_year + 1900, tm_time.tm_mon + 1, tm_time.tm_mday,
         tm_time.tm_hour, tm_time.tm_min, tm_time.tm_sec);
-    assert(len == 17); (void)len;
+    assert(len == 18); (void)len;
   }
 
+  char buf[32];
+  memcpy(buf, t_time, 18);
+  for (int i = 23; i >= 18; --i)                                                                    // 定长6位微秒，不用snprintf
+  {
+    buf[i] = static_cast<char>('0' + microseconds % 10);
+    microseconds /= 10;
+  }
   if (g_logTimeZone.valid())
   {
-    Fmt us(".%06d ", microseconds);
-    assert(us.length() == 8);
-    stream_ << T(t_time, 17) << T(us.data(), 8);
+    buf[24] = ' ';
+    stream_.append(buf, 25);
   }
   else
   {
-    Fmt us(".%06dZ ", microseconds);
-    assert(us.length() == 9);
-    stream_ << T(t_time, 17) << T(us.data(), 9);
+    buf[24] = 'Z';
+    buf[25] = ' ';
+    stream_.append(buf, 26);
   }
 }
 
@@ -9,6 +9,8 @@
 #include "muduo/base/LogStream.h"
 #include "muduo/base/Timestamp.h"
 
+#include <atomic>
+
 namespace muduo
 {
 
@@ -105,6 +107,18 @@ inline Logger::LogLevel Logger::logLevel()
   return g_logLevel;
 }
 
+//
+// LOG_* statements below MUDUO_MIN_LOG_LEVEL are compiled out, whatever
+// the level at run time, e.g. -DMUDUO_MIN_LOG_LEVEL=2 keeps INFO and up.
+// 0 TRACE, 1 DEBUG, 2 INFO, 3 WARN, 4 ERROR, FATAL is always kept.
+//
+#ifndef MUDUO_MIN_LOG_LEVEL
+#define MUDUO_MIN_LOG_LEVEL 0
+#endif
+
+#define MUDUO_LOG_ENABLED(level) \
+  (MUDUO_MIN_LOG_LEVEL <= muduo::Logger::level && muduo::Logger::logLevel() <= muduo::Logger::level)
+
 //
 // CAUTION: do not write:
 //
@@ -121,20 +135,196 @@ inline Logger::LogLevel Logger::logLevel()
 //   else
 //     logWarnStream << "Bad news";
 //                                                                                      -- 在代码中做日志打印时实际使用的就是如下的宏定义
-#define LOG_TRACE if (muduo::Logger::logLevel() <= muduo::Logger::TRACE) \
+#define LOG_TRACE if (MUDUO_LOG_ENABLED(TRACE)) \
   muduo::Logger(__FILE__, __LINE__, muduo::Logger::TRACE, __func__).stream()            // 编译器内置宏，__FILE__在源文件中插入当前文件的源文件名；__LINE__在源文件中插入当前源文件行号；__func__所在的函数名
-#define LOG_DEBUG if (muduo::Logger::logLevel() <= muduo::Logger::DEBUG) \
+#define LOG_DEBUG if (MUDUO_LOG_ENABLED(DEBUG)) \
   muduo::Logger(__FILE__, __LINE__, muduo::Logger::DEBUG, __func__).stream()
-#define LOG_INFO if (muduo::Logger::logLevel() <= muduo::Logger::INFO) \
+#define LOG_INFO if (MUDUO_LOG_ENABLED(INFO)) \
   muduo::Logger(__FILE__, __LINE__).stream()
+#if MUDUO_MIN_LOG_LEVEL <= 3
 #define LOG_WARN muduo::Logger(__FILE__, __LINE__, muduo::Logger::WARN).stream()
+#else
+#define LOG_WARN while (false) muduo::Logger(__FILE__, __LINE__, muduo::Logger::WARN).stream()
+#endif
+#if MUDUO_MIN_LOG_LEVEL <= 4
 #define LOG_ERROR muduo::Logger(__FILE__, __LINE__, muduo::Logger::ERROR).stream()
-#define LOG_FATAL muduo::Logger(__FILE__, __LINE__, muduo::Logger::FATAL).stream()
 #define LOG_SYSERR muduo::Logger(__FILE__, __LINE__, false).stream()
+#else
+#define LOG_ERROR while (false) muduo::Logger(__FILE__, __LINE__, muduo::Logger::ERROR).stream()
+#define LOG_SYSERR while (false) muduo::Logger(__FILE__, __LINE__, false).stream()
+#endif
+#define LOG_FATAL muduo::Logger(__FILE__, __LINE__, muduo::Logger::FATAL).stream()
 #define LOG_SYSFATAL muduo::Logger(__FILE__, __LINE__, true).stream()
 
 const char* strerror_tl(int savedErrno);
 
+namespace detail
+{
+
+// Whether a rate limited LOG_* line is written, and how many were not since.
+class LogPermit
+{
+ public:
+  LogPermit() : suppressed_(-1) {}
+  explicit LogPermit(int64_t suppressed) : suppressed_(suppressed) {}
+
+  explicit operator bool() const { return suppressed_ >= 0; }
+  int64_t suppressed() const { return suppressed_; }
+
+ private:
+  int64_t suppressed_;
+};
+
+inline LogStream& operator<<(LogStream& s, const LogPermit& permit)
+{
+  if (permit.suppressed() > 0)
+  {
+    s << '(' << permit.suppressed() << " suppressed) ";
+  }
+  return s;
+}
+
+// The state of a call site, constant initialized, lock free.
+
+// the 1st, (n+1)th, (2n+1)th... calls
+class LogEveryN : noncopyable
+{
+ public:
+  constexpr LogEveryN() : count_(0) {}
+
+  LogPermit acquire(int n)
+  {
+    int64_t count = count_.fetch_add(1, std::memory_order_relaxed);
+    if (count % n != 0)
+      return LogPermit();
+    return LogPermit(count == 0 ? 0 : n - 1);
+  }
+
+ private:
+  std::atomic<int64_t> count_;
+};
+
+// at most once per interval
+class LogEverySeconds : noncopyable
+{
+ public:
+  constexpr LogEverySeconds() : last_(0), suppressed_(0) {}
+
+  LogPermit acquire(double seconds)
+  {
+    int64_t now = Timestamp::now().microSecondsSinceEpoch();
+    int64_t last = last_.load(std::memory_order_relaxed);
+    if ((last != 0 && now - last < static_cast<int64_t>(seconds * Timestamp::kMicroSecondsPerSecond))
+        || !last_.compare_exchange_strong(last, now, std::memory_order_relaxed))
+    {
+      suppressed_.fetch_add(1, std::memory_order_relaxed);
+      return LogPermit();
+    }
+    return LogPermit(suppressed_.exchange(0, std::memory_order_relaxed));
+  }
+
+ private:
+  std::atomic<int64_t> last_;
+  std::atomic<int64_t> suppressed_;
+};
+
+// A token bucket of @c burst lines, refilled at @c perSecond lines per second,
+// kept as the time it will be full again (GCRA), so one word is enough.
+class LogTokenBucket : noncopyable
+{
+ public:
+  constexpr LogTokenBucket() : full_(0), suppressed_(0) {}
+
+  LogPermit acquire(double perSecond, int burst)
+  {
+    int64_t now = Timestamp::now().microSecondsSinceEpoch();
+    int64_t interval = static_cast<int64_t>(Timestamp::kMicroSecondsPerSecond / perSecond);
+    int64_t tolerance = interval * (burst - 1);
+    int64_t full = full_.load(std::memory_order_relaxed);
+    for (;;)
+    {
+      int64_t start = full > now ? full : now;
+      if (start - now > tolerance)
+      {
+        suppressed_.fetch_add(1, std::memory_order_relaxed);
+        return LogPermit();
+      }
+      if (full_.compare_exchange_weak(full, start + interval, std::memory_order_relaxed))
+        break;
+    }
+    return LogPermit(suppressed_.exchange(0, std::memory_order_relaxed));
+  }
+
+ private:
+  std::atomic<int64_t> full_;
+  std::atomic<int64_t> suppressed_;
+};
+
+}  // namespace detail
+
+//
+// Rate limited logging, for the lines that a failure or a misbehaving peer
+// can trigger in a storm.  Each call site limits itself, lines that are not
+// written are counted, and the next line written says how many:
+//
+//   LOG_WARN_EVERY_N(1000) << "...";          // the 1st, 1001st, 2001st...
+//   LOG_WARN_EVERY_SECONDS(1.0) << "...";     // at most once a second
+//   LOG_WARN_RATE_LIMITED(10, 100) << "...";  // 10 a second, bursts of 100
+//
+//   20190101 12:00:00.000000 1234 WARN  (4321 suppressed) ... - file.cc:42
+//
+// The arguments are not evaluated for the lines not written, like LOG_*.
+// Same caution as LOG_*, do not use in an unbraced if-else.
+//
+#define MUDUO_LOG_LIMITED(enabled, logger, State, ...) \
+  if (muduo::detail::LogPermit muduo_log_permit = !(enabled) ? muduo::detail::LogPermit() \
+        : []() -> muduo::detail::State& { static muduo::detail::State state; return state; }() \
+            .acquire(__VA_ARGS__)) \
+    logger.stream() << muduo_log_permit
+
+#define MUDUO_LOG_TRACE_LIMITED(State, ...) \
+  MUDUO_LOG_LIMITED(MUDUO_LOG_ENABLED(TRACE), \
+    muduo::Logger(__FILE__, __LINE__, muduo::Logger::TRACE, __func__), State, __VA_ARGS__)
+#define MUDUO_LOG_DEBUG_LIMITED(State, ...) \
+  MUDUO_LOG_LIMITED(MUDUO_LOG_ENABLED(DEBUG), \
+    muduo::Logger(__FILE__, __LINE__, muduo::Logger::DEBUG, __func__), State, __VA_ARGS__)
+#define MUDUO_LOG_INFO_LIMITED(State, ...) \
+  MUDUO_LOG_LIMITED(MUDUO_LOG_ENABLED(INFO), \
+    muduo::Logger(__FILE__, __LINE__), State, __VA_ARGS__)
+#define MUDUO_LOG_WARN_LIMITED(State, ...) \
+  MUDUO_LOG_LIMITED(MUDUO_MIN_LOG_LEVEL <= 3, muduo::Logger(__FILE__, __LINE__, muduo::Logger::WARN), State, __VA_ARGS__)
+#define MUDUO_LOG_ERROR_LIMITED(State, ...) \
+  MUDUO_LOG_LIMITED(MUDUO_MIN_LOG_LEVEL <= 4, muduo::Logger(__FILE__, __LINE__, muduo::Logger::ERROR), State, __VA_ARGS__)
+#define MUDUO_LOG_SYSERR_LIMITED(State, ...) \
+  MUDUO_LOG_LIMITED(MUDUO_MIN_LOG_LEVEL <= 4, muduo::Logger(__FILE__, __LINE__, false), State, __VA_ARGS__)
+
+#define LOG_TRACE_EVERY_N(n) MUDUO_LOG_TRACE_LIMITED(LogEveryN, n)
+#define LOG_DEBUG_EVERY_N(n) MUDUO_LOG_DEBUG_LIMITED(LogEveryN, n)
+#define LOG_INFO_EVERY_N(n) MUDUO_LOG_INFO_LIMITED(LogEveryN, n)
+#define LOG_WARN_EVERY_N(n) MUDUO_LOG_WARN_LIMITED(LogEveryN, n)
+#define LOG_ERROR_EVERY_N(n) MUDUO_LOG_ERROR_LIMITED(LogEveryN, n)
+#define LOG_SYSERR_EVERY_N(n) MUDUO_LOG_SYSERR_LIMITED(LogEveryN, n)
+
+#define LOG_TRACE_EVERY_SECONDS(seconds) MUDUO_LOG_TRACE_LIMITED(LogEverySeconds, seconds)
+#define LOG_DEBUG_EVERY_SECONDS(seconds) MUDUO_LOG_DEBUG_LIMITED(LogEverySeconds, seconds)
+#define LOG_INFO_EVERY_SECONDS(seconds) MUDUO_LOG_INFO_LIMITED(LogEverySeconds, seconds)
+#define LOG_WARN_EVERY_SECONDS(seconds) MUDUO_LOG_WARN_LIMITED(LogEverySeconds, seconds)
+#define LOG_ERROR_EVERY_SECONDS(seconds) MUDUO_LOG_ERROR_LIMITED(LogEverySeconds, seconds)
+#define LOG_SYSERR_EVERY_SECONDS(seconds) MUDUO_LOG_SYSERR_LIMITED(LogEverySeconds, seconds)
+
+#define LOG_TRACE_RATE_LIMITED(perSecond, burst) \
+  MUDUO_LOG_TRACE_LIMITED(LogTokenBucket, perSecond, burst)
+#define LOG_DEBUG_RATE_LIMITED(perSecond, burst) \
+  MUDUO_LOG_DEBUG_LIMITED(LogTokenBucket, perSecond, burst)
+#define LOG_INFO_RATE_LIMITED(perSecond, burst) \
+  MUDUO_LOG_INFO_LIMITED(LogTokenBucket, perSecond, burst)
+#define LOG_WARN_RATE_LIMITED(perSecond, burst) \
+  MUDUO_LOG_WARN_LIMITED(LogTokenBucket, perSecond, burst)
+#define LOG_ERROR_RATE_LIMITED(perSecond, burst) \
+  MUDUO_LOG_ERROR_LIMITED(LogTokenBucket, perSecond, burst)
+#define LOG_SYSERR_RATE_LIMITED(perSecond, burst) \
+  MUDUO_LOG_SYSERR_LIMITED(LogTokenBucket, perSecond, burst)
+
 // Taken from glog/logging.h
 //
 // Check that the input is non NULL.  This very useful in constructor                   -- 检查输入参数不为NULL，这对于构造函数初始化列表非常有用
@@ -0,0 +1,263 @@
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+//
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+
+#ifndef MUDUO_BASE_MPMCQUEUE_H
+#define MUDUO_BASE_MPMCQUEUE_H
+
+#include "muduo/base/SpscQueue.h"
+
+namespace muduo
+{
+
+///
+/// Bounded lock-free queue for any number of producers and consumers.
+///
+/// Dmitry Vyukov's ring buffer: every slot carries a sequence number
+/// that tells whether it is ready to be written or read in the current
+/// lap, so producers and consumers only contend on their own index.
+///
+/// Same put/spinPut/tryPut, take/spinTake/tryTake and batch interface
+/// as SpscQueue.  Batches are not atomic, other threads' items may
+/// interleave.
+///
+template<typename T>
+class MpmcQueue : noncopyable
+{
+ public:
+  /// @c capacity is rounded up to a power of 2.
+  explicit MpmcQueue(size_t capacity)
+    : mask_(detail::roundUpToPowerOfTwo(capacity) - 1),
+      slots_(new Slot[mask_ + 1]),
+      head_(0),
+      tail_(0)
+  {
+    assert(capacity > 0);
+    for (size_t i = 0; i <= mask_; ++i)
+    {
+      slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  ~MpmcQueue()
+  {
+    T x;
+    size_t pos;
+    while (pop(&x, &pos))
+    {
+    }
+  }
+
+  size_t capacity() const { return mask_ + 1; }
+
+  /// Approximate while other threads are busy.
+  size_t size() const
+  {
+    size_t head = head_.load(std::memory_order_acquire);
+    size_t tail = tail_.load(std::memory_order_acquire);
+    return tail > head ? tail - head : 0;
+  }
+  bool empty() const { return size() == 0; }
+  bool full() const { return size() > mask_; }
+
+  bool tryPut(const T& x) { return putOne(x); }
+  bool tryPut(T&& x) { return putOne(std::move(x)); }
+
+  void spinPut(const T& x) { while (!putOne(x)) sched_yield(); }
+  void spinPut(T&& x) { while (!putOne(std::move(x))) sched_yield(); }
+
+  void put(const T& x) { T copy(x); put(std::move(copy)); }
+  void put(T&& x)
+  {
+    for (int i = 0; i < detail::kSpinsBeforeBlocking; ++i)
+    {
+      if (putOne(std::move(x)))
+        return;
+    }
+    while (true)
+    {
+      int key = notFull_.prepareWait();
+      if (putOne(std::move(x)))
+      {
+        notFull_.cancelWait();
+        return;
+      }
+      notFull_.wait(key);
+    }
+  }
+
+  /// Puts as many of @c items[0, n) as fit, returns how many.
+  /// Never blocks.
+  size_t putBatch(const T* items, size_t n)
+  {
+    size_t i = 0;
+    while (i < n && putOne(items[i]))
+    {
+      ++i;
+    }
+    return i;
+  }
+
+  bool tryTake(T* x) { return takeOne(x); }
+
+  T spinTake()
+  {
+    T x;
+    while (!takeOne(&x))
+      sched_yield();
+    return x;
+  }
+
+  T take()
+  {
+    T x;
+    for (int i = 0; i < detail::kSpinsBeforeBlocking; ++i)
+    {
+      if (takeOne(&x))
+        return x;
+    }
+    while (true)
+    {
+      int key = notEmpty_.prepareWait();
+      if (takeOne(&x))
+      {
+        notEmpty_.cancelWait();
+        return x;
+      }
+      notEmpty_.wait(key);
+    }
+  }
+
+  /// Takes up to @c maxItems into @c out, returns how many.
+  /// Never blocks.
+  size_t takeBatch(T* out, size_t maxItems)
+  {
+    size_t i = 0;
+    while (i < maxItems && takeOne(&out[i]))
+    {
+      ++i;
+    }
+    return i;
+  }
+
+ private:
+  struct Slot
+  {
+    void* address() { return &storage; }
+    T* get() { return reinterpret_cast<T*>(&storage); }
+    // == position: free for the producer of that position
+    // == position + 1: holds the item for the consumer of that position
+    std::atomic<size_t> sequence;
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+  };
+
+  // Like SpscQueue, a put only wakes a consumer if the queue was empty.
+  // With many consumers that alone could strand items while consumers
+  // sleep, so a take that leaves items behind passes the baton to the
+  // next sleeper.  The same for producers and full queues.
+
+  template<typename U>
+  bool putOne(U&& x)
+  {
+    size_t pos;
+    if (!emplace(std::forward<U>(x), &pos))
+      return false;
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    size_t head = head_.load(std::memory_order_relaxed);
+    if (head == pos)
+      notEmpty_.notify();
+    if (pos + 1 - head <= mask_)
+      notFull_.notify();
+    return true;
+  }
+
+  bool takeOne(T* x)
+  {
+    size_t pos;
+    if (!pop(x, &pos))
+      return false;
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    size_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail - pos > mask_)
+      notFull_.notify();
+    if (tail > pos + 1)
+      notEmpty_.notify();
+    return true;
+  }
+
+  template<typename U>
+  bool emplace(U&& x, size_t* position)
+  {
+    size_t pos = tail_.load(std::memory_order_relaxed);
+    Slot* slot;
+    while (true)
+    {
+      slot = &slots_[pos & mask_];
+      size_t seq = slot->sequence.load(std::memory_order_acquire);
+      if (seq == pos)
+      {
+        if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+          break;
+      }
+      else if (seq < pos)
+      {
+        return false;  // full, the consumer of the last lap isn't done
+      }
+      else
+      {
+        pos = tail_.load(std::memory_order_relaxed);
+      }
+    }
+    new (slot->address()) T(std::forward<U>(x));
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    *position = pos;
+    return true;
+  }
+
+  bool pop(T* x, size_t* position)
+  {
+    size_t pos = head_.load(std::memory_order_relaxed);
+    Slot* slot;
+    while (true)
+    {
+      slot = &slots_[pos & mask_];
+      size_t seq = slot->sequence.load(std::memory_order_acquire);
+      if (seq == pos + 1)
+      {
+        if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+          break;
+      }
+      else if (seq < pos + 1)
+      {
+        return false;  // empty
+      }
+      else
+      {
+        pos = head_.load(std::memory_order_relaxed);
+      }
+    }
+    T* item = slot->get();
+    *x = std::move(*item);
+    item->~T();
+    slot->sequence.store(pos + mask_ + 1, std::memory_order_release);
+    *position = pos;
+    return true;
+  }
+
+  typedef char Padding[detail::kCacheLineSize];
+
+  const size_t mask_;
+  const std::unique_ptr<Slot[]> slots_;
+  Padding pad0_;
+  std::atomic<size_t> head_;
+  Padding pad1_;
+  std::atomic<size_t> tail_;
+  Padding pad2_;
+  EventCount notEmpty_;
+  EventCount notFull_;
+};
+
+}  // namespace muduo
+
+#endif  // MUDUO_BASE_MPMCQUEUE_H
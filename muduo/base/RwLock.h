@@ -0,0 +1,104 @@
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+//
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+
+#ifndef MUDUO_BASE_RWLOCK_H
+#define MUDUO_BASE_RWLOCK_H
+
+#include "muduo/base/Mutex.h"
+
+namespace muduo
+{
+
+// For data read far more often than written, eg. a cache whose hits
+// don't modify it.  Use as data member of a class, like MutexLock.
+class CAPABILITY("rwlock") RwLock : noncopyable
+{
+ public:
+  RwLock()
+  {
+    MCHECK(pthread_rwlock_init(&rwlock_, NULL));
+  }
+
+  ~RwLock()
+  {
+    MCHECK(pthread_rwlock_destroy(&rwlock_));
+  }
+
+  // internal usage
+
+  void readLock() ACQUIRE_SHARED()
+  {
+    MCHECK(pthread_rwlock_rdlock(&rwlock_));
+  }
+
+  void readUnlock() RELEASE_SHARED()
+  {
+    MCHECK(pthread_rwlock_unlock(&rwlock_));
+  }
+
+  void writeLock() ACQUIRE()
+  {
+    MCHECK(pthread_rwlock_wrlock(&rwlock_));
+  }
+
+  void writeUnlock() RELEASE()
+  {
+    MCHECK(pthread_rwlock_unlock(&rwlock_));
+  }
+
+ private:
+  pthread_rwlock_t rwlock_;
+};
+
+// Use as a stack variable, eg.
+// size_t Foo::size() const
+// {
+//   ReadLockGuard lock(rwlock_);
+//   return data_.size();
+// }
+class SCOPED_CAPABILITY ReadLockGuard : noncopyable
+{
+ public:
+  explicit ReadLockGuard(RwLock& rwlock) ACQUIRE_SHARED(rwlock)
+    : rwlock_(rwlock)
+  {
+    rwlock_.readLock();
+  }
+
+  ~ReadLockGuard() RELEASE()
+  {
+    rwlock_.readUnlock();
+  }
+
+ private:
+  RwLock& rwlock_;
+};
+
+class SCOPED_CAPABILITY WriteLockGuard : noncopyable
+{
+ public:
+  explicit WriteLockGuard(RwLock& rwlock) ACQUIRE(rwlock)
+    : rwlock_(rwlock)
+  {
+    rwlock_.writeLock();
+  }
+
+  ~WriteLockGuard() RELEASE()
+  {
+    rwlock_.writeUnlock();
+  }
+
+ private:
+  RwLock& rwlock_;
+};
+
+}  // namespace muduo
+
+// Prevent misuse like:
+// ReadLockGuard(rwlock_);
+#define ReadLockGuard(x) error "Missing guard object name"
+#define WriteLockGuard(x) error "Missing guard object name"
+
+#endif  // MUDUO_BASE_RWLOCK_H
@@ -0,0 +1,275 @@
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+//
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+
+#ifndef MUDUO_BASE_SPSCQUEUE_H
+#define MUDUO_BASE_SPSCQUEUE_H
+
+#include "muduo/base/EventCount.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <assert.h>
+#include <sched.h>
+
+namespace muduo
+{
+
+namespace detail
+{
+const size_t kCacheLineSize = 64;
+
+inline size_t roundUpToPowerOfTwo(size_t n)
+{
+  size_t capacity = 1;
+  while (capacity < n)
+    capacity <<= 1;
+  return capacity;
+}
+
+// a while of busy waiting before blocking, good enough for hand-offs
+// between threads on different cores, cheap on a single core
+const int kSpinsBeforeBlocking = 64;
+}  // namespace detail
+
+///
+/// Bounded lock-free queue for exactly one producer and one consumer
+/// thread, a ring buffer with cache-line padded indices.
+///
+/// For each operation there are three variants:
+///  - put/take block when the queue is full/empty, like BoundedBlockingQueue,
+///  - spinPut/spinTake busy wait and never sleep,
+///  - tryPut/tryTake return false at once.
+/// putBatch/takeBatch move many items with a single index update.
+///
+/// Blocking and non-blocking variants can be mixed freely.
+///
+template<typename T>
+class SpscQueue : noncopyable
+{
+ public:
+  /// @c capacity is rounded up to a power of 2.
+  explicit SpscQueue(size_t capacity)
+    : mask_(detail::roundUpToPowerOfTwo(capacity) - 1),
+      slots_(new Slot[mask_ + 1]),
+      head_(0),
+      cachedTail_(0),
+      tail_(0),
+      cachedHead_(0)
+  {
+    assert(capacity > 0);
+  }
+
+  ~SpscQueue()
+  {
+    const size_t tail = tail_.load(std::memory_order_acquire);
+    for (size_t i = head_.load(std::memory_order_acquire); i != tail; ++i)
+    {
+      slots_[i & mask_].get()->~T();
+    }
+  }
+
+  size_t capacity() const { return mask_ + 1; }
+
+  /// Approximate when called from a third thread.
+  size_t size() const
+  {
+    return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+  }
+  bool empty() const { return size() == 0; }
+  bool full() const { return size() > mask_; }
+
+  // producer side
+
+  bool tryPut(const T& x) { return emplace(x); }
+  bool tryPut(T&& x) { return emplace(std::move(x)); }
+
+  void spinPut(const T& x) { while (!emplace(x)) sched_yield(); }
+  void spinPut(T&& x) { while (!emplace(std::move(x))) sched_yield(); }
+
+  void put(const T& x) { T copy(x); put(std::move(copy)); }
+  void put(T&& x)
+  {
+    for (int i = 0; i < detail::kSpinsBeforeBlocking; ++i)
+    {
+      if (emplace(std::move(x)))
+        return;
+    }
+    while (true)
+    {
+      int key = notFull_.prepareWait();
+      if (emplace(std::move(x)))
+      {
+        notFull_.cancelWait();
+        return;
+      }
+      notFull_.wait(key);
+    }
+  }
+
+  /// Puts as many of @c items[0, n) as fit, returns how many.
+  /// Never blocks.
+  size_t putBatch(const T* items, size_t n)
+  {
+    const size_t tail = tail_.load(std::memory_order_relaxed);
+    size_t room = capacity() - (tail - cachedHead_);
+    if (room < n)
+    {
+      cachedHead_ = head_.load(std::memory_order_acquire);
+      room = capacity() - (tail - cachedHead_);
+    }
+    n = std::min(n, room);
+    for (size_t i = 0; i < n; ++i)
+    {
+      new (slots_[(tail + i) & mask_].address()) T(items[i]);
+    }
+    if (n > 0)
+    {
+      tail_.store(tail + n, std::memory_order_release);
+      afterPut(tail);
+    }
+    return n;
+  }
+
+  // consumer side
+
+  bool tryTake(T* x) { return pop(x); }
+
+  T spinTake()
+  {
+    T x;
+    while (!pop(&x))
+      sched_yield();
+    return x;
+  }
+
+  T take()
+  {
+    T x;
+    for (int i = 0; i < detail::kSpinsBeforeBlocking; ++i)
+    {
+      if (pop(&x))
+        return x;
+    }
+    while (true)
+    {
+      int key = notEmpty_.prepareWait();
+      if (pop(&x))
+      {
+        notEmpty_.cancelWait();
+        return x;
+      }
+      notEmpty_.wait(key);
+    }
+  }
+
+  /// Takes up to @c maxItems into @c out, returns how many.
+  /// Never blocks.
+  size_t takeBatch(T* out, size_t maxItems)
+  {
+    const size_t head = head_.load(std::memory_order_relaxed);
+    size_t avail = cachedTail_ - head;
+    if (avail < maxItems)
+    {
+      cachedTail_ = tail_.load(std::memory_order_acquire);
+      avail = cachedTail_ - head;
+    }
+    size_t n = std::min(maxItems, avail);
+    for (size_t i = 0; i < n; ++i)
+    {
+      T* item = slots_[(head + i) & mask_].get();
+      out[i] = std::move(*item);
+      item->~T();
+    }
+    if (n > 0)
+    {
+      head_.store(head + n, std::memory_order_release);
+      afterTake(head);
+    }
+    return n;
+  }
+
+ private:
+  struct Slot
+  {
+    void* address() { return &storage; }
+    T* get() { return reinterpret_cast<T*>(&storage); }
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+  };
+
+  template<typename U>
+  bool emplace(U&& x)
+  {
+    const size_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail - cachedHead_ > mask_)
+    {
+      cachedHead_ = head_.load(std::memory_order_acquire);
+      if (tail - cachedHead_ > mask_)
+        return false;
+    }
+    new (slots_[tail & mask_].address()) T(std::forward<U>(x));
+    tail_.store(tail + 1, std::memory_order_release);
+    afterPut(tail);
+    return true;
+  }
+
+  bool pop(T* x)
+  {
+    const size_t head = head_.load(std::memory_order_relaxed);
+    if (head == cachedTail_)
+    {
+      cachedTail_ = tail_.load(std::memory_order_acquire);
+      if (head == cachedTail_)
+        return false;
+    }
+    T* item = slots_[head & mask_].get();
+    *x = std::move(*item);
+    item->~T();
+    head_.store(head + 1, std::memory_order_release);
+    afterTake(head);
+    return true;
+  }
+
+  // Only the put into an empty queue may find the consumer asleep,
+  // so the others skip the syscall, and the wakeup storm while a woken
+  // consumer waits for a CPU.  The fence pairs with prepareWait().
+  void afterPut(size_t oldTail)
+  {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (head_.load(std::memory_order_relaxed) == oldTail)
+      notEmpty_.notify();
+  }
+
+  void afterTake(size_t oldHead)
+  {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (tail_.load(std::memory_order_relaxed) - oldHead > mask_)
+      notFull_.notify();
+  }
+
+  typedef char Padding[detail::kCacheLineSize];
+
+  const size_t mask_;
+  const std::unique_ptr<Slot[]> slots_;
+  Padding pad0_;
+  // written by the consumer
+  std::atomic<size_t> head_;
+  size_t cachedTail_;
+  Padding pad1_;
+  // written by the producer
+  std::atomic<size_t> tail_;
+  size_t cachedHead_;
+  Padding pad2_;
+  EventCount notEmpty_;
+  EventCount notFull_;
+};
+
+}  // namespace muduo
+
+#endif  // MUDUO_BASE_SPSCQUEUE_H
@@ -0,0 +1,315 @@
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+//
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+
+#include "muduo/base/WorkStealingThreadPool.h"
+
+#include "muduo/base/Exception.h"
+
+#include <algorithm>
+
+#include <assert.h>
+#include <stdio.h>
+
+using namespace muduo;
+
+namespace
+{
+
+__thread WorkStealingThreadPool* t_currentPool = NULL;
+__thread size_t t_workerIndex = 0;
+
+}  // namespace
+
+struct WorkStealingThreadPool::Worker
+{
+  MutexLock mutex;
+  std::deque<Task> tasks GUARDED_BY(mutex);
+  std::unique_ptr<muduo::Thread> thread;
+};
+
+WorkStealingThreadPool::WorkStealingThreadPool(const string& nameArg)
+  : name_(nameArg),
+    maxQueueSize_(0),
+    running_(false),
+    nextWorker_(0),
+    pending_(0),
+    wakesInFlight_(0)
+{
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool()
+{
+  if (running_)
+  {
+    stop();
+  }
+}
+
+void WorkStealingThreadPool::start(int numThreads)
+{
+  assert(workers_.empty());
+  running_ = true;
+  // all queues exist before any thief looks at them
+  workers_.reserve(numThreads);
+  for (int i = 0; i < numThreads; ++i)
+  {
+    workers_.emplace_back(new Worker);
+  }
+  for (int i = 0; i < numThreads; ++i)
+  {
+    char id[32];
+    snprintf(id, sizeof id, "%d", i+1);
+    workers_[i]->thread.reset(new muduo::Thread(
+          std::bind(&WorkStealingThreadPool::runInThread, this, i), name_+id));
+    workers_[i]->thread->start();
+  }
+  if (numThreads == 0 && threadInitCallback_)
+  {
+    threadInitCallback_();
+  }
+}
+
+void WorkStealingThreadPool::stop()
+{
+  running_ = false;
+  workAvailable_.notifyAll();
+  spaceAvailable_.notifyAll();
+  for (auto& worker : workers_)
+  {
+    worker->thread->join();
+  }
+}
+
+size_t WorkStealingThreadPool::queueSize() const
+{
+  return static_cast<size_t>(std::max(pending_.load(), 0));
+}
+
+void WorkStealingThreadPool::run(Task task)
+{
+  if (workers_.empty())
+  {
+    task();
+    return;
+  }
+
+  reserve(1);
+  size_t index = t_currentPool == this
+      ? t_workerIndex
+      : nextWorker_.fetch_add(1, std::memory_order_relaxed) % workers_.size();
+  Worker& worker = *workers_[index];
+  {
+  MutexLockGuard lock(worker.mutex);
+  worker.tasks.push_back(std::move(task));
+  }
+  notifyWorkers(1);
+}
+
+void WorkStealingThreadPool::run(std::vector<Task>* tasks)
+{
+  if (tasks->empty())
+    return;
+  if (workers_.empty())
+  {
+    for (Task& task : *tasks)
+    {
+      task();
+    }
+    tasks->clear();
+    return;
+  }
+
+  reserve(static_cast<int>(tasks->size()));
+  const size_t numWorkers = workers_.size();
+  const size_t chunks = std::min(numWorkers, tasks->size());
+  size_t first = nextWorker_.fetch_add(chunks, std::memory_order_relaxed);
+  size_t begin = 0;
+  for (size_t c = 0; c < chunks; ++c)
+  {
+    size_t end = tasks->size() * (c + 1) / chunks;
+    Worker& worker = *workers_[(first + c) % numWorkers];
+    MutexLockGuard lock(worker.mutex);
+    for (size_t i = begin; i < end; ++i)
+    {
+      worker.tasks.push_back(std::move((*tasks)[i]));
+    }
+    begin = end;
+  }
+  tasks->clear();
+  notifyWorkers(static_cast<int>(chunks));
+}
+
+// Counts tasks before they are queued, so a worker that sees
+// pending_ == 0 may safely park.
+void WorkStealingThreadPool::reserve(int n)
+{
+  if (maxQueueSize_ == 0)
+  {
+    pending_.fetch_add(n);
+    return;
+  }
+
+  const int maxSize = static_cast<int>(maxQueueSize_);
+  while (true)
+  {
+    int pending = pending_.load();
+    if (pending < maxSize || !running_)
+    {
+      if (pending_.compare_exchange_weak(pending, pending + n))
+        return;
+      continue;
+    }
+    int key = spaceAvailable_.prepareWait();
+    if (pending_.load() < maxSize || !running_)
+    {
+      spaceAvailable_.cancelWait();
+    }
+    else
+    {
+      spaceAvailable_.wait(key);
+    }
+  }
+}
+
+bool WorkStealingThreadPool::takeLocal(size_t index, Task* task)
+{
+  Worker& worker = *workers_[index];
+  MutexLockGuard lock(worker.mutex);
+  if (worker.tasks.empty())
+    return false;
+  *task = std::move(worker.tasks.front());
+  worker.tasks.pop_front();
+  return true;
+}
+
+// Takes half of the first non-empty queue found, so a burst that landed
+// on one worker spreads out in a few steals.
+bool WorkStealingThreadPool::steal(size_t thief, Task* task)
+{
+  const size_t numWorkers = workers_.size();
+  std::vector<Task> rest;
+  bool found = false;
+  for (size_t k = 1; k < numWorkers && !found; ++k)
+  {
+    Worker& victim = *workers_[(thief + k) % numWorkers];
+    MutexLockGuard lock(victim.mutex);
+    if (victim.tasks.empty())
+      continue;
+
+    // from the front, to keep the victim's FIFO order
+    size_t n = (victim.tasks.size() + 1) / 2;
+    *task = std::move(victim.tasks.front());
+    victim.tasks.pop_front();
+    for (size_t i = 1; i < n; ++i)
+    {
+      rest.push_back(std::move(victim.tasks.front()));
+      victim.tasks.pop_front();
+    }
+    found = true;
+  }
+
+  if (!rest.empty())
+  {
+    Worker& self = *workers_[thief];
+    MutexLockGuard lock(self.mutex);
+    for (Task& t : rest)
+    {
+      self.tasks.push_back(std::move(t));
+    }
+  }
+  return found;
+}
+
+void WorkStealingThreadPool::taken()
+{
+  // leaves the rest to a sleeping worker, if no one is on the way
+  if (pending_.fetch_sub(1) > 1)
+  {
+    notifyWorkers(1);
+  }
+  if (maxQueueSize_ > 0)
+  {
+    spaceAvailable_.notify();
+  }
+}
+
+void WorkStealingThreadPool::park()
+{
+  int key = workAvailable_.prepareWait();
+  if (pending_.load() > 0 || !running_)
+  {
+    workAvailable_.cancelWait();
+  }
+  else
+  {
+    workAvailable_.wait(key);
+    // maybe not the one woken up, then a spare wakeup may happen
+    int inFlight = wakesInFlight_.load();
+    while (inFlight > 0 && !wakesInFlight_.compare_exchange_weak(inFlight, inFlight - 1))
+    {
+    }
+  }
+}
+
+// Woken workers will find the work, or hand it on from taken(),
+// so there is no need to wake more until they are running.  This saves
+// a syscall per task while woken workers wait for a CPU.
+void WorkStealingThreadPool::notifyWorkers(int n)
+{
+  if (wakesInFlight_.load() > 0)
+    return;
+  // counted before the wakeup, the woken may run at once
+  wakesInFlight_.fetch_add(n);
+  int woken = workAvailable_.notify(n);
+  if (woken < n)
+  {
+    wakesInFlight_.fetch_sub(n - woken);
+  }
+}
+
+void WorkStealingThreadPool::runInThread(size_t index)
+{
+  t_currentPool = this;
+  t_workerIndex = index;
+  try
+  {
+    if (threadInitCallback_)
+    {
+      threadInitCallback_();
+    }
+    while (running_)
+    {
+      Task task;
+      if (takeLocal(index, &task) || steal(index, &task))
+      {
+        taken();
+        task();
+      }
+      else
+      {
+        park();
+      }
+    }
+  }
+  catch (const Exception& ex)
+  {
+    fprintf(stderr, "exception caught in WorkStealingThreadPool %s\n", name_.c_str());
+    fprintf(stderr, "reason: %s\n", ex.what());
+    fprintf(stderr, "stack trace: %s\n", ex.stackTrace());
+    abort();
+  }
+  catch (const std::exception& ex)
+  {
+    fprintf(stderr, "exception caught in WorkStealingThreadPool %s\n", name_.c_str());
+    fprintf(stderr, "reason: %s\n", ex.what());
+    abort();
+  }
+  catch (...)
+  {
+    fprintf(stderr, "unknown exception caught in WorkStealingThreadPool %s\n", name_.c_str());
+    throw; // rethrow
+  }
+  t_currentPool = NULL;
+}
@@ -0,0 +1,87 @@
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+//
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+
+#ifndef MUDUO_BASE_WORKSTEALINGTHREADPOOL_H
+#define MUDUO_BASE_WORKSTEALINGTHREADPOOL_H
+
+#include "muduo/base/EventCount.h"
+#include "muduo/base/Mutex.h"
+#include "muduo/base/Thread.h"
+#include "muduo/base/Types.h"
+
+#include <atomic>
+#include <deque>
+#include <vector>
+
+namespace muduo
+{
+
+///
+/// Fixed size thread pool with one task queue per worker.
+///
+/// A drop-in for ThreadPool when many threads submit small tasks.
+/// Submissions are spread over the workers' queues, tasks submitted from
+/// a worker go to its own queue, and a worker that runs dry steals from
+/// the others before it parks on a futex.  Tasks run in roughly FIFO
+/// order per queue, with no global order.
+///
+class WorkStealingThreadPool : noncopyable
+{
+ public:
+  typedef std::function<void ()> Task;
+
+  explicit WorkStealingThreadPool(const string& nameArg = string("WorkStealingThreadPool"));
+  ~WorkStealingThreadPool();
+
+  // Must be called before start().
+  void setMaxQueueSize(int maxSize) { maxQueueSize_ = maxSize; }
+  void setThreadInitCallback(const Task& cb)
+  { threadInitCallback_ = cb; }
+
+  void start(int numThreads);
+  /// Pending tasks are dropped, like ThreadPool::stop().
+  void stop();
+
+  const string& name() const
+  { return name_; }
+
+  /// Total number of pending tasks in all queues.
+  size_t queueSize() const;
+
+  // Could block if maxQueueSize > 0
+  void run(Task task);
+
+  /// Submits all of @c tasks, with one lock and one wakeup per worker
+  /// instead of one per task.  Leaves @c tasks empty.
+  /// Could block if maxQueueSize > 0, but may overshoot it by one batch.
+  void run(std::vector<Task>* tasks);
+
+ private:
+  struct Worker;
+
+  void runInThread(size_t index);
+  bool takeLocal(size_t index, Task* task);
+  bool steal(size_t thief, Task* task);
+  void taken();
+  void park();
+  void notifyWorkers(int n);
+  void reserve(int n);
+
+  string name_;
+  Task threadInitCallback_;
+  std::vector<std::unique_ptr<Worker>> workers_;
+  size_t maxQueueSize_;
+  std::atomic<bool> running_;
+  std::atomic<size_t> nextWorker_;
+
+  std::atomic<int> pending_;
+  std::atomic<int> wakesInFlight_;
+  EventCount workAvailable_;
+  EventCount spaceAvailable_;
+};
+
+}  // namespace muduo
+
+#endif  // MUDUO_BASE_WORKSTEALINGTHREADPOOL_H
@@ -0,0 +1,88 @@
+// Throughput of AsyncLogging::append() from many threads,
+// with per-thread staging buffers and with a single mutex.
+//
+// Usage: asynclogging_bench [max_threads] [lines_per_thread]
+
+#include "muduo/base/AsyncLogging.h"
+#include "muduo/base/Thread.h"
+#include "muduo/base/Timestamp.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+using muduo::Timestamp;
+
+void logLines(muduo::AsyncLogging* log, int lines)
+{
+  char line[128];
+  for (int i = 0; i < lines; ++i)
+  {
+    int len = snprintf(line, sizeof line,
+                       "20261019 03:05:19.346320 12345 INFO Hello 0123456789 "
+                       "abcdefghijklmnopqrstuvwxyz %d - bench.cc:28\n", i);
+    log->append(line, len);
+  }
+}
+
+double bench(size_t stagingSize, int numThreads, int lines)
+{
+  muduo::AsyncLogging log("asynclogging_bench", 1000*1000*1000);
+  log.setStagingSize(stagingSize);
+  log.start();
+  std::vector<std::unique_ptr<muduo::Thread>> threads;
+  Timestamp start(Timestamp::now());
+  for (int t = 0; t < numThreads; ++t)
+  {
+    threads.emplace_back(new muduo::Thread([&log, lines] { logLines(&log, lines); }));
+    threads.back()->start();
+  }
+  for (auto& thr : threads)
+  {
+    thr->join();
+  }
+  double seconds = timeDifference(Timestamp::now(), start);
+  log.stop();
+  return static_cast<double>(numThreads) * lines / seconds / 1e6;
+}
+
+void removeLogs(const char* dir)
+{
+  DIR* d = ::opendir(dir);
+  while (struct dirent* entry = ::readdir(d))
+  {
+    if (entry->d_name[0] != '.')
+      ::unlink((std::string(dir) + "/" + entry->d_name).c_str());
+  }
+  ::closedir(d);
+}
+
+int main(int argc, char* argv[])
+{
+  int maxThreads = argc > 1 ? atoi(argv[1]) : 8;
+  int lines = argc > 2 ? atoi(argv[2]) : 200000;
+
+  char dir[] = "/tmp/asynclogging_bench.XXXXXX";
+  if (::mkdtemp(dir) == NULL || ::chdir(dir) != 0)
+  {
+    perror("mkdtemp");
+    return 1;
+  }
+
+  printf("%d lines per thread, M lines/s\n", lines);
+  printf("threads      mutex    staging\n");
+  for (int n = 1; n <= maxThreads; n *= 2)
+  {
+    double locked = bench(0, n, lines);
+    removeLogs(dir);
+    double staged = bench(muduo::AsyncLogging::kDefaultStagingSize, n, lines);
+    removeLogs(dir);
+    printf("%7d %10.2f %10.2f\n", n, locked, staged);
+  }
+  ::rmdir(dir);
+}
@@ -0,0 +1,128 @@
+#include "muduo/base/AsyncLogging.h"
+#include "muduo/base/Thread.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+//#define BOOST_TEST_MODULE AsyncLoggingTest
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "muduo/base/tests/TempDir.h"
+
+const int kThreads = 4;
+const int kLines = 50000;
+
+void logLines(muduo::AsyncLogging* log, int thread, int begin, int end)
+{
+  char line[64];
+  for (int i = begin; i < end; ++i)
+  {
+    int len = snprintf(line, sizeof line, "%d %d\n", thread, i);
+    log->append(line, len);
+  }
+}
+
+std::string readLogs(const char* dir)
+{
+  std::string content;
+  DIR* d = ::opendir(dir);
+  while (struct dirent* entry = ::readdir(d))
+  {
+    std::string name = entry->d_name;
+    if (name[0] == '.')
+      continue;
+    std::string path = std::string(dir) + "/" + name;
+    FILE* fp = ::fopen(path.c_str(), "r");
+    char buf[65536];
+    size_t n;
+    while ((n = ::fread(buf, 1, sizeof buf, fp)) > 0)
+      content.append(buf, n);
+    ::fclose(fp);
+    ::unlink(path.c_str());
+  }
+  ::closedir(d);
+  return content;
+}
+
+// every line exactly once, the lines of each thread in order
+void check(const std::string& content, const std::vector<int>& lines)
+{
+  const int threads = static_cast<int>(lines.size());
+  std::vector<int> next(lines.size(), 0);
+  int wrong = 0;
+  const char* p = content.c_str();
+  while (*p != '\0')
+  {
+    char* end;
+    long thread = strtol(p, &end, 10);
+    long i = strtol(end, &end, 10);
+    if (*end != '\n')
+      break;
+    if (thread < 0 || thread >= threads || next[thread] != i)
+      ++wrong;
+    else
+      ++next[thread];
+    p = end + 1;
+  }
+  BOOST_CHECK(wrong == 0);
+  BOOST_CHECK(*p == '\0');
+  for (int t = 0; t < threads; ++t)
+  {
+    BOOST_CHECK(next[t] == lines[t]);
+  }
+}
+
+void checkThreads(const char* dir, size_t stagingSize,
+                  bool useMmap = false, bool syncOnFlush = false)
+{
+  {
+    muduo::AsyncLogging log("asynclogging_unittest", 1000*1000*1000, 1);
+    log.setStagingSize(stagingSize);
+    log.setUseMmap(useMmap, syncOnFlush);
+    log.start();
+    std::vector<std::unique_ptr<muduo::Thread>> threads;
+    for (int t = 0; t < kThreads; ++t)
+    {
+      threads.emplace_back(new muduo::Thread([&log, t]
+      {
+        logLines(&log, t, 0, kLines);
+      }));
+      threads.back()->start();
+    }
+    for (auto& thr : threads)
+    {
+      thr->join();
+    }
+    // short-lived threads, their staging buffers are retired
+    for (int round = 0; round < 10; ++round)
+    {
+      muduo::Thread thr([&log, round]
+      {
+        logLines(&log, kThreads, round * 10, round * 10 + 10);
+      });
+      thr.start();
+      thr.join();
+    }
+    log.stop();
+  }
+  std::vector<int> lines(kThreads, kLines);
+  lines.push_back(100);
+  check(readLogs(dir), lines);
+}
+
+BOOST_FIXTURE_TEST_CASE(testThreads, TempDir)
+{
+  checkThreads(dir, 0);
+  checkThreads(dir, 4096);  // hands over often
+  checkThreads(dir, muduo::AsyncLogging::kDefaultStagingSize);
+  checkThreads(dir, muduo::AsyncLogging::kDefaultStagingSize, true);
+  checkThreads(dir, muduo::AsyncLogging::kDefaultStagingSize, true, true);
+}
@@ -0,0 +1,48 @@
+// Cost on the calling thread of LOG_TRACE against LOG_BIN_TRACE,
+// with an output that drops everything.
+//
+// Usage: binarylogging_bench [lines]
+
+#include "muduo/base/BinaryLogging.h"
+#include "muduo/base/Timestamp.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using muduo::Logger;
+using muduo::Timestamp;
+
+int64_t g_total = 0;
+
+void dummyOutput(const char*, int len)
+{
+  g_total += len;
+}
+
+int main(int argc, char* argv[])
+{
+  int lines = argc > 1 ? atoi(argv[1]) : 1000000;
+  Logger::setOutput(dummyOutput);
+  Logger::setLogLevel(Logger::TRACE);
+  double elapsed = 1.0;
+
+  Timestamp start(Timestamp::now());
+  for (int i = 0; i < lines; ++i)
+  {
+    LOG_TRACE << "read " << i << " bytes from fd " << 42 << " in " << 0.000123 * i << " s";
+  }
+  elapsed = timeDifference(Timestamp::now(), start);
+  int64_t textBytes = g_total;
+  printf("LOG_TRACE     %6.0f ns/line %5.1f bytes/line\n",
+         elapsed * 1e9 / lines, static_cast<double>(textBytes) / lines);
+
+  g_total = 0;
+  start = Timestamp::now();
+  for (int i = 0; i < lines; ++i)
+  {
+    LOG_BIN_TRACE << "read " << i << " bytes from fd " << 42 << " in " << 0.000123 * i << " s";
+  }
+  elapsed = timeDifference(Timestamp::now(), start);
+  printf("LOG_BIN_TRACE %6.0f ns/line %5.1f bytes/line\n",
+         elapsed * 1e9 / lines, static_cast<double>(g_total) / lines);
+}
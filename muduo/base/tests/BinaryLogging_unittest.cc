@@ -0,0 +1,196 @@
+#include "muduo/base/BinaryLogging.h"
+#include "muduo/base/LogFile.h"
+
+#include <memory>
+#include <string>
+
+#include <dirent.h>
+#include <errno.h>
+#include <stdio.h>
+#include <unistd.h>
+
+//#define BOOST_TEST_MODULE BinaryLoggingTest
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "muduo/base/tests/TempDir.h"
+
+using muduo::BinaryLogDecoder;
+using muduo::LogFile;
+using muduo::Logger;
+
+std::string g_output;
+
+void output(const char* msg, int len)
+{
+  g_output.append(msg, len);
+}
+
+struct OutputFixture
+{
+  OutputFixture() { Logger::setOutput(output); }
+};
+
+BOOST_GLOBAL_FIXTURE(OutputFixture);
+
+// skips the timestamp, which differs
+std::string afterTime(const std::string& line)
+{
+  return line.size() > 26 ? line.substr(26) : line;
+}
+
+std::string decode(const std::string& data)
+{
+  BinaryLogDecoder decoder;
+  BOOST_CHECK(decoder.addSites(data));
+  std::string text;
+  BOOST_CHECK(decoder.decode(data, &text));
+  return text;
+}
+
+// the text and the binary statement on the same line, for the same file:line
+#define BOTH(LOG, ARGS) \
+  do { \
+    g_output.clear(); LOG_##LOG ARGS; std::string text = g_output; \
+    g_output.clear(); LOG_BIN_##LOG ARGS; std::string binary = g_output; \
+    std::string decoded = decode(binary); \
+    BOOST_CHECK_EQUAL(afterTime(decoded), afterTime(text)); \
+  } while (0)
+
+BOOST_AUTO_TEST_CASE(testSameText)
+{
+  int n = -12345;
+  unsigned long long big = 18446744073709551615ULL;
+  std::string str("a string");
+  const void* p = &n;
+
+  BOTH(INFO, << "ints " << n << ' ' << 0 << ' ' << big << ' ' << static_cast<short>(-3));
+  BOTH(INFO, << "doubles " << 3.14159 << ' ' << -1e100 << ' ' << 0.1f);
+  BOTH(WARN, << "chars " << 'x' << true << false << str << muduo::StringPiece("piece"));
+  BOTH(ERROR, << "pointer " << p << static_cast<const char*>(NULL));
+  BOTH(ERROR, << "");
+
+  Logger::setLogLevel(Logger::TRACE);
+  BOTH(TRACE, << "trace " << n);
+  BOTH(DEBUG, << "debug " << n);
+  Logger::setLogLevel(Logger::INFO);
+
+  errno = EAGAIN;
+  BOTH(SYSERR, << "syserr");
+  errno = 0;
+}
+
+BOOST_AUTO_TEST_CASE(testCompact)
+{
+  g_output.clear();
+  for (int i = 0; i < 100; ++i)
+  {
+    LOG_INFO << "request " << i << " took " << 1.5 << " ms, " << 1000000 + i << " bytes";
+  }
+  size_t text = g_output.size();
+  g_output.clear();
+  for (int i = 0; i < 100; ++i)
+  {
+    LOG_BIN_INFO << "request " << i << " took " << 1.5 << " ms, " << 1000000 + i << " bytes";
+  }
+  size_t binary = g_output.size();
+  BOOST_CHECK(binary * 3 < text * 2);
+}
+
+BOOST_AUTO_TEST_CASE(testMixed)
+{
+  g_output.clear();
+  LOG_INFO << "text line";
+  for (int i = 0; i < 3; ++i)
+  {
+    LOG_BIN_INFO << "binary " << i << "\nwith newline";
+  }
+  LOG_INFO << "another text line";
+  std::string decoded = decode(g_output);
+  int lines = 0;
+  for (char c : decoded)
+    lines += c == '\n';
+  BOOST_CHECK(lines == 2 + 3 * 2);
+  BOOST_CHECK(decoded.find("text line - BinaryLogging_unittest.cc") != std::string::npos);
+  BOOST_CHECK(decoded.find("binary 2\nwith newline - BinaryLogging_unittest.cc") != std::string::npos);
+  BOOST_CHECK(decoded.find("another text line") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(testSitesFirst)
+{
+  // the site record is only written the first time
+  for (int i = 0; i < 2; ++i)
+  {
+    g_output.clear();
+    LOG_BIN_INFO << "site " << i;
+  }
+  std::string second = g_output;
+
+  BinaryLogDecoder decoder;
+  std::string text;
+  BOOST_CHECK(decoder.decode(second, &text));
+  BOOST_CHECK(text.find("site 1 - <unknown site") != std::string::npos);
+}
+
+std::unique_ptr<LogFile> g_logFile;
+
+void outputToFile(const char* msg, int len)
+{
+  g_logFile->append(msg, len);
+}
+
+std::string readFileIn(const char* dir)
+{
+  std::string content;
+  DIR* d = ::opendir(dir);
+  while (struct dirent* entry = ::readdir(d))
+  {
+    if (entry->d_name[0] == '.')
+      continue;
+    std::string name = std::string(dir) + "/" + entry->d_name;
+    FILE* fp = ::fopen(name.c_str(), "r");
+    char buf[4096];
+    size_t n;
+    while (fp && (n = ::fread(buf, 1, sizeof buf, fp)) > 0)
+      content.append(buf, n);
+    if (fp)
+      ::fclose(fp);
+    ::unlink(name.c_str());
+  }
+  ::closedir(d);
+  return content;
+}
+
+BOOST_FIXTURE_TEST_CASE(testNewFile, TempDir)
+{
+  // the site is reached before the file is opened
+  for (int i = 0; i < 2; ++i)
+  {
+    if (i == 1)
+    {
+      g_logFile.reset(new LogFile("binarylogging_unittest", 1024 * 1024, false));
+      Logger::setOutput(outputToFile);
+    }
+    LOG_BIN_INFO << "file " << i;
+  }
+  g_logFile.reset();
+  Logger::setOutput(output);
+
+  std::string decoded = decode(readFileIn(dir));
+  BOOST_CHECK(decoded.find("file 1 - BinaryLogging_unittest.cc") != std::string::npos);
+  BOOST_CHECK(decoded.find("file 0") == std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(testCorrupted)
+{
+  g_output.clear();
+  LOG_BIN_INFO << "a long enough string " << 42;
+  std::string data = g_output;
+  BinaryLogDecoder decoder;
+  std::string text;
+  BOOST_CHECK(!decoder.decode(data.substr(0, data.size() - 5), &text));
+  data[data.size() - 2] = 99;  // a bad tag
+  text.clear();
+  BOOST_CHECK(!decoder.decode(data, &text));
+}
@@ -0,0 +1,158 @@
+#include "muduo/base/InlineFunction.h"
+
+#include <functional>
+#include <memory>
+#include <string>
+
+#include <stdlib.h>
+
+//#define BOOST_TEST_MODULE InlineFunctionTest
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+int g_allocations = 0;
+
+void* operator new(size_t size)
+{
+  ++g_allocations;
+  void* p = malloc(size);
+  if (p == NULL)
+    throw std::bad_alloc();
+  return p;
+}
+
+void operator delete(void* p) noexcept
+{
+  free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+  free(p);
+}
+
+typedef muduo::InlineFunction<void()> Functor;
+
+int g_calls = 0;
+
+void increase()
+{
+  ++g_calls;
+}
+
+struct Connection
+{
+  void send(const std::string& message) { sent += message.size(); }
+  size_t sent = 0;
+};
+
+struct Counted
+{
+  static int alive;
+  Counted() { ++alive; }
+  Counted(const Counted&) { ++alive; }
+  Counted(Counted&&) noexcept { ++alive; }
+  ~Counted() { --alive; }
+  void operator()() const { ++g_calls; }
+};
+int Counted::alive = 0;
+
+BOOST_AUTO_TEST_CASE(testEmpty)
+{
+  Functor f;
+  BOOST_CHECK(!f);
+  Functor g(nullptr);
+  BOOST_CHECK(!g);
+  void (*null)() = NULL;
+  Functor h(null);
+  BOOST_CHECK(!h);
+  std::function<void()> empty;
+  Functor k(empty);
+  BOOST_CHECK(!k);
+  Functor m(increase);
+  BOOST_CHECK(m);
+  m = nullptr;
+  BOOST_CHECK(!m);
+}
+
+BOOST_AUTO_TEST_CASE(testInline)
+{
+  std::shared_ptr<Connection> conn(new Connection);
+  std::string message("a message that does not fit in SSO");
+  g_calls = 0;
+
+  int before = g_allocations;
+  {
+    Functor f(increase);
+    f();
+    Functor g(std::bind(&Connection::send, conn, message));
+    g();
+    Functor h([conn] { conn->send("x"); });
+    h();
+    Functor moved(std::move(g));
+    BOOST_CHECK(!g);
+    moved();
+  }
+  // only the copy of the message bound into g
+  BOOST_CHECK(g_allocations - before == 1);
+  BOOST_CHECK(g_calls == 1);
+  BOOST_CHECK(conn->sent == 2 * message.size() + 1);
+  BOOST_CHECK(conn.use_count() == 1);
+}
+
+BOOST_AUTO_TEST_CASE(testHeap)
+{
+  char big[128] = "big";
+  g_calls = 0;
+  int before = g_allocations;
+  {
+    Functor f([big] { g_calls += big[0] == 'b'; });
+    BOOST_CHECK(g_allocations - before == 1);
+    Functor g(std::move(f));
+    Functor h;
+    h = std::move(g);
+    BOOST_CHECK(g_allocations - before == 1);
+    h();
+  }
+  BOOST_CHECK(g_calls == 1);
+}
+
+BOOST_AUTO_TEST_CASE(testLifetime)
+{
+  g_calls = 0;
+  {
+    Functor f((Counted()));
+    BOOST_CHECK(Counted::alive == 1);
+    Functor g(std::move(f));
+    BOOST_CHECK(Counted::alive == 1);
+    g();
+    Functor h(increase);
+    h.swap(g);
+    BOOST_CHECK(Counted::alive == 1);
+    g();
+    g = std::move(h);
+    BOOST_CHECK(Counted::alive == 1);
+  }
+  BOOST_CHECK(Counted::alive == 0);
+  BOOST_CHECK(g_calls == 2);
+}
+
+BOOST_AUTO_TEST_CASE(testMoveOnly)
+{
+  std::unique_ptr<int> p(new int(42));
+  int result = 0;
+  muduo::InlineFunction<int(int)> f(
+      std::bind([](const std::unique_ptr<int>& x, int y) { return *x + y; },
+                std::move(p), std::placeholders::_1));
+  result = f(1);
+  BOOST_CHECK(result == 43);
+
+  // a const& parameter is passed through, not copied
+  muduo::InlineFunction<size_t(const std::string&), 16> length(
+      [](const std::string& s) { return s.size(); });
+  std::string s(100, 'x');
+  int before = g_allocations;
+  BOOST_CHECK(length(s) == 100);
+  BOOST_CHECK(g_allocations == before);
+}
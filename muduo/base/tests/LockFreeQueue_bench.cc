@@ -0,0 +1,83 @@
+// Hand-off throughput of small items between two threads:
+// BoundedBlockingQueue against SpscQueue and MpmcQueue.
+//
+// Usage: lockfreequeue_bench [items]
+
+#include "muduo/base/BoundedBlockingQueue.h"
+#include "muduo/base/MpmcQueue.h"
+#include "muduo/base/SpscQueue.h"
+#include "muduo/base/Thread.h"
+#include "muduo/base/Timestamp.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using muduo::Timestamp;
+
+const int kCapacity = 4096;
+const int kBatch = 64;
+
+template<typename Put, typename Take>
+void bench(const char* name, int items, Put put, Take take)
+{
+  Timestamp start(Timestamp::now());
+  muduo::Thread producer([items, &put]
+  {
+    for (int64_t i = 0; i < items; ++i)
+      put(i);
+  });
+  producer.start();
+  int64_t sum = 0;
+  for (int i = 0; i < items; ++i)
+  {
+    sum += take();
+  }
+  producer.join();
+  double seconds = timeDifference(Timestamp::now(), start);
+  if (sum != static_cast<int64_t>(items) * (items - 1) / 2)
+    abort();
+  printf("%-28s %8.2f M items/s\n", name, items / seconds / 1e6);
+}
+
+int main(int argc, char* argv[])
+{
+  int items = argc > 1 ? atoi(argv[1]) : 10000000;
+  printf("%d items\n", items);
+
+  {
+    muduo::BoundedBlockingQueue<int64_t> queue(kCapacity);
+    bench("BoundedBlockingQueue", items,
+          [&queue](int64_t x) { queue.put(x); },
+          [&queue] { return queue.take(); });
+  }
+  {
+    muduo::SpscQueue<int64_t> queue(kCapacity);
+    bench("SpscQueue put/take", items,
+          [&queue](int64_t x) { queue.put(x); },
+          [&queue] { return queue.take(); });
+  }
+  {
+    muduo::SpscQueue<int64_t> queue(kCapacity);
+    int64_t out[kBatch];
+    size_t n = 0, next = 0;
+    bench("SpscQueue spinPut/takeBatch", items,
+          [&queue](int64_t x) { queue.spinPut(x); },
+          [&]
+          {
+            while (next == n)
+            {
+              n = queue.takeBatch(out, kBatch);
+              next = 0;
+              if (n == 0)
+                sched_yield();
+            }
+            return out[next++];
+          });
+  }
+  {
+    muduo::MpmcQueue<int64_t> queue(kCapacity);
+    bench("MpmcQueue put/take", items,
+          [&queue](int64_t x) { queue.put(x); },
+          [&queue] { return queue.take(); });
+  }
+}
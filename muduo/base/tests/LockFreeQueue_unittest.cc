@@ -0,0 +1,197 @@
+#include "muduo/base/MpmcQueue.h"
+#include "muduo/base/SpscQueue.h"
+#include "muduo/base/Thread.h"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+//#define BOOST_TEST_MODULE LockFreeQueueTest
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+const int kItems = 1000000;
+
+template<typename Queue>
+void checkTry()
+{
+  Queue queue(3);
+  BOOST_CHECK(queue.capacity() == 4);
+  BOOST_CHECK(queue.empty());
+  int x = 0;
+  BOOST_CHECK(!queue.tryTake(&x));
+  for (int i = 0; i < 4; ++i)
+  {
+    BOOST_CHECK(queue.tryPut(i));
+  }
+  BOOST_CHECK(queue.full());
+  BOOST_CHECK(!queue.tryPut(4));
+  BOOST_CHECK(queue.tryTake(&x) && x == 0);
+  BOOST_CHECK(queue.tryPut(4));
+  for (int i = 1; i <= 4; ++i)
+  {
+    BOOST_CHECK(queue.tryTake(&x) && x == i);
+  }
+  BOOST_CHECK(queue.empty());
+
+  int items[] = { 10, 11, 12, 13, 14, 15 };
+  BOOST_CHECK(queue.putBatch(items, 6) == 4);
+  int out[8];
+  BOOST_CHECK(queue.takeBatch(out, 8) == 4);
+  BOOST_CHECK(out[0] == 10 && out[3] == 13);
+}
+
+// elements that are still queued are destroyed with the queue
+template<typename Queue>
+void checkOwnership()
+{
+  std::shared_ptr<int> p(new int(1));
+  {
+    Queue queue(8);
+    queue.put(p);
+    queue.put(p);
+    std::shared_ptr<int> q;
+    BOOST_CHECK(queue.tryTake(&q) && q == p);
+    BOOST_CHECK(p.use_count() == 3);
+  }
+  BOOST_CHECK(p.use_count() == 1);
+
+  {
+    Queue queue(8);
+    queue.put(std::shared_ptr<int>(new int(2)));
+    std::shared_ptr<int> q = queue.take();
+    BOOST_CHECK(q && *q == 2 && q.use_count() == 1);
+  }
+}
+
+template<typename Take>
+void checkOrder(Take take)
+{
+  int64_t expected = 0;
+  int64_t wrong = 0;
+  for (int i = 0; i < kItems; ++i)
+  {
+    if (take() != expected++)
+      ++wrong;
+  }
+  BOOST_CHECK(wrong == 0);
+}
+
+BOOST_AUTO_TEST_CASE(testSpscOrder)
+{
+  muduo::SpscQueue<int64_t> queue(1024);
+  // blocking put/take
+  muduo::Thread producer([&queue]
+  {
+    for (int64_t i = 0; i < kItems; ++i)
+      queue.put(i);
+  });
+  producer.start();
+  checkOrder([&queue] { return queue.take(); });
+  producer.join();
+
+  // spinning put, batched take
+  muduo::Thread spinner([&queue]
+  {
+    for (int64_t i = 0; i < kItems; ++i)
+      queue.spinPut(i);
+  });
+  spinner.start();
+  int64_t buf[100];
+  size_t n = 0, next = 0;
+  checkOrder([&]
+  {
+    while (next == n)
+    {
+      n = queue.takeBatch(buf, 100);
+      next = 0;
+    }
+    return buf[next++];
+  });
+  spinner.join();
+  BOOST_CHECK(queue.empty());
+}
+
+void checkMpmc(int producers, int consumers)
+{
+  muduo::MpmcQueue<int64_t> queue(256);
+  const int64_t perProducer = kItems / producers;
+  std::vector<std::atomic<int>> seen(static_cast<size_t>(perProducer * producers));
+  std::atomic<int64_t> taken(0);
+  std::vector<std::unique_ptr<muduo::Thread>> threads;
+  for (int p = 0; p < producers; ++p)
+  {
+    threads.emplace_back(new muduo::Thread([&queue, p, perProducer]
+    {
+      for (int64_t i = 0; i < perProducer; ++i)
+      {
+        int64_t item = p * perProducer + i;
+        if (i % 2)
+          queue.put(item);
+        else
+          queue.spinPut(item);
+      }
+    }));
+  }
+  for (int c = 0; c < consumers; ++c)
+  {
+    threads.emplace_back(new muduo::Thread([&]
+    {
+      while (true)
+      {
+        int64_t item = queue.take();
+        if (item < 0)
+          break;
+        seen[static_cast<size_t>(item)].fetch_add(1);
+        taken.fetch_add(1);
+      }
+    }));
+  }
+  for (auto& thr : threads)
+  {
+    thr->start();
+  }
+  for (int p = 0; p < producers; ++p)
+  {
+    threads[p]->join();
+  }
+  for (int c = 0; c < consumers; ++c)
+  {
+    queue.put(-1);
+  }
+  for (int c = 0; c < consumers; ++c)
+  {
+    threads[producers + c]->join();
+  }
+
+  BOOST_CHECK(taken.load() == perProducer * producers);
+  int wrong = 0;
+  for (const auto& count : seen)
+  {
+    if (count.load() != 1)
+      ++wrong;
+  }
+  BOOST_CHECK(wrong == 0);
+  BOOST_CHECK(queue.empty());
+}
+
+BOOST_AUTO_TEST_CASE(testTry)
+{
+  checkTry<muduo::SpscQueue<int>>();
+  checkTry<muduo::MpmcQueue<int>>();
+}
+
+BOOST_AUTO_TEST_CASE(testOwnership)
+{
+  checkOwnership<muduo::SpscQueue<std::shared_ptr<int>>>();
+  checkOwnership<muduo::MpmcQueue<std::shared_ptr<int>>>();
+}
+
+BOOST_AUTO_TEST_CASE(testMpmc)
+{
+  checkMpmc(1, 1);
+  checkMpmc(4, 4);
+  checkMpmc(3, 1);
+}
@@ -0,0 +1,134 @@
+#include "muduo/base/LogCompressor.h"
+#include "muduo/base/GzipFile.h"
+#include "muduo/base/LogFile.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <dirent.h>
+#include <stdio.h>
+#include <unistd.h>
+
+//#define BOOST_TEST_MODULE LogCompressorTest
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "muduo/base/tests/TempDir.h"
+
+std::vector<std::string> listFiles()
+{
+  std::vector<std::string> names;
+  DIR* d = ::opendir(".");
+  while (struct dirent* entry = ::readdir(d))
+  {
+    if (entry->d_name[0] != '.')
+      names.push_back(entry->d_name);
+  }
+  ::closedir(d);
+  std::sort(names.begin(), names.end());
+  return names;
+}
+
+void removeFiles()
+{
+  for (const auto& name : listFiles())
+    ::unlink(name.c_str());
+}
+
+std::string content(int i)
+{
+  std::string data;
+  for (int line = 0; line < 1000; ++line)
+  {
+    char buf[64];
+    snprintf(buf, sizeof buf, "%d: log line %d of a rolled file\n", i, line);
+    data += buf;
+  }
+  return data;
+}
+
+std::string writeLog(int i)
+{
+  char name[64];
+  snprintf(name, sizeof name, "test.2019010%d-120000.host.1234.log", i);
+  FILE* fp = ::fopen(name, "w");
+  std::string data = content(i);
+  ::fwrite(data.data(), 1, data.size(), fp);
+  ::fclose(fp);
+  return name;
+}
+
+std::string readGzip(const std::string& name)
+{
+  std::string data;
+  muduo::GzipFile file = muduo::GzipFile::openForRead(name);
+  char buf[4096];
+  int n = 0;
+  while (file.valid() && (n = file.read(buf, sizeof buf)) > 0)
+    data.append(buf, n);
+  return data;
+}
+
+BOOST_FIXTURE_TEST_CASE(testCompress, TempDir)
+{
+  muduo::LogCompressor compressor("test");
+  compressor.start();
+  std::string name = writeLog(1);
+  compressor.add(name);
+  compressor.stop();
+
+  BOOST_CHECK(compressor.compressed() == 1);
+  std::vector<std::string> files = listFiles();
+  BOOST_CHECK(files.size() == 1 && files[0] == name + ".gz");
+  BOOST_CHECK(readGzip(name + ".gz") == content(1));
+  removeFiles();
+}
+
+BOOST_FIXTURE_TEST_CASE(testKeepFiles, TempDir)
+{
+  muduo::LogCompressor compressor("test", 3);
+  compressor.start();
+  for (int i = 1; i <= 5; ++i)
+    compressor.add(writeLog(i));
+  compressor.stop();
+
+  std::vector<std::string> files = listFiles();
+  BOOST_CHECK(files.size() == 3);
+  // the newest
+  BOOST_CHECK(files.size() == 3 && files[0] == "test.20190103-120000.host.1234.log.gz");
+  removeFiles();
+}
+
+BOOST_FIXTURE_TEST_CASE(testKeepBytes, TempDir)
+{
+  std::string other = writeLog(9);
+  ::rename(other.c_str(), "other.20190109-120000.host.1234.log.gz");
+  muduo::LogCompressor compressor("test", 0, 1);
+  compressor.start();
+  compressor.add(writeLog(1));
+  compressor.add(writeLog(2));
+  compressor.stop();
+
+  // other files are left alone
+  std::vector<std::string> files = listFiles();
+  BOOST_CHECK(files.size() == 1 && files[0] == "other.20190109-120000.host.1234.log.gz");
+  removeFiles();
+}
+
+BOOST_FIXTURE_TEST_CASE(testRollCallback, TempDir)
+{
+  std::vector<std::string> rolled;
+  {
+    muduo::LogFile log("test", 100, false);
+    log.setRollCallback([&rolled](const muduo::string& name) { rolled.push_back(name); });
+    std::vector<std::string> files = listFiles();
+    BOOST_CHECK(files.size() == 1);
+    ::sleep(1);  // rolls once a second at most
+    std::string line = content(0).substr(0, 200);
+    log.append(line.data(), static_cast<int>(line.size()));
+    BOOST_CHECK(rolled.size() == 1 && files.size() == 1 && rolled[0] == files[0]);
+  }
+  removeFiles();
+}
@@ -0,0 +1,74 @@
+// Throughput of LogFile::append(), through stdio and through mmap,
+// with log lines and with whole buffers as AsyncLogging writes them.
+//
+// Usage: logfile_bench [megabytes]
+
+#include "muduo/base/LogFile.h"
+#include "muduo/base/Timestamp.h"
+
+#include <string>
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+using muduo::Timestamp;
+
+void removeLogs()
+{
+  DIR* d = ::opendir(".");
+  while (struct dirent* entry = ::readdir(d))
+  {
+    if (entry->d_name[0] != '.')
+      ::unlink(entry->d_name);
+  }
+  ::closedir(d);
+}
+
+void bench(const char* name, bool useMmap, size_t chunk, size_t total)
+{
+  std::string data;
+  while (data.size() < chunk)
+  {
+    data += "20261019 03:05:19.346320 12345 INFO  Hello 0123456789 "
+            "abcdefghijklmnopqrstuvwxyz - bench.cc:28\n";
+  }
+  data.resize(chunk);
+
+  Timestamp start(Timestamp::now());
+  {
+    muduo::LogFile log("logfile_bench", 1000*1000*1000, false, 3, 1024, useMmap);
+    for (size_t written = 0; written < total; written += chunk)
+    {
+      log.append(data.data(), static_cast<int>(chunk));
+    }
+  }
+  double seconds = timeDifference(Timestamp::now(), start);
+  printf("%-8s %8zd bytes a time: %8.2f MiB/s\n", name, chunk,
+         static_cast<double>(total) / seconds / (1024 * 1024));
+  removeLogs();
+}
+
+int main(int argc, char* argv[])
+{
+  size_t megabytes = argc > 1 ? atoi(argv[1]) : 512;
+  size_t total = megabytes * 1024 * 1024;
+
+  char dir[] = "/tmp/logfile_bench.XXXXXX";
+  if (::mkdtemp(dir) == NULL || ::chdir(dir) != 0)
+  {
+    perror("mkdtemp");
+    return 1;
+  }
+
+  for (int round = 0; round < 2; ++round)
+  {
+    bench("mmap", true, 100, total);
+    bench("stdio", false, 100, total);
+    bench("mmap", true, 4000*1000, total);
+    bench("stdio", false, 4000*1000, total);
+  }
+
+  ::rmdir(dir);
+}
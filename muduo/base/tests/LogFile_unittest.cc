@@ -0,0 +1,154 @@
+#include "muduo/base/FileUtil.h"
+#include "muduo/base/LogFile.h"
+
+#include <string>
+#include <vector>
+
+#include <dirent.h>
+#include <signal.h>
+#include <stdio.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+//#define BOOST_TEST_MODULE LogFileTest
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "muduo/base/tests/TempDir.h"
+
+using namespace muduo;
+
+std::string readAll(const char* name)
+{
+  std::string content;
+  FILE* fp = ::fopen(name, "r");
+  char buf[65536];
+  size_t n;
+  while (fp && (n = ::fread(buf, 1, sizeof buf, fp)) > 0)
+    content.append(buf, n);
+  if (fp)
+    ::fclose(fp);
+  return content;
+}
+
+std::vector<std::string> listFiles()
+{
+  std::vector<std::string> names;
+  DIR* d = ::opendir(".");
+  while (struct dirent* entry = ::readdir(d))
+  {
+    if (entry->d_name[0] != '.')
+      names.push_back(entry->d_name);
+  }
+  ::closedir(d);
+  return names;
+}
+
+std::string makeLine(int i)
+{
+  char line[128];
+  snprintf(line, sizeof line, "%d line of a log file, long enough to cross chunks 0123456789\n", i);
+  return line;
+}
+
+BOOST_FIXTURE_TEST_CASE(testAcrossChunks, TempDir)
+{
+  std::string expected;
+  {
+    FileUtil::MmapAppendFile file("mmap.log");
+    for (int i = 0; expected.size() < 2 * FileUtil::MmapAppendFile::kChunkSize + 100; ++i)
+    {
+      std::string line = makeLine(i);
+      file.append(line.data(), line.size());
+      expected += line;
+      if (i % 10000 == 0)
+        file.flush();
+    }
+    // larger than a chunk at once
+    std::string big(FileUtil::MmapAppendFile::kChunkSize + 7, 'x');
+    file.append(big.data(), big.size());
+    expected += big;
+    BOOST_CHECK(file.writtenBytes() == static_cast<off_t>(expected.size()));
+  }
+  // truncated to what was written
+  BOOST_CHECK(readAll("mmap.log") == expected);
+  ::unlink("mmap.log");
+}
+
+BOOST_FIXTURE_TEST_CASE(testAppendToExisting, TempDir)
+{
+  FILE* fp = ::fopen("existing.log", "w");
+  ::fputs("abc", fp);
+  ::fclose(fp);
+  {
+    FileUtil::MmapAppendFile file("existing.log", true);
+    file.append("def\n", 4);
+    file.flush();
+    BOOST_CHECK(file.writtenBytes() == 4);
+  }
+  BOOST_CHECK(readAll("existing.log") == "abcdef\n");
+  ::unlink("existing.log");
+}
+
+BOOST_FIXTURE_TEST_CASE(testFallback, TempDir)
+{
+  // below kChunkSize, so fallocate fails with EFBIG
+  struct rlimit old;
+  ::getrlimit(RLIMIT_FSIZE, &old);
+  struct rlimit limit = old;
+  limit.rlim_cur = 1024 * 1024;
+  ::signal(SIGXFSZ, SIG_IGN);
+  ::setrlimit(RLIMIT_FSIZE, &limit);
+  std::string expected;
+  {
+    FileUtil::MmapAppendFile file("fallback.log");
+    for (int i = 0; i < 100; ++i)
+    {
+      std::string line = makeLine(i);
+      file.append(line.data(), line.size());
+      expected += line;
+    }
+    file.flush();
+    BOOST_CHECK(file.writtenBytes() == static_cast<off_t>(expected.size()));
+  }
+  ::setrlimit(RLIMIT_FSIZE, &old);
+  ::signal(SIGXFSZ, SIG_DFL);
+  BOOST_CHECK(readAll("fallback.log") == expected);
+  ::unlink("fallback.log");
+}
+
+BOOST_FIXTURE_TEST_CASE(testLogFile, TempDir)
+{
+  std::vector<std::string> rolled;
+  std::string expected;
+  {
+    LogFile log("logfile_unittest", 1000, false, 3, 1024, true);
+    log.setRollCallback([&rolled](const string& name) { rolled.push_back(name); });
+    for (int i = 0; i < 10; ++i)
+    {
+      std::string line = makeLine(i);
+      log.append(line.data(), static_cast<int>(line.size()));
+      expected += line;
+    }
+    ::sleep(1);  // rolls once a second at most
+    std::string line(1000, 'y');
+    log.append(line.data(), static_cast<int>(line.size()));
+    expected += line;
+  }
+  BOOST_CHECK(rolled.size() == 1);
+  if (rolled.size() == 1)
+  {
+    BOOST_CHECK(readAll(rolled[0].c_str()) == expected);
+  }
+
+  std::vector<std::string> files = listFiles();
+  BOOST_CHECK(files.size() == 2);
+  for (const auto& name : files)
+  {
+    struct stat st;
+    BOOST_CHECK(::stat(name.c_str(), &st) == 0 && (st.st_size == 0 || name == rolled[0]));
+    ::unlink(name.c_str());
+  }
+}
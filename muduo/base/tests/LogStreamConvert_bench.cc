@@ -0,0 +1,151 @@
+// Number conversion of LogStream, against what it did before:
+// one digit at a time then reverse for integers, snprintf("%.12g") for doubles.
+// The integers of LogStream_bench are small, here they span all lengths,
+// and the doubles have fractions.
+
+#include "muduo/base/LogStream.h"
+#include "muduo/base/Timestamp.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+using namespace muduo;
+
+const size_t N = 1000000;
+
+// the LogStream of muduo 1.x
+template<typename T>
+size_t convertDigitByDigit(char buf[], T value)
+{
+  static const char digits[] = "9876543210123456789";
+  static const char* zero = digits + 9;
+  T i = value;
+  char* p = buf;
+
+  do
+  {
+    int lsd = static_cast<int>(i % 10);
+    i /= 10;
+    *p++ = zero[lsd];
+  } while (i != 0);
+
+  if (value < 0)
+  {
+    *p++ = '-';
+  }
+  *p = '\0';
+  std::reverse(buf, p);
+
+  return p - buf;
+}
+
+template<typename T>
+std::vector<T> makeIntegers()
+{
+  std::vector<T> values;
+  uint64_t x = 88172645463325252ULL;
+  for (size_t i = 0; i < N; ++i)
+  {
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    // all lengths equally likely
+    T v = static_cast<T>(x >> (x % (sizeof(T) * 8)));
+    values.push_back(i % 2 ? v : static_cast<T>(0 - v));
+  }
+  return values;
+}
+
+std::vector<double> makeDoubles()
+{
+  std::vector<double> values;
+  uint64_t x = 88172645463325252ULL;
+  for (size_t i = 0; i < N; ++i)
+  {
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    switch (i % 4)
+    {
+      case 0:  // latencies, rates
+        values.push_back(static_cast<double>(x % 1000000) / 1000.0);
+        break;
+      case 1:  // ratios
+        values.push_back(static_cast<double>(x % 1000) / 7.0);
+        break;
+      case 2:  // counts
+        values.push_back(static_cast<double>(x % 100000));
+        break;
+      default:  // anything
+        double d;
+        memcpy(&d, &x, sizeof d);
+        values.push_back(d == d ? d : 0.0);
+    }
+  }
+  return values;
+}
+
+template<typename T>
+void benchDigitByDigit(const std::vector<T>& values)
+{
+  char buf[32];
+  size_t total = 0;
+  Timestamp start(Timestamp::now());
+  for (T v : values)
+    total += convertDigitByDigit(buf, v);
+  Timestamp end(Timestamp::now());
+
+  printf("benchDigitByDigit %f %zd\n", timeDifference(end, start), total);
+}
+
+void benchPrintf(const std::vector<double>& values)
+{
+  char buf[32];
+  size_t total = 0;
+  Timestamp start(Timestamp::now());
+  for (double v : values)
+    total += snprintf(buf, sizeof buf, "%.12g", v);
+  Timestamp end(Timestamp::now());
+
+  printf("benchPrintf %f %zd\n", timeDifference(end, start), total);
+}
+
+template<typename T>
+void benchLogStream(const std::vector<T>& values)
+{
+  LogStream os;
+  size_t total = 0;
+  Timestamp start(Timestamp::now());
+  for (T v : values)
+  {
+    os << v;
+    total += os.buffer().length();
+    os.resetBuffer();
+  }
+  Timestamp end(Timestamp::now());
+
+  printf("benchLogStream %f %zd\n", timeDifference(end, start), total);
+}
+
+int main()
+{
+  std::vector<int> ints = makeIntegers<int>();
+  std::vector<int64_t> int64s = makeIntegers<int64_t>();
+  std::vector<double> doubles = makeDoubles();
+
+  puts("int");
+  benchDigitByDigit(ints);
+  benchLogStream(ints);
+
+  puts("int64_t");
+  benchDigitByDigit(int64s);
+  benchLogStream(int64s);
+
+  puts("double");
+  benchPrintf(doubles);
+  benchLogStream(doubles);
+}
@@ -1,7 +1,10 @@
 #include "muduo/base/LogStream.h"
 
+#include <cmath>
 #include <limits>
 #include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
 
 //#define BOOST_TEST_MODULE LogStreamTest
 #define BOOST_TEST_MAIN
@@ -151,7 +154,7 @@ BOOST_AUTO_TEST_CASE(testLogStreamFloats)
   os.resetBuffer();
 
   os << a+b;
-  BOOST_CHECK_EQUAL(buf.toString(), string("0.15"));
+  BOOST_CHECK_EQUAL(buf.toString(), string("0.15000000000000002"));
   os.resetBuffer();
 
   BOOST_CHECK(a+b != c);
@@ -169,6 +172,63 @@ BOOST_AUTO_TEST_CASE(testLogStreamFloats)
   os.resetBuffer();
 }
 
+BOOST_AUTO_TEST_CASE(testLogStreamDoubleFormats)
+{
+  muduo::LogStream os;
+  const muduo::LogStream::Buffer& buf = os.buffer();
+  const struct
+  {
+    double value;
+    const char* text;
+  } cases[] =
+  {
+    { -0.0, "-0" },
+    { 100.0, "100" },
+    { 1e16, "10000000000000000" },
+    { 1e17, "1e+17" },
+    { 123456789012345680.0, "1.2345678901234568e+17" },
+    { 0.0001, "0.0001" },
+    { 0.00001234, "1.234e-05" },
+    { 1e100, "1e+100" },
+    { 5e-324, "5e-324" },
+    { std::numeric_limits<double>::max(), "1.7976931348623157e+308" },
+    { std::numeric_limits<double>::min(), "2.2250738585072014e-308" },
+    { -std::numeric_limits<double>::infinity(), "-inf" },
+    { std::numeric_limits<double>::quiet_NaN(), "nan" },
+    { 0.1 + 0.2, "0.30000000000000004" },
+  };
+  for (const auto& c : cases)
+  {
+    os << c.value;
+    BOOST_CHECK_EQUAL(buf.toString(), string(c.text));
+    os.resetBuffer();
+  }
+}
+
+// every double reads back the same
+BOOST_AUTO_TEST_CASE(testLogStreamDoubleRoundTrip)
+{
+  muduo::LogStream os;
+  const muduo::LogStream::Buffer& buf = os.buffer();
+  uint64_t x = 88172645463325252ULL;
+  int wrong = 0;
+  for (int i = 0; i < 1000000; ++i)
+  {
+    x ^= x << 13;                                                                 // xorshift64
+    x ^= x >> 7;
+    x ^= x << 17;
+    double d;
+    memcpy(&d, &x, sizeof d);
+    if (std::isnan(d))
+      continue;
+    os << d;
+    if (strtod(buf.toString().c_str(), NULL) != d)
+      ++wrong;
+    os.resetBuffer();
+  }
+  BOOST_CHECK_EQUAL(wrong, 0);
+}
+
 BOOST_AUTO_TEST_CASE(testLogStreamVoid)
 {
   muduo::LogStream os;
@@ -0,0 +1,54 @@
+// LOG_* below WARN compiled out
+#define MUDUO_MIN_LOG_LEVEL 3
+
+#include "muduo/base/Logging.h"
+
+#include <string>
+
+#include <errno.h>
+
+//#define BOOST_TEST_MODULE LoggingMinLevelTest
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+std::string g_output;
+
+void output(const char* msg, int len)
+{
+  g_output.append(msg, len);
+}
+
+int g_evaluated = 0;
+
+int evaluate()
+{
+  return ++g_evaluated;
+}
+
+BOOST_AUTO_TEST_CASE(testMinLevel)
+{
+  muduo::Logger::setOutput(output);
+  muduo::Logger::setLogLevel(muduo::Logger::TRACE);
+
+  LOG_TRACE << "trace " << evaluate();
+  LOG_DEBUG << "debug " << evaluate();
+  LOG_INFO << "info " << evaluate();
+  LOG_INFO_EVERY_N(1) << "info " << evaluate();
+  LOG_DEBUG_RATE_LIMITED(1000, 1000) << "debug " << evaluate();
+  BOOST_CHECK(g_output.empty());
+  BOOST_CHECK(g_evaluated == 0);
+
+  LOG_WARN << "warn " << evaluate();
+  LOG_ERROR_EVERY_N(1) << "error " << evaluate();
+  errno = EAGAIN;
+  LOG_SYSERR << "syserr " << evaluate();
+  BOOST_CHECK(g_evaluated == 3);
+  BOOST_CHECK(g_output.find("WARN  warn 1 - ") != std::string::npos);
+  BOOST_CHECK(g_output.find("ERROR error 2 - ") != std::string::npos);
+  BOOST_CHECK(g_output.find("(errno=11) syserr 3 - ") != std::string::npos);
+
+  // the prefix: "20190101 12:00:00.123456Z  1234 WARN  "
+  size_t z = g_output.find('Z');
+  BOOST_CHECK(z == 24 && g_output[8] == ' ' && g_output[17] == '.');
+}
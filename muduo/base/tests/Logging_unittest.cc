@@ -0,0 +1,156 @@
+#include "muduo/base/Logging.h"
+#include "muduo/base/Thread.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <errno.h>
+#include <unistd.h>
+
+//#define BOOST_TEST_MODULE LoggingTest
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+muduo::MutexLock g_mutex;
+std::vector<std::string> g_lines;
+
+void output(const char* msg, int len)
+{
+  muduo::MutexLockGuard lock(g_mutex);
+  g_lines.push_back(std::string(msg, len));
+}
+
+struct OutputFixture
+{
+  OutputFixture() { muduo::Logger::setOutput(output); }
+};
+
+BOOST_GLOBAL_FIXTURE(OutputFixture);
+
+std::vector<std::string> takeLines()
+{
+  muduo::MutexLockGuard lock(g_mutex);
+  std::vector<std::string> lines;
+  lines.swap(g_lines);
+  return lines;
+}
+
+bool contains(const std::string& line, const char* text)
+{
+  return line.find(text) != std::string::npos;
+}
+
+int g_evaluated = 0;
+
+int evaluate(int i)
+{
+  ++g_evaluated;
+  return i;
+}
+
+BOOST_AUTO_TEST_CASE(testEveryN)
+{
+  for (int i = 0; i < 10; ++i)
+  {
+    LOG_WARN_EVERY_N(3) << "every 3 " << evaluate(i);
+  }
+  std::vector<std::string> lines = takeLines();
+  BOOST_CHECK(lines.size() == 4);
+  BOOST_CHECK(g_evaluated == 4);
+  if (lines.size() == 4)
+  {
+    BOOST_CHECK(contains(lines[0], "WARN  every 3 0 -"));
+    BOOST_CHECK(contains(lines[1], "WARN  (2 suppressed) every 3 3 -"));
+    BOOST_CHECK(contains(lines[3], "(2 suppressed) every 3 9 -"));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testLevel)
+{
+  muduo::Logger::setLogLevel(muduo::Logger::INFO);
+  for (int i = 0; i < 10; ++i)
+  {
+    LOG_DEBUG_EVERY_N(1) << "debug";
+    LOG_DEBUG_EVERY_SECONDS(0) << "debug";
+    LOG_DEBUG_RATE_LIMITED(1000, 1000) << "debug";
+    LOG_INFO_EVERY_N(5) << "info";
+  }
+  std::vector<std::string> lines = takeLines();
+  BOOST_CHECK(lines.size() == 2);
+}
+
+BOOST_AUTO_TEST_CASE(testEverySeconds)
+{
+  for (int i = 0; i < 100; ++i)
+  {
+    LOG_ERROR_EVERY_SECONDS(3600) << "hourly";
+  }
+  std::vector<std::string> lines = takeLines();
+  BOOST_CHECK(lines.size() == 1);
+
+  for (int round = 0; round < 3; ++round)
+  {
+    for (int i = 0; i < 10; ++i)
+    {
+      LOG_INFO_EVERY_SECONDS(0.1) << "tenth";
+    }
+    ::usleep(150 * 1000);
+  }
+  lines = takeLines();
+  BOOST_CHECK(lines.size() == 3);
+  BOOST_CHECK(lines.size() == 3 && contains(lines[2], "INFO  (9 suppressed) tenth"));
+}
+
+BOOST_AUTO_TEST_CASE(testRateLimited)
+{
+  for (int i = 0; i < 100; ++i)
+  {
+    LOG_WARN_RATE_LIMITED(1, 5) << "burst";
+  }
+  std::vector<std::string> lines = takeLines();
+  BOOST_CHECK(lines.size() == 5);
+
+  // 100 a second, refills in 10ms
+  for (int i = 0; i < 10; ++i)
+  {
+    LOG_WARN_RATE_LIMITED(100, 1) << "paced";
+  }
+  ::usleep(20 * 1000);
+  LOG_WARN_RATE_LIMITED(100, 1) << "after";
+  lines = takeLines();
+  BOOST_CHECK(lines.size() == 2);
+}
+
+BOOST_AUTO_TEST_CASE(testSyserr)
+{
+  errno = EAGAIN;
+  LOG_SYSERR_EVERY_N(10) << "failed";
+  std::vector<std::string> lines = takeLines();
+  BOOST_CHECK(lines.size() == 1 && contains(lines[0], "(errno=11)"));
+}
+
+BOOST_AUTO_TEST_CASE(testThreads)
+{
+  const int kThreads = 4;
+  const int kLines = 10000;
+  std::vector<std::unique_ptr<muduo::Thread>> threads;
+  for (int t = 0; t < kThreads; ++t)
+  {
+    threads.emplace_back(new muduo::Thread([]
+    {
+      for (int i = 0; i < kLines; ++i)
+      {
+        LOG_WARN_EVERY_N(100) << "storm";
+      }
+    }));
+    threads.back()->start();
+  }
+  for (auto& thr : threads)
+  {
+    thr->join();
+  }
+  std::vector<std::string> lines = takeLines();
+  BOOST_CHECK(lines.size() == kThreads * kLines / 100);
+}
@@ -0,0 +1,30 @@
+#ifndef MUDUO_BASE_TESTS_TEMPDIR_H
+#define MUDUO_BASE_TESTS_TEMPDIR_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+// Boost.Test fixture that runs a test case, or the whole module as a global
+// fixture, in a new directory under /tmp.  The directory is removed
+// afterwards, the tests remove the files they made.
+struct TempDir
+{
+  TempDir()
+  {
+    if (::mkdtemp(dir) == NULL || ::chdir(dir) != 0)
+    {
+      perror("mkdtemp");
+      abort();
+    }
+  }
+
+  ~TempDir()
+  {
+    ::rmdir(dir);
+  }
+
+  char dir[32] = "/tmp/muduo_unittest.XXXXXX";
+};
+
+#endif  // MUDUO_BASE_TESTS_TEMPDIR_H
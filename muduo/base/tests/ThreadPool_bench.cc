@@ -0,0 +1,127 @@
+// ThreadPool against WorkStealingThreadPool, with tiny and medium tasks.
+//
+// Usage: threadpool_bench [pool_threads] [submit_threads] [tasks]
+
+#include "muduo/base/ThreadPool.h"
+#include "muduo/base/WorkStealingThreadPool.h"
+#include "muduo/base/CountDownLatch.h"
+#include "muduo/base/Timestamp.h"
+
+#include <algorithm>
+#include <atomic>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using muduo::CountDownLatch;
+using muduo::Timestamp;
+
+std::atomic<int64_t> g_sink(0);
+
+// about a microsecond of work
+void mediumTask()
+{
+  int64_t x = 0;
+  for (int i = 0; i < 500; ++i)
+  {
+    x += i * i;
+    __asm__ __volatile__("" : "+r"(x));
+  }
+  g_sink.fetch_add(x, std::memory_order_relaxed);
+}
+
+void submitBatch(muduo::ThreadPool& pool, const muduo::ThreadPool::Task& task,
+                 int n, bool)
+{
+  for (int i = 0; i < n; ++i)
+    pool.run(task);
+}
+
+void submitBatch(muduo::WorkStealingThreadPool& pool,
+                 const muduo::WorkStealingThreadPool::Task& task,
+                 int n, bool batched)
+{
+  if (batched)
+  {
+    std::vector<muduo::WorkStealingThreadPool::Task> batch;
+    for (int i = 0; i < n; i += 64)
+    {
+      batch.assign(std::min(64, n - i), task);
+      pool.run(&batch);
+    }
+  }
+  else
+  {
+    for (int i = 0; i < n; ++i)
+      pool.run(task);
+  }
+}
+
+template<typename Pool>
+double bench(Pool& pool, int submitThreads, int tasks, bool medium, bool batched)
+{
+  // not CountDownLatch::countDown() per task, its mutex would dominate
+  std::atomic<int> remaining(tasks);
+  CountDownLatch done(1);
+  typename Pool::Task task = [&remaining, &done, medium]
+  {
+    if (medium)
+      mediumTask();
+    if (remaining.fetch_sub(1) == 1)
+      done.countDown();
+  };
+
+  const int perThread = tasks / submitThreads;
+  std::vector<std::unique_ptr<muduo::Thread>> submitters;
+  Timestamp start(Timestamp::now());
+  for (int t = 0; t < submitThreads; ++t)
+  {
+    submitters.emplace_back(new muduo::Thread([&pool, &task, perThread, batched]
+    {
+      submitBatch(pool, task, perThread, batched);
+    }));
+    submitters.back()->start();
+  }
+  for (auto& thr : submitters)
+  {
+    thr->join();
+  }
+  done.wait();
+  return timeDifference(Timestamp::now(), start);
+}
+
+int main(int argc, char* argv[])
+{
+  int poolThreads = argc > 1 ? atoi(argv[1]) : 4;
+  int submitThreads = argc > 2 ? atoi(argv[2]) : 4;
+  int tasks = argc > 3 ? atoi(argv[3]) : 1000000;
+  tasks = tasks / submitThreads * submitThreads;
+  printf("pool threads %d, submit threads %d, tasks %d\n",
+         poolThreads, submitThreads, tasks);
+
+  for (int medium = 0; medium < 2; ++medium)
+  {
+    const char* size = medium ? "medium" : "tiny";
+    {
+      muduo::ThreadPool pool;
+      pool.start(poolThreads);
+      double sec = bench(pool, submitThreads, tasks, medium, false);
+      printf("%-6s ThreadPool               %8.3f us/task\n", size, sec * 1e6 / tasks);
+      pool.stop();
+    }
+    {
+      muduo::WorkStealingThreadPool pool;
+      pool.start(poolThreads);
+      double sec = bench(pool, submitThreads, tasks, medium, false);
+      printf("%-6s WorkStealingThreadPool   %8.3f us/task\n", size, sec * 1e6 / tasks);
+      pool.stop();
+    }
+    {
+      muduo::WorkStealingThreadPool pool;
+      pool.start(poolThreads);
+      double sec = bench(pool, submitThreads, tasks, medium, true);
+      printf("%-6s  ... batches of 64       %8.3f us/task\n", size, sec * 1e6 / tasks);
+      pool.stop();
+    }
+  }
+}
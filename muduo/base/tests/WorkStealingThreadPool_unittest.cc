@@ -0,0 +1,136 @@
+#include "muduo/base/WorkStealingThreadPool.h"
+#include "muduo/base/CountDownLatch.h"
+#include "muduo/base/CurrentThread.h"
+
+#include <atomic>
+#include <set>
+
+#include <unistd.h>  // usleep
+
+//#define BOOST_TEST_MODULE WorkStealingThreadPoolTest
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+const int kTasks = 100000;
+
+void checkRunsEveryTask(int numThreads, int maxSize)
+{
+  muduo::WorkStealingThreadPool pool("Pool");
+  pool.setMaxQueueSize(maxSize);
+  pool.start(numThreads);
+
+  std::vector<std::atomic<int>> counts(kTasks);
+  muduo::CountDownLatch latch(kTasks);
+  for (int i = 0; i < kTasks; ++i)
+  {
+    pool.run([&counts, &latch, i]
+    {
+      counts[i].fetch_add(1);
+      latch.countDown();
+    });
+    if (maxSize > 0)
+    {
+      BOOST_CHECK(pool.queueSize() <= static_cast<size_t>(maxSize));
+    }
+  }
+  latch.wait();
+  int wrong = 0;
+  for (const auto& count : counts)
+  {
+    if (count.load() != 1)
+      ++wrong;
+  }
+  BOOST_CHECK(wrong == 0);
+  BOOST_CHECK(pool.queueSize() == 0);
+  pool.stop();
+}
+
+BOOST_AUTO_TEST_CASE(testRunsEveryTask)
+{
+  checkRunsEveryTask(1, 0);
+  checkRunsEveryTask(4, 0);
+  checkRunsEveryTask(4, 1);
+  checkRunsEveryTask(4, 10);
+}
+
+BOOST_AUTO_TEST_CASE(testBatch)
+{
+  muduo::WorkStealingThreadPool pool("BatchPool");
+  pool.start(4);
+
+  std::atomic<int> sum(0);
+  muduo::CountDownLatch latch(1000);
+  std::vector<muduo::WorkStealingThreadPool::Task> batch;
+  for (int i = 1; i <= 1000; ++i)
+  {
+    batch.push_back([&sum, &latch, i]
+    {
+      sum.fetch_add(i);
+      latch.countDown();
+    });
+  }
+  pool.run(&batch);
+  BOOST_CHECK(batch.empty());
+  latch.wait();
+  BOOST_CHECK(sum.load() == 500500);
+  pool.stop();
+}
+
+// tasks submitted from a busy worker are stolen by the idle ones
+BOOST_AUTO_TEST_CASE(testStealing)
+{
+  muduo::WorkStealingThreadPool pool("StealPool");
+  pool.start(4);
+
+  muduo::MutexLock mutex;
+  std::set<int> tids;
+  muduo::CountDownLatch latch(40);
+  pool.run([&]
+  {
+    for (int i = 0; i < 40; ++i)
+    {
+      pool.run([&]
+      {
+        usleep(10 * 1000);
+        {
+        muduo::MutexLockGuard lock(mutex);
+        tids.insert(muduo::CurrentThread::tid());
+        }
+        latch.countDown();
+      });
+    }
+  });
+  latch.wait();
+  BOOST_CHECK(tids.size() > 1);
+  pool.stop();
+}
+
+BOOST_AUTO_TEST_CASE(testNoThreads)
+{
+  muduo::WorkStealingThreadPool pool;
+  bool initialized = false;
+  pool.setThreadInitCallback([&] { initialized = true; });
+  pool.start(0);
+  BOOST_CHECK(initialized);
+
+  int ran = 0;
+  pool.run([&] { ++ran; });
+  std::vector<muduo::WorkStealingThreadPool::Task> batch(3, [&] { ++ran; });
+  pool.run(&batch);
+  BOOST_CHECK(ran == 4);
+}
+
+// a parked pool must pick up work again
+BOOST_AUTO_TEST_CASE(testWakeUp)
+{
+  muduo::WorkStealingThreadPool pool;
+  pool.start(3);
+  for (int round = 0; round < 5; ++round)
+  {
+    usleep(20 * 1000);
+    muduo::CountDownLatch latch(1);
+    pool.run([&] { latch.countDown(); });
+    latch.wait();
+  }
+}
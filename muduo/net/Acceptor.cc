@@ -52,6 +52,24 @@ void Acceptor::listen()
   acceptChannel_.enableReading();
 }
 
+void Acceptor::pause()
+{
+  loop_->assertInLoopThread();
+  if (listenning_ && acceptChannel_.isReading())
+  {
+    acceptChannel_.disableReading();
+  }
+}
+
+void Acceptor::resume()
+{
+  loop_->assertInLoopThread();
+  if (listenning_ && !acceptChannel_.isReading())
+  {
+    acceptChannel_.enableReading();
+  }
+}
+
 void Acceptor::handleRead()
 {
   loop_->assertInLoopThread();
@@ -73,7 +91,7 @@ void Acceptor::handleRead()
   }
   else
   {
-    LOG_SYSERR << "in Acceptor::handleRead";
+    LOG_SYSERR_EVERY_SECONDS(1) << "in Acceptor::handleRead";
     // Read the section named "The special problem of
     // accept()ing when you can't" in libev's doc.
     // By Marc Lehmann, author of libev.
@@ -41,6 +41,12 @@ class Acceptor : noncopyable
   bool listenning() const { return listenning_; }
   void listen();
 
+  /// Stops accepting, new connections queue up in the kernel backlog.
+  void pause();
+  /// Accepts again after pause().
+  void resume();
+  bool paused() const { return listenning_ && !acceptChannel_.isReading(); }
+
  private:
   void handleRead();
 
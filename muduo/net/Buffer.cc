@@ -14,6 +14,10 @@
 #include <errno.h>
 #include <sys/uio.h>
 
+#if defined(__AVX2__) || defined(__SSE4_2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
 using namespace muduo;
 using namespace muduo::net;
 
@@ -22,6 +26,121 @@ const char Buffer::kCRLF[] = "\r\n";
 const size_t Buffer::kCheapPrepend;
 const size_t Buffer::kInitialSize;
 
+namespace
+{
+
+const char* findCRLFScalar(const char* begin, const char* end)
+{
+  while (end - begin >= 2)
+  {
+    const void* cr = memchr(begin, '\r', end - begin - 1);
+    if (cr == NULL)
+    {
+      break;
+    }
+    begin = static_cast<const char*>(cr);
+    if (begin[1] == '\n')
+    {
+      return begin;
+    }
+    ++begin;
+  }
+  return NULL;
+}
+
+const char* findAnyOfScalar(const char* begin, const char* end, StringPiece chars)
+{
+  for (; begin < end; ++begin)
+  {
+    if (memchr(chars.data(), *begin, chars.size()) != NULL)
+    {
+      return begin;
+    }
+  }
+  return NULL;
+}
+
+}  // namespace
+
+// Compares a block and the block one byte after it, so the loops stop a byte
+// short of a full block and leave the rest to the scalar code.
+const char* Buffer::findCRLF(const char* begin, const char* end)
+{
+#if defined(__AVX2__)
+  const __m256i cr = _mm256_set1_epi8('\r');
+  const __m256i lf = _mm256_set1_epi8('\n');
+  for (; end - begin > 32; begin += 32)
+  {
+    __m256i first = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(begin));
+    __m256i second = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(begin + 1));
+    __m256i match = _mm256_and_si256(_mm256_cmpeq_epi8(first, cr),
+                                     _mm256_cmpeq_epi8(second, lf));
+    unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(match));
+    if (mask != 0)
+    {
+      return begin + __builtin_ctz(mask);
+    }
+  }
+#elif defined(__SSE2__)
+  const __m128i cr = _mm_set1_epi8('\r');
+  const __m128i lf = _mm_set1_epi8('\n');
+  for (; end - begin > 16; begin += 16)
+  {
+    __m128i first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin));
+    __m128i second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin + 1));
+    __m128i match = _mm_and_si128(_mm_cmpeq_epi8(first, cr),
+                                  _mm_cmpeq_epi8(second, lf));
+    unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(match));
+    if (mask != 0)
+    {
+      return begin + __builtin_ctz(mask);
+    }
+  }
+#endif
+  return findCRLFScalar(begin, end);
+}
+
+const char* Buffer::findAnyOf(const char* begin, const char* end, StringPiece chars)
+{
+  assert(0 < chars.size() && chars.size() <= 16);
+#if defined(__AVX2__)
+  __m256i needles[16];
+  for (int i = 0; i < chars.size(); ++i)
+  {
+    needles[i] = _mm256_set1_epi8(chars[i]);
+  }
+  for (; end - begin >= 32; begin += 32)
+  {
+    __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(begin));
+    __m256i match = _mm256_cmpeq_epi8(block, needles[0]);
+    for (int i = 1; i < chars.size(); ++i)
+    {
+      match = _mm256_or_si256(match, _mm256_cmpeq_epi8(block, needles[i]));
+    }
+    unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(match));
+    if (mask != 0)
+    {
+      return begin + __builtin_ctz(mask);
+    }
+  }
+#elif defined(__SSE4_2__)
+  char set[16] = { 0 };
+  memcpy(set, chars.data(), chars.size());
+  const __m128i needle = _mm_loadu_si128(reinterpret_cast<const __m128i*>(set));
+  for (; end - begin >= 16; begin += 16)
+  {
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin));
+    int index = _mm_cmpestri(needle, chars.size(), block, 16,
+                             _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_LEAST_SIGNIFICANT);
+    if (index != 16)
+    {
+      return begin + index;
+    }
+  }
+#endif
+  return findAnyOfScalar(begin, end, chars);
+}
+
 ssize_t Buffer::readFd(int fd, int* savedErrno)
 {
   // saved an ioctl()/FIONREAD call to tell how much to read
@@ -79,20 +79,25 @@ class Buffer : public muduo::copyable
 
   const char* findCRLF() const
   {
-    // FIXME: replace with memmem()?
-    const char* crlf = std::search(peek(), beginWrite(), kCRLF, kCRLF+2);
-    return crlf == beginWrite() ? NULL : crlf;
+    return findCRLF(peek(), beginWrite());
   }
 
   const char* findCRLF(const char* start) const
   {
     assert(peek() <= start);
     assert(start <= beginWrite());
-    // FIXME: replace with memmem()?
-    const char* crlf = std::search(start, beginWrite(), kCRLF, kCRLF+2);
-    return crlf == beginWrite() ? NULL : crlf;
+    return findCRLF(start, beginWrite());
   }
 
+  /// Returns the first "\r\n" in [begin, end), or NULL.
+  /// Uses AVX2 or SSE2 when compiled for them.
+  static const char* findCRLF(const char* begin, const char* end);
+
+  /// Returns the first byte in [begin, end) that is one of chars, or NULL.
+  /// chars has 1 to 16 bytes.
+  /// Uses AVX2 or SSE4.2 when compiled for them.
+  static const char* findAnyOf(const char* begin, const char* end, StringPiece chars);
+
   const char* findEOL() const
   {
     const void* eol = memchr(peek(), '\n', readableBytes());
@@ -11,6 +11,7 @@
 #ifndef MUDUO_NET_CALLBACKS_H
 #define MUDUO_NET_CALLBACKS_H
 
+#include "muduo/base/InlineFunction.h"
 #include "muduo/base/Timestamp.h"
 
 #include <functional>
@@ -60,7 +61,7 @@ namespace net
 class Buffer;
 class TcpConnection;
 typedef std::shared_ptr<TcpConnection> TcpConnectionPtr;
-typedef std::function<void()> TimerCallback;
+typedef InlineFunction<void()> TimerCallback;
 typedef std::function<void (const TcpConnectionPtr&)> ConnectionCallback;
 typedef std::function<void (const TcpConnectionPtr&)> CloseCallback;
 typedef std::function<void (const TcpConnectionPtr&)> WriteCompleteCallback;
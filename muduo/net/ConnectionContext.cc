@@ -0,0 +1,76 @@
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+//
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+
+#include "muduo/net/ConnectionContext.h"
+
+#include "muduo/base/Logging.h"
+
+#include <mutex>
+
+using namespace muduo;
+using namespace muduo::net;
+
+namespace
+{
+
+struct SlotInfo
+{
+  size_t offset;
+  void (*destroy)(void* address);
+};
+
+// Slots are registered while initializing globals, possibly before main()
+// and before any other global of this file, so only constant-initialized
+// variables here.  std::mutex has a constexpr constructor, MutexLock has not.
+std::mutex g_mutex;
+SlotInfo g_slots[ConnectionContexts::kMaxSlots];
+int g_numSlots = 0;
+size_t g_inlineUsed = 0;
+
+}  // namespace
+
+const size_t ConnectionContexts::kInlineSize;
+const int ConnectionContexts::kMaxSlots;
+const size_t ConnectionContexts::kStorageSize;
+
+int ConnectionContexts::allocateSlot(size_t size, size_t align, bool* inlined, size_t* offset,
+                                     Destroyer destroyInline, Destroyer destroyOnHeap)
+{
+  std::lock_guard<std::mutex> lock(g_mutex);
+  if (g_numSlots >= kMaxSlots)
+  {
+    LOG_FATAL << "ConnectionContexts::registerSlot() too many slots, max " << kMaxSlots;
+  }
+
+  int index = g_numSlots++;
+  size_t start = (g_inlineUsed + align - 1) / align * align;
+  *inlined = align <= alignof(max_align_t) && start + size <= kInlineSize;
+  if (*inlined)
+  {
+    g_inlineUsed = start + size;
+  }
+  else
+  {
+    // keeps a pointer instead, in the place of this slot
+    start = kInlineSize + static_cast<size_t>(index) * sizeof(void*);
+  }
+  *offset = start;
+
+  g_slots[index].offset = start;
+  g_slots[index].destroy = *inlined ? destroyInline : destroyOnHeap;
+  return index;
+}
+
+ConnectionContexts::~ConnectionContexts()
+{
+  for (int i = 0; constructed_ != 0; ++i)
+  {
+    if (constructed_ & bit(i))
+    {
+      constructed_ &= ~bit(i);
+      g_slots[i].destroy(reinterpret_cast<char*>(&storage_) + g_slots[i].offset);
+    }
+  }
+}
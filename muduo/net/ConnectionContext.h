@@ -0,0 +1,187 @@
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+//
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+//
+// This is a public header file, it must only include public header files.
+
+#ifndef MUDUO_NET_CONNECTIONCONTEXT_H
+#define MUDUO_NET_CONNECTIONCONTEXT_H
+
+#include "muduo/base/copyable.h"
+#include "muduo/base/noncopyable.h"
+
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <assert.h>
+#include <stddef.h>
+
+namespace muduo
+{
+namespace net
+{
+
+class ConnectionContexts;
+
+///
+/// Typed handle of a per-connection context, see ConnectionContexts.
+///
+template<typename T>
+class ContextSlot : public muduo::copyable
+{
+ public:
+  ContextSlot()
+    : index_(-1),
+      offset_(0),
+      inline_(false)
+  {
+  }
+
+  bool valid() const { return index_ >= 0; }
+
+ private:
+  friend class ConnectionContexts;
+
+  ContextSlot(int index, size_t offset, bool inlined)
+    : index_(index),
+      offset_(offset),
+      inline_(inlined)
+  {
+  }
+
+  int index_;
+  size_t offset_;
+  bool inline_;
+};
+
+///
+/// Per-connection application state, without boost::any.
+///
+/// Each kind of state registers a slot once, at start-up, and gets a
+/// fixed place in the storage embedded in every TcpConnection, so
+/// setting it doesn't allocate and getting it is an unchecked cast.
+/// States that don't fit in what is left of the inline storage are
+/// allocated on the heap instead, transparently, each slot has a place
+/// for the pointer reserved, so registering never runs out of room.
+///
+///   const ContextSlot<HttpContext> kHttpContextSlot =
+///       ConnectionContexts::registerSlot<HttpContext>();
+///   ...
+///   conn->emplaceContext(kHttpContextSlot);
+///   HttpContext* context = conn->context(kHttpContextSlot);
+///
+/// Not thread safe, like the rest of TcpConnection, use it in loop.
+///
+class ConnectionContexts : noncopyable
+{
+ public:
+  /// Fits HttpContext, RpcChannelPtr and CoroStreamPtr together,
+  /// checked in HttpServer.cc.
+  static const size_t kInlineSize = 192;
+  static const int kMaxSlots = 16;
+  static const size_t kStorageSize = kInlineSize + kMaxSlots * sizeof(void*);
+
+  ConnectionContexts()
+    : constructed_(0)
+  {
+  }
+
+  ~ConnectionContexts();
+
+  /// Thread safe, but must be called before any connection is made,
+  /// typically while initializing a global or static variable.
+  template<typename T>
+  static ContextSlot<T> registerSlot()
+  {
+    size_t offset = 0;
+    bool inlined = false;
+    int index = allocateSlot(sizeof(T), alignof(T), &inlined, &offset,
+                             &destroyInline<T>, &destroyOnHeap<T>);
+    return ContextSlot<T>(index, offset, inlined);
+  }
+
+  /// Replaces the state of @c slot with a T made of @c args.
+  template<typename T, typename... Args>
+  T* emplace(ContextSlot<T> slot, Args&&... args)
+  {
+    assert(slot.valid());
+    reset(slot);
+    T* context;
+    if (slot.inline_)
+    {
+      context = new (address(slot)) T(std::forward<Args>(args)...);
+    }
+    else
+    {
+      context = new T(std::forward<Args>(args)...);
+      *static_cast<T**>(address(slot)) = context;
+    }
+    constructed_ |= bit(slot.index_);
+    return context;
+  }
+
+  /// The state of @c slot, which must have been emplaced.
+  template<typename T>
+  T* get(ContextSlot<T> slot)
+  {
+    assert(has(slot));
+    return slot.inline_ ? static_cast<T*>(address(slot))
+                        : *static_cast<T**>(address(slot));
+  }
+
+  template<typename T>
+  bool has(ContextSlot<T> slot) const
+  {
+    return slot.valid() && (constructed_ & bit(slot.index_)) != 0;
+  }
+
+  /// Destroys the state of @c slot, if any.
+  template<typename T>
+  void reset(ContextSlot<T> slot)
+  {
+    if (has(slot))
+    {
+      constructed_ &= ~bit(slot.index_);
+      if (slot.inline_)
+        destroyInline<T>(address(slot));
+      else
+        destroyOnHeap<T>(address(slot));
+    }
+  }
+
+ private:
+  typedef void (*Destroyer)(void* address);
+
+  static int allocateSlot(size_t size, size_t align, bool* inlined, size_t* offset,
+                          Destroyer destroyInline, Destroyer destroyOnHeap);
+
+  template<typename T>
+  static void destroyInline(void* address)
+  {
+    static_cast<T*>(address)->~T();
+  }
+
+  template<typename T>
+  static void destroyOnHeap(void* address)
+  {
+    delete *static_cast<T**>(address);
+  }
+
+  static unsigned bit(int index) { return 1u << index; }
+
+  template<typename T>
+  void* address(ContextSlot<T> slot)
+  {
+    return reinterpret_cast<char*>(&storage_) + slot.offset_;
+  }
+
+  unsigned constructed_;
+  std::aligned_storage<kStorageSize, alignof(max_align_t)>::type storage_;
+};
+
+}  // namespace net
+}  // namespace muduo
+
+#endif  // MUDUO_NET_CONNECTIONCONTEXT_H
@@ -12,6 +12,7 @@
 #include "muduo/base/Logging.h"
 #include "muduo/net/Channel.h"
 #include "muduo/net/EventLoop.h"
+#include "muduo/net/Resolver.h"
 #include "muduo/net/SocketsOps.h"
 
 #include <errno.h>
@@ -24,6 +25,7 @@ const int Connector::kMaxRetryDelayMs;
 Connector::Connector(EventLoop* loop, const InetAddress& serverAddr)
   : loop_(loop),
     serverAddr_(serverAddr),
+    resolver_(NULL),
     connect_(false),
     state_(kDisconnected),
     retryDelayMs_(kInitRetryDelayMs)
@@ -31,6 +33,20 @@ Connector::Connector(EventLoop* loop, const InetAddress& serverAddr)
   LOG_DEBUG << "ctor[" << this << "]";
 }
 
+Connector::Connector(EventLoop* loop, Resolver* resolver,
+                     const string& host, uint16_t port)
+  : loop_(loop),
+    serverAddr_(port),
+    resolver_(CHECK_NOTNULL(resolver)),
+    host_(host),
+    connect_(false),
+    state_(kDisconnected),
+    retryDelayMs_(kInitRetryDelayMs)
+{
+  assert(resolver_->getLoop() == loop_);
+  LOG_DEBUG << "ctor[" << this << "] host " << host_;
+}
+
 Connector::~Connector()
 {
   LOG_DEBUG << "dtor[" << this << "]";
@@ -49,7 +65,16 @@ void Connector::startInLoop()
   assert(state_ == kDisconnected);
   if (connect_)
   {
-    connect();
+    if (resolver_)
+    {
+      // resolved again for every attempt, answers are cached by resolver_
+      resolver_->resolve(host_,
+          std::bind(&Connector::onResolved, shared_from_this(), _1, _2));
+    }
+    else
+    {
+      connect();
+    }
   }
   else
   {
@@ -57,6 +82,28 @@ void Connector::startInLoop()
   }
 }
 
+void Connector::onResolved(bool found, const InetAddress& addr)
+{
+  loop_->assertInLoopThread();
+  if (!connect_ || state_ != kDisconnected)
+  {
+    LOG_DEBUG << "do not connect";
+    return;
+  }
+  if (found)
+  {
+    struct sockaddr_in resolved = *sockets::sockaddr_in_cast(addr.getSockAddr());
+    resolved.sin_port = serverAddr_.portNetEndian();
+    serverAddr_ = InetAddress(resolved);
+    connect();
+  }
+  else
+  {
+    LOG_ERROR << "Connector::onResolved - cannot resolve " << host_;
+    retryLater();
+  }
+}
+
 void Connector::stop()
 {
   connect_ = false;
@@ -210,9 +257,17 @@ void Connector::retry(int sockfd)
 {
   sockets::close(sockfd);
   setState(kDisconnected);
+  retryLater();
+}
+
+void Connector::retryLater()
+{
   if (connect_)
   {
-    LOG_INFO << "Connector::retry - Retry connecting to " << serverAddr_.toIpPort()
+    // by name, resolved again on the next attempt
+    string target = resolver_ ? host_ + ":" + std::to_string(serverAddr_.toPort())
+                              : serverAddr_.toIpPort();
+    LOG_INFO << "Connector::retry - Retry connecting to " << target
              << " in " << retryDelayMs_ << " milliseconds. ";
     loop_->runAfter(retryDelayMs_/1000.0,
                     std::bind(&Connector::startInLoop, shared_from_this()));
@@ -24,6 +24,7 @@ namespace net
 
 class Channel;
 class EventLoop;
+class Resolver;
 
 class Connector : noncopyable,
                   public std::enable_shared_from_this<Connector>
@@ -32,6 +33,8 @@ class Connector : noncopyable,
   typedef std::function<void (int sockfd)> NewConnectionCallback;
 
   Connector(EventLoop* loop, const InetAddress& serverAddr);
+  /// Resolves @c host with @c resolver before every connecting attempt.
+  Connector(EventLoop* loop, Resolver* resolver, const string& host, uint16_t port);
   ~Connector();
 
   void setNewConnectionCallback(const NewConnectionCallback& cb)
@@ -53,14 +56,18 @@ class Connector : noncopyable,
   void stopInLoop();
   void connect();
   void connecting(int sockfd);
+  void onResolved(bool found, const InetAddress& addr);
   void handleWrite();
   void handleError();
   void retry(int sockfd);
+  void retryLater();
   int removeAndResetChannel();
   void resetChannel();
 
   EventLoop* loop_;
   InetAddress serverAddr_;
+  Resolver* resolver_;  // NULL if connecting to a fixed address
+  const string host_;
   bool connect_; // atomic
   States state_;  // FIXME: use atomic variable
   std::unique_ptr<Channel> channel_;
@@ -253,18 +253,18 @@ void EventLoop::handleRead()
 
 void EventLoop::doPendingFunctors()
 {
-  std::vector<Functor> functors;
   callingPendingFunctors_ = true;
 
   {
   MutexLockGuard lock(mutex_);
-  functors.swap(pendingFunctors_);
+  runningFunctors_.swap(pendingFunctors_);
   }
 
-  for (const Functor& functor : functors)
+  for (const Functor& functor : runningFunctors_)
   {
     functor();
   }
+  runningFunctors_.clear();
   callingPendingFunctors_ = false;
 }
 
@@ -17,6 +17,7 @@
 
 #include <boost/any.hpp>
 
+#include "muduo/base/InlineFunction.h"
 #include "muduo/base/Mutex.h"
 #include "muduo/base/CurrentThread.h"
 #include "muduo/base/Timestamp.h"
@@ -39,7 +40,9 @@ class TimerQueue;
 class EventLoop : noncopyable
 {
  public:
-  typedef std::function<void()> Functor;
+  /// Move-only, binds of a few arguments are kept inline,
+  /// so posting to another loop doesn't allocate.
+  typedef InlineFunction<void()> Functor;
 
   EventLoop();
   ~EventLoop();  // force out-line dtor, for std::unique_ptr members.
@@ -158,6 +161,8 @@ class EventLoop : noncopyable
 
   mutable MutexLock mutex_;
   std::vector<Functor> pendingFunctors_ GUARDED_BY(mutex_);
+  // swapped with pendingFunctors_, both keep their capacity
+  std::vector<Functor> runningFunctors_;
 };
 
 }  // namespace net
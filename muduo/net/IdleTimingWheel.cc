@@ -0,0 +1,88 @@
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+//
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+
+#include "muduo/net/IdleTimingWheel.h"
+
+#include "muduo/base/Logging.h"
+#include "muduo/net/EventLoop.h"
+#include "muduo/net/TcpConnection.h"
+
+#include <algorithm>
+
+#include <math.h>
+
+using namespace muduo;
+using namespace muduo::net;
+
+namespace
+{
+// a connection is closed at most 1/kTicksPerTimeout of timeout late
+const int kTicksPerTimeout = 8;
+}  // namespace
+
+IdleTimingWheel::IdleTimingWheel(EventLoop* loop, double idleSeconds)
+  : loop_(CHECK_NOTNULL(loop)),
+    idleSeconds_(idleSeconds),
+    tick_(idleSeconds / kTicksPerTimeout),
+    buckets_(kTicksPerTimeout + 2),
+    current_(0),
+    size_(0),
+    lastTick_(Timestamp::now())
+{
+  assert(idleSeconds_ > 0.0);
+  timer_ = loop_->runEvery(tick_, std::bind(&IdleTimingWheel::onTick, this));
+}
+
+IdleTimingWheel::~IdleTimingWheel()
+{
+  loop_->assertInLoopThread();
+  loop_->cancel(timer_);
+}
+
+void IdleTimingWheel::add(const TcpConnectionPtr& conn)
+{
+  loop_->assertInLoopThread();
+  assert(conn->getLoop() == loop_);
+  schedule(conn, addTime(conn->lastReceiveTime(), idleSeconds_));
+}
+
+void IdleTimingWheel::schedule(const TcpConnectionPtr& conn, Timestamp deadline)
+{
+  double ticks = ceil(timeDifference(deadline, lastTick_) / tick_);
+  size_t ahead = static_cast<size_t>(std::max(ticks, 1.0));
+  ahead = std::min(ahead, buckets_.size() - 1);
+  buckets_[(current_ + ahead) % buckets_.size()].push_back(conn);
+  ++size_;
+}
+
+void IdleTimingWheel::onTick()
+{
+  loop_->assertInLoopThread();
+  lastTick_ = Timestamp::now();
+  current_ = (current_ + 1) % buckets_.size();
+  Bucket due;
+  due.swap(buckets_[current_]);
+  size_ -= due.size();
+
+  for (const WeakTcpConnectionPtr& weakConn : due)
+  {
+    TcpConnectionPtr conn(weakConn.lock());
+    if (!conn || conn->disconnected())
+      continue;
+
+    // rescheduled lazily, messages only touch lastReceiveTime
+    Timestamp deadline(addTime(conn->lastReceiveTime(), idleSeconds_));
+    if (deadline <= lastTick_)
+    {
+      LOG_INFO << "IdleTimingWheel::onTick - closing idle connection "
+               << conn->name();
+      conn->forceClose();
+    }
+    else
+    {
+      schedule(conn, deadline);
+    }
+  }
+}
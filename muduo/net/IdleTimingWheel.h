@@ -0,0 +1,65 @@
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+//
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+//
+// This is an internal header file, you should not include this.
+
+#ifndef MUDUO_NET_IDLETIMINGWHEEL_H
+#define MUDUO_NET_IDLETIMINGWHEEL_H
+
+#include "muduo/base/noncopyable.h"
+#include "muduo/base/Timestamp.h"
+#include "muduo/net/Callbacks.h"
+#include "muduo/net/TimerId.h"
+
+#include <vector>
+
+namespace muduo
+{
+namespace net
+{
+
+class EventLoop;
+
+///
+/// Closes connections of one loop that have received nothing for a while.
+///
+/// A timing wheel of weak connections, bucketed by the time they may
+/// expire.  Connections are not moved on every message, only their
+/// TcpConnection::lastReceiveTime() changes.  When a bucket comes due,
+/// each live connection is either closed or put back into the bucket of
+/// its new deadline.  One timer per loop, no matter how many connections.
+///
+class IdleTimingWheel : noncopyable
+{
+ public:
+  IdleTimingWheel(EventLoop* loop, double idleSeconds);
+  ~IdleTimingWheel();
+
+  /// Must be called in loop thread, after TcpConnection::connectEstablished
+  void add(const TcpConnectionPtr& conn);
+
+  size_t size() const { return size_; }
+
+ private:
+  typedef std::weak_ptr<TcpConnection> WeakTcpConnectionPtr;
+  typedef std::vector<WeakTcpConnectionPtr> Bucket;
+
+  void onTick();
+  void schedule(const TcpConnectionPtr& conn, Timestamp deadline);
+
+  EventLoop* loop_;
+  const double idleSeconds_;
+  const double tick_;
+  std::vector<Bucket> buckets_;
+  size_t current_;
+  size_t size_;
+  Timestamp lastTick_;
+  TimerId timer_;
+};
+
+}  // namespace net
+}  // namespace muduo
+
+#endif  // MUDUO_NET_IDLETIMINGWHEEL_H
@@ -66,6 +66,7 @@ class InetAddress : public muduo::copyable
   // resolve hostname to IP address, not changing port or sin_family
   // return true on success.
   // thread safe
+  // blocking, use Resolver in IO threads
   static bool resolve(StringArg hostname, InetAddress* result);
   // static std::vector<InetAddress> resolveAll(const char* hostname, uint16_t port = 0);
 
@@ -0,0 +1,462 @@
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+//
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+
+#include "muduo/net/Resolver.h"
+
+#include "muduo/base/FileUtil.h"
+#include "muduo/base/Logging.h"
+#include "muduo/net/Buffer.h"
+#include "muduo/net/Channel.h"
+#include "muduo/net/EventLoop.h"
+#include "muduo/net/SocketsOps.h"
+
+#include <algorithm>
+
+#include <arpa/inet.h>  // inet_pton
+#include <errno.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+using namespace muduo;
+using namespace muduo::net;
+
+namespace
+{
+
+const uint16_t kTypeA = 1;
+const uint16_t kClassIN = 1;
+const int kRcodeNoError = 0;
+const int kRcodeNameError = 3;  // NXDOMAIN
+const size_t kHeaderLen = 12;
+const size_t kMaxMessage = 4096;
+
+InetAddress defaultNameserver()
+{
+  string content;
+  FileUtil::readFile("/etc/resolv.conf", 64*1024, &content);
+  size_t pos = 0;
+  while (pos < content.size())
+  {
+    size_t eol = content.find('\n', pos);
+    if (eol == string::npos)
+      eol = content.size();
+    string line(content, pos, eol - pos);
+    pos = eol + 1;
+
+    const char kNameserver[] = "nameserver";
+    if (line.compare(0, sizeof(kNameserver) - 1, kNameserver) == 0)
+    {
+      size_t start = line.find_first_not_of(" \t", sizeof(kNameserver) - 1);
+      if (start == string::npos || start == sizeof(kNameserver) - 1)
+        continue;
+      size_t end = line.find_first_of(" \t\r", start);
+      string ip(line, start, end == string::npos ? string::npos : end - start);
+      struct in_addr addr;
+      if (::inet_pton(AF_INET, ip.c_str(), &addr) == 1)
+      {
+        return InetAddress(ip, 53);
+      }
+    }
+  }
+  return InetAddress("127.0.0.1", 53);
+}
+
+int createUdpSocket(const InetAddress& nameserver)
+{
+  int sockfd = ::socket(nameserver.family(),
+                        SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC,
+                        IPPROTO_UDP);
+  if (sockfd < 0)
+  {
+    LOG_SYSFATAL << "Resolver::createUdpSocket";
+  }
+  // connected UDP socket only receives datagrams from the nameserver
+  if (sockets::connect(sockfd, nameserver.getSockAddr()) < 0)
+  {
+    LOG_SYSERR << "Resolver::createUdpSocket connect " << nameserver.toIpPort();
+  }
+  return sockfd;
+}
+
+// Encodes a DNS query of type A, returns false if hostname is malformed.
+bool encodeQuery(uint16_t id, const string& hostname, Buffer* buf)
+{
+  if (hostname.empty() || hostname.size() > 253)
+    return false;
+
+  buf->appendInt16(static_cast<int16_t>(id));
+  buf->appendInt16(0x0100);  // standard query, recursion desired
+  buf->appendInt16(1);       // QDCOUNT
+  buf->appendInt16(0);       // ANCOUNT
+  buf->appendInt16(0);       // NSCOUNT
+  buf->appendInt16(0);       // ARCOUNT
+  size_t start = 0;
+  while (start < hostname.size())
+  {
+    size_t dot = hostname.find('.', start);
+    if (dot == string::npos)
+      dot = hostname.size();
+    size_t len = dot - start;
+    if (len == 0 || len > 63)
+      return false;
+    buf->appendInt8(static_cast<int8_t>(len));
+    buf->append(hostname.data() + start, len);
+    start = dot + 1;
+  }
+  buf->appendInt8(0);
+  buf->appendInt16(kTypeA);
+  buf->appendInt16(kClassIN);
+  return true;
+}
+
+uint16_t readUint16(const unsigned char* p)
+{
+  return static_cast<uint16_t>((p[0] << 8) | p[1]);
+}
+
+uint32_t readUint32(const unsigned char* p)
+{
+  return (static_cast<uint32_t>(readUint16(p)) << 16) | readUint16(p + 2);
+}
+
+// Skips a possibly compressed domain name, returns false on truncation.
+bool skipName(const unsigned char* msg, size_t len, size_t* offset)
+{
+  size_t off = *offset;
+  while (off < len)
+  {
+    unsigned char c = msg[off];
+    if (c == 0)
+    {
+      *offset = off + 1;
+      return true;
+    }
+    else if ((c & 0xC0) == 0xC0)
+    {
+      *offset = off + 2;
+      return *offset <= len;
+    }
+    off += c + 1;
+  }
+  return false;
+}
+
+// Reads an uncompressed domain name, as a question echoes it.
+bool readName(const unsigned char* msg, size_t len, size_t* offset, string* name)
+{
+  size_t off = *offset;
+  while (off < len)
+  {
+    size_t c = msg[off];
+    if (c == 0)
+    {
+      *offset = off + 1;
+      return true;
+    }
+    else if (c > 63 || off + 1 + c > len ||
+             memchr(msg + off + 1, '.', c) != NULL)
+    {
+      return false;
+    }
+    if (!name->empty())
+      *name += '.';
+    name->append(reinterpret_cast<const char*>(msg + off + 1), c);
+    off += c + 1;
+  }
+  return false;
+}
+
+struct Answer
+{
+  uint16_t id;
+  string name;
+  uint16_t qtype;
+  uint16_t qclass;
+  int rcode;
+  bool found;
+  struct in_addr addr;
+  uint32_t ttl;
+};
+
+// Parses the header, the question and the first A record of answer section.
+bool decodeResponse(const unsigned char* msg, size_t len, Answer* answer)
+{
+  if (len < kHeaderLen)
+    return false;
+  answer->id = readUint16(msg);
+  if ((msg[2] & 0x80) == 0)  // not a response
+    return false;
+  answer->rcode = msg[3] & 0x0F;
+  answer->found = false;
+  memZero(&answer->addr, sizeof answer->addr);
+  answer->ttl = UINT32_MAX;
+  uint16_t qdcount = readUint16(msg + 4);
+  uint16_t ancount = readUint16(msg + 6);
+
+  // we ask one question, the response echoes it
+  size_t off = kHeaderLen;
+  if (qdcount != 1 || !readName(msg, len, &off, &answer->name) || off + 4 > len)
+    return false;
+  answer->qtype = readUint16(msg + off);
+  answer->qclass = readUint16(msg + off + 2);
+  off += 4;
+  // CNAME records come before the A record, all of them bound the TTL
+  for (uint16_t i = 0; i < ancount && !answer->found; ++i)
+  {
+    if (!skipName(msg, len, &off) || off + 10 > len)
+      return false;
+    uint16_t type = readUint16(msg + off);
+    uint16_t klass = readUint16(msg + off + 2);
+    uint32_t ttl = readUint32(msg + off + 4);
+    uint16_t rdlength = readUint16(msg + off + 8);
+    off += 10;
+    if (off + rdlength > len)
+      return false;
+    answer->ttl = std::min(answer->ttl, ttl);
+    if (type == kTypeA && klass == kClassIN && rdlength == 4)
+    {
+      memcpy(&answer->addr, msg + off, 4);
+      answer->found = true;
+    }
+    off += rdlength;
+  }
+  return true;
+}
+
+// names are case insensitive, the trailing dot is optional
+bool sameName(const string& name, const string& hostname)
+{
+  size_t len = hostname.size();
+  if (len > 0 && hostname[len - 1] == '.')
+    --len;
+  return name.size() == len && ::strncasecmp(name.data(), hostname.data(), len) == 0;
+}
+
+}  // namespace
+
+Resolver::Resolver(EventLoop* loop)
+  : Resolver(loop, defaultNameserver())
+{
+}
+
+Resolver::Resolver(EventLoop* loop, const InetAddress& nameserver)
+  : loop_(CHECK_NOTNULL(loop)),
+    nameserver_(nameserver),
+    sockfd_(createUdpSocket(nameserver)),
+    channel_(new Channel(loop, sockfd_)),
+    timeout_(2.0),
+    attempts_(3),
+    maxTtl_(3600.0),
+    negativeTtl_(30.0),
+    nextId_(static_cast<uint16_t>(Timestamp::now().microSecondsSinceEpoch() ^ ::getpid()))
+{
+  channel_->setReadCallback(
+      std::bind(&Resolver::handleRead, this, _1));
+  channel_->enableReading();
+  LOG_DEBUG << "Resolver::Resolver nameserver " << nameserver_.toIpPort();
+}
+
+Resolver::~Resolver()
+{
+  loop_->assertInLoopThread();
+  for (const auto& item : queries_)
+  {
+    loop_->cancel(item.second->timer);
+  }
+  channel_->disableAll();
+  channel_->remove();
+  sockets::close(sockfd_);
+}
+
+void Resolver::resolve(const string& hostname, const Callback& cb)
+{
+  if (loop_->isInLoopThread())
+  {
+    resolveInLoop(hostname, cb);
+  }
+  else
+  {
+    loop_->queueInLoop(
+        std::bind(&Resolver::resolveInLoop, this, hostname, cb));
+  }
+}
+
+void Resolver::resolveInLoop(const string& hostname, const Callback& cb)
+{
+  loop_->assertInLoopThread();
+
+  struct sockaddr_in addr;
+  memZero(&addr, sizeof addr);
+  addr.sin_family = AF_INET;
+  if (::inet_pton(AF_INET, hostname.c_str(), &addr.sin_addr) == 1)
+  {
+    cb(true, InetAddress(addr));
+    return;
+  }
+
+  auto cached = cache_.find(hostname);
+  if (cached != cache_.end())
+  {
+    if (Timestamp::now() < cached->second.expiration)
+    {
+      LOG_TRACE << "Resolver::resolve " << hostname << " cache hit";
+      cb(cached->second.found, cached->second.addr);
+      return;
+    }
+    cache_.erase(cached);
+  }
+
+  auto pending = pendingNames_.find(hostname);
+  if (pending != pendingNames_.end())
+  {
+    queries_[pending->second]->callbacks.push_back(cb);
+    return;
+  }
+
+  // skip ids still in flight after wrapping around
+  while (queries_.find(nextId_) != queries_.end())
+  {
+    ++nextId_;
+  }
+  std::unique_ptr<Query> query(new Query);
+  query->hostname = hostname;
+  query->id = nextId_++;
+  query->attempts = 0;
+  query->callbacks.push_back(cb);
+  Query* q = get_pointer(query);
+  queries_[q->id] = std::move(query);
+  pendingNames_[hostname] = q->id;
+  sendQuery(q);
+}
+
+void Resolver::sendQuery(Query* query)
+{
+  Buffer buf;
+  if (!encodeQuery(query->id, query->hostname, &buf))
+  {
+    LOG_ERROR << "Resolver::sendQuery invalid hostname " << query->hostname;
+    finish(query->id, false, InetAddress());
+    return;
+  }
+  ++query->attempts;
+  ssize_t n = ::send(sockfd_, buf.peek(), buf.readableBytes(), 0);
+  if (n < 0)
+  {
+    LOG_SYSERR << "Resolver::sendQuery " << query->hostname;
+  }
+  query->timer = loop_->runAfter(
+      timeout_, std::bind(&Resolver::onTimeout, this, query->id));
+}
+
+void Resolver::handleRead(Timestamp receiveTime)
+{
+  loop_->assertInLoopThread();
+  char buf[kMaxMessage];
+  while (true)
+  {
+    ssize_t n = ::recv(sockfd_, buf, sizeof buf, 0);
+    if (n < 0)
+    {
+      // ECONNREFUSED comes from ICMP port unreachable, let it time out
+      if (errno != EAGAIN && errno != EWOULDBLOCK && errno != ECONNREFUSED)
+      {
+        LOG_SYSERR << "Resolver::handleRead";
+      }
+      break;
+    }
+    onResponse(buf, static_cast<size_t>(n), receiveTime);
+  }
+}
+
+void Resolver::onResponse(const char* data, size_t len, Timestamp receiveTime)
+{
+  Answer answer;
+  if (!decodeResponse(reinterpret_cast<const unsigned char*>(data), len, &answer))
+  {
+    LOG_WARN << "Resolver::onResponse malformed response of " << len << " bytes";
+    return;
+  }
+  auto it = queries_.find(answer.id);
+  if (it == queries_.end())
+  {
+    LOG_DEBUG << "Resolver::onResponse unknown id " << answer.id;
+    return;
+  }
+  Query* query = get_pointer(it->second);
+  if (!sameName(answer.name, query->hostname) ||
+      answer.qtype != kTypeA || answer.qclass != kClassIN)
+  {
+    // a late or forged answer to another question, keep waiting
+    LOG_WARN << "Resolver::onResponse " << query->hostname
+             << " answered for " << answer.name << " type " << answer.qtype;
+    return;
+  }
+  loop_->cancel(query->timer);
+
+  struct sockaddr_in addr;
+  memZero(&addr, sizeof addr);
+  addr.sin_family = AF_INET;
+  InetAddress result(addr);
+  bool found = false;
+  double ttl = 0.0;
+  if (answer.rcode == kRcodeNoError && answer.found)
+  {
+    addr.sin_addr = answer.addr;
+    result = InetAddress(addr);
+    found = true;
+    ttl = std::min(static_cast<double>(answer.ttl), maxTtl_);
+  }
+  else if (answer.rcode == kRcodeNameError
+           || (answer.rcode == kRcodeNoError && !answer.found))
+  {
+    ttl = negativeTtl_;
+  }
+  else
+  {
+    LOG_WARN << "Resolver::onResponse " << query->hostname
+             << " rcode = " << answer.rcode;
+  }
+
+  if (ttl > 0.0)
+  {
+    Entry& entry = cache_[query->hostname];
+    entry.addr = result;
+    entry.found = found;
+    entry.expiration = addTime(receiveTime, ttl);
+  }
+  finish(answer.id, found, result);
+}
+
+void Resolver::onTimeout(uint16_t id)
+{
+  auto it = queries_.find(id);
+  assert(it != queries_.end());
+  Query* query = get_pointer(it->second);
+  if (query->attempts < attempts_)
+  {
+    LOG_DEBUG << "Resolver::onTimeout " << query->hostname << " retrying";
+    sendQuery(query);
+  }
+  else
+  {
+    LOG_WARN << "Resolver::onTimeout " << query->hostname << " timed out";
+    finish(id, false, InetAddress());
+  }
+}
+
+void Resolver::finish(uint16_t id, bool found, const InetAddress& addr)
+{
+  auto it = queries_.find(id);
+  assert(it != queries_.end());
+  std::unique_ptr<Query> query(std::move(it->second));
+  queries_.erase(it);
+  pendingNames_.erase(query->hostname);
+  // callbacks may call resolve() again
+  for (const Callback& cb : query->callbacks)
+  {
+    cb(found, addr);
+  }
+}
@@ -0,0 +1,114 @@
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+//
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+//
+// This is a public header file, it must only include public header files.
+
+#ifndef MUDUO_NET_RESOLVER_H
+#define MUDUO_NET_RESOLVER_H
+
+#include "muduo/base/noncopyable.h"
+#include "muduo/base/StringPiece.h"
+#include "muduo/base/Timestamp.h"
+#include "muduo/net/InetAddress.h"
+#include "muduo/net/TimerId.h"
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace muduo
+{
+namespace net
+{
+
+class Channel;
+class EventLoop;
+
+///
+/// Asynchronous DNS stub resolver for IPv4 addresses, with a TTL cache.
+///
+/// Queries are sent over UDP to a single nameserver, answers are read in
+/// the owner loop through a Channel, so resolving never blocks an IO thread.
+/// An answer must match the id, name and type of its query.
+/// Successful answers are cached for their TTL, NXDOMAIN answers for
+/// @c negativeTtl seconds.  Concurrent queries for one name are merged.
+///
+/// It does not read /etc/hosts, use InetAddress::resolve() for that.
+///
+class Resolver : noncopyable
+{
+ public:
+  /// @c found is false if the name does not exist or the query timed out,
+  /// the port of @c addr is always 0.
+  typedef std::function<void (bool found, const InetAddress& addr)> Callback;
+
+  /// Uses the first nameserver in /etc/resolv.conf.
+  explicit Resolver(EventLoop* loop);
+  Resolver(EventLoop* loop, const InetAddress& nameserver);
+  ~Resolver();
+
+  EventLoop* getLoop() const { return loop_; }
+  const InetAddress& nameserver() const { return nameserver_; }
+
+  /// Seconds to wait for each attempt, and how many attempts to make.
+  void setTimeout(double seconds, int attempts)
+  { timeout_ = seconds; attempts_ = attempts; }
+
+  /// Cap of positive TTL, and TTL of NXDOMAIN answers, in seconds.
+  void setCacheTtl(double maxTtl, double negativeTtl)
+  { maxTtl_ = maxTtl; negativeTtl_ = negativeTtl; }
+
+  /// Resolves @c hostname, @c cb is called in loop thread.
+  /// It's called before returning on cache hit, if in loop thread.
+  /// Thread safe.
+  void resolve(const string& hostname, const Callback& cb);
+
+  /// Number of names in cache, for testing.
+  size_t cacheSize() const { return cache_.size(); }
+  void clearCache() { cache_.clear(); }
+
+ private:
+  struct Entry
+  {
+    InetAddress addr;
+    bool found;
+    Timestamp expiration;
+  };
+
+  struct Query
+  {
+    string hostname;
+    uint16_t id;
+    int attempts;
+    TimerId timer;
+    std::vector<Callback> callbacks;
+  };
+
+  void resolveInLoop(const string& hostname, const Callback& cb);
+  void sendQuery(Query* query);
+  void handleRead(Timestamp receiveTime);
+  void onResponse(const char* data, size_t len, Timestamp receiveTime);
+  void onTimeout(uint16_t id);
+  void finish(uint16_t id, bool found, const InetAddress& addr);
+
+  EventLoop* loop_;
+  const InetAddress nameserver_;
+  const int sockfd_;
+  std::unique_ptr<Channel> channel_;
+  double timeout_;
+  int attempts_;
+  double maxTtl_;
+  double negativeTtl_;
+  uint16_t nextId_;
+  std::map<string, Entry> cache_;
+  std::map<string, uint16_t> pendingNames_;
+  std::map<uint16_t, std::unique_ptr<Query>> queries_;
+};
+
+}  // namespace net
+}  // namespace muduo
+
+#endif  // MUDUO_NET_RESOLVER_H
@@ -16,7 +16,8 @@
 #include <fcntl.h>
 #include <stdio.h>  // snprintf
 #include <sys/socket.h>
-#include <sys/uio.h>  // readv
+#include <sys/sendfile.h>
+#include <sys/uio.h>  // readv, writev
 #include <unistd.h>
 
 using namespace muduo;
@@ -176,6 +177,16 @@ ssize_t sockets::write(int sockfd, const void *buf, size_t count)
   return ::write(sockfd, buf, count);
 }
 
+ssize_t sockets::writev(int sockfd, const struct iovec *iov, int iovcnt)
+{
+  return ::writev(sockfd, iov, iovcnt);
+}
+
+ssize_t sockets::sendfile(int sockfd, int fd, off_t* offset, size_t count)
+{
+  return ::sendfile(sockfd, fd, offset, count);
+}
+
 void sockets::close(int sockfd)
 {
   if (::close(sockfd) < 0)
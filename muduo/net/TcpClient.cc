@@ -70,6 +70,27 @@ TcpClient::TcpClient(EventLoop* loop,
            << "] - connector " << get_pointer(connector_);
 }
 
+TcpClient::TcpClient(EventLoop* loop,
+                     Resolver* resolver,
+                     const string& host,
+                     uint16_t port,
+                     const string& nameArg)
+  : loop_(CHECK_NOTNULL(loop)),
+    connector_(new Connector(loop, resolver, host, port)),
+    name_(nameArg),
+    connectionCallback_(defaultConnectionCallback),
+    messageCallback_(defaultMessageCallback),
+    retry_(false),
+    connect_(true),
+    nextConnId_(1)
+{
+  connector_->setNewConnectionCallback(
+      std::bind(&TcpClient::newConnection, this, _1));
+  LOG_INFO << "TcpClient::TcpClient[" << name_
+           << "] - connector " << get_pointer(connector_)
+           << " to " << host << ":" << port;
+}
+
 TcpClient::~TcpClient()
 {
   LOG_INFO << "TcpClient::~TcpClient[" << name_
@@ -140,12 +161,11 @@ void TcpClient::newConnection(int sockfd)
 
   InetAddress localAddr(sockets::getLocalAddr(sockfd));
   // FIXME poll with zero timeout to double confirm the new connection
-  // FIXME use make_shared if necessary
-  TcpConnectionPtr conn(new TcpConnection(loop_,
-                                          connName,
-                                          sockfd,
-                                          localAddr,
-                                          peerAddr));
+  TcpConnectionPtr conn = std::make_shared<TcpConnection>(loop_,
+                                                          connName,
+                                                          sockfd,
+                                                          localAddr,
+                                                          peerAddr);
 
   conn->setConnectionCallback(connectionCallback_);
   conn->setMessageCallback(messageCallback_);
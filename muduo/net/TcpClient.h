@@ -20,6 +20,7 @@ namespace net
 {
 
 class Connector;
+class Resolver;
 typedef std::shared_ptr<Connector> ConnectorPtr;
 
 class TcpClient : noncopyable
@@ -30,6 +31,14 @@ class TcpClient : noncopyable
   TcpClient(EventLoop* loop,
             const InetAddress& serverAddr,
             const string& nameArg);
+  /// Connects to @c host:port, @c host is resolved by @c resolver
+  /// before every connecting attempt without blocking @c loop.
+  /// @c resolver must run in @c loop.
+  TcpClient(EventLoop* loop,
+            Resolver* resolver,
+            const string& host,
+            uint16_t port,
+            const string& nameArg);
   ~TcpClient();  // force out-line dtor, for std::unique_ptr members.
 
   void connect();
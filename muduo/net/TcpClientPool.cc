@@ -0,0 +1,321 @@
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+//
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+
+#include "muduo/net/TcpClientPool.h"
+
+#include "muduo/base/CountDownLatch.h"
+#include "muduo/base/Logging.h"
+#include "muduo/net/EventLoop.h"
+#include "muduo/net/EventLoopThreadPool.h"
+#include "muduo/net/TcpClient.h"
+
+#include <stdio.h>  // snprintf
+
+using namespace muduo;
+using namespace muduo::net;
+
+struct TcpClientPool::Backend
+{
+  explicit Backend(const InetAddress& addr)
+    : serverAddr(addr),
+      nextSlot(0)
+  {
+  }
+
+  const InetAddress serverAddr;
+  std::vector<Slot*> slots;
+  size_t nextSlot;  // guarded by TcpClientPool::mutex_
+};
+
+// all fields but client are guarded by TcpClientPool::mutex_
+struct TcpClientPool::Slot
+{
+  explicit Slot(Backend* b)
+    : backend(b),
+      outstanding(0)
+  {
+  }
+
+  Backend* const backend;
+  std::unique_ptr<TcpClient> client;
+  TcpConnectionPtr conn;
+  int outstanding;
+  Timestamp lastActive;
+  Timestamp probeSent;  // invalid if no probe is pending
+};
+
+TcpClientPool::TcpClientPool(EventLoop* baseLoop, const string& nameArg)
+  : baseLoop_(CHECK_NOTNULL(baseLoop)),
+    name_(nameArg),
+    threadPool_(new EventLoopThreadPool(baseLoop, name_)),
+    connectionCallback_(defaultConnectionCallback),
+    messageCallback_(defaultMessageCallback),
+    healthCheckInterval_(0.0),
+    healthCheckTimeout_(0.0),
+    balancing_(kRoundRobin),
+    connectionsPerBackend_(1),
+    started_(false),
+    nextBackend_(0),
+    nextSlot_(0)
+{
+}
+
+TcpClientPool::~TcpClientPool()
+{
+  baseLoop_->assertInLoopThread();
+  LOG_TRACE << "TcpClientPool::~TcpClientPool [" << name_ << "] destructing";
+  if (!started_)
+  {
+    return;
+  }
+  baseLoop_->cancel(healthCheckTimer_);
+
+  // Detach every client from us and destroy its connection in its own
+  // loop, as TcpServer does, so that no callback can reach a dead pool
+  // and none is left behind when threadPool_ stops the loops.
+  CountDownLatch destroyed(static_cast<int>(slots_.size()));
+  for (const auto& slot : slots_)
+  {
+    TcpClient* client = get_pointer(slot->client);
+    client->getLoop()->runInLoop([client, &destroyed]
+    {
+      client->stop();
+      client->setConnectionCallback(defaultConnectionCallback);
+      client->setMessageCallback(defaultMessageCallback);
+      client->setWriteCompleteCallback(WriteCompleteCallback());
+      TcpConnectionPtr conn = client->connection();
+      if (conn)
+      {
+        conn->setConnectionCallback(defaultConnectionCallback);
+        conn->setMessageCallback(defaultMessageCallback);
+        conn->setWriteCompleteCallback(WriteCompleteCallback());
+        conn->connectDestroyed();
+      }
+      destroyed.countDown();
+    });
+  }
+  destroyed.wait();
+  slots_.clear();
+}
+
+void TcpClientPool::addBackend(const InetAddress& serverAddr)
+{
+  assert(!started_);
+  backends_.emplace_back(new Backend(serverAddr));
+}
+
+void TcpClientPool::setConnectionsPerBackend(int n)
+{
+  assert(!started_);
+  assert(0 < n);
+  connectionsPerBackend_ = n;
+}
+
+void TcpClientPool::setThreadNum(int numThreads)
+{
+  assert(0 <= numThreads);
+  threadPool_->setThreadNum(numThreads);
+}
+
+void TcpClientPool::setHealthCheck(const HealthCheckCallback& cb,
+                                   double interval,
+                                   double timeout)
+{
+  assert(!started_);
+  assert(interval > 0.0 && timeout > 0.0);
+  healthCheckCallback_ = cb;
+  healthCheckInterval_ = interval;
+  healthCheckTimeout_ = timeout;
+}
+
+void TcpClientPool::start()
+{
+  baseLoop_->assertInLoopThread();
+  assert(!started_);
+  started_ = true;
+  threadPool_->start(threadInitCallback_);
+
+  // connections of one backend are spread over all loops
+  for (const auto& backend : backends_)
+  {
+    for (int i = 0; i < connectionsPerBackend_; ++i)
+    {
+      char buf[32];
+      snprintf(buf, sizeof buf, "#%zu", slots_.size());
+      Slot* slot = new Slot(get_pointer(backend));
+      slots_.emplace_back(slot);
+      backend->slots.push_back(slot);
+      slot->client.reset(new TcpClient(threadPool_->getNextLoop(),
+                                       backend->serverAddr,
+                                       name_ + buf));
+      slot->client->setConnectionCallback(
+          std::bind(&TcpClientPool::onConnection, this, slot, _1));
+      slot->client->setMessageCallback(
+          std::bind(&TcpClientPool::onMessage, this, slot, _1, _2, _3));
+      slot->client->setWriteCompleteCallback(writeCompleteCallback_);
+      slot->client->enableRetry();
+    }
+  }
+
+  for (const auto& slot : slots_)
+  {
+    slot->client->connect();
+  }
+
+  if (healthCheckCallback_)
+  {
+    healthCheckTimer_ = baseLoop_->runEvery(
+        healthCheckInterval_, std::bind(&TcpClientPool::checkHealth, this));
+  }
+}
+
+TcpConnectionPtr TcpClientPool::acquire()
+{
+  MutexLockGuard lock(mutex_);
+  Slot* slot = balancing_ == kRoundRobin ? pickRoundRobin() : pickLeastOutstanding();
+  if (slot)
+  {
+    ++slot->outstanding;
+    return slot->conn;
+  }
+  return TcpConnectionPtr();
+}
+
+void TcpClientPool::release(const TcpConnectionPtr& conn)
+{
+  MutexLockGuard lock(mutex_);
+  auto it = slotOfConnection_.find(get_pointer(conn));
+  // the connection may be closed while it was checked out
+  if (it != slotOfConnection_.end())
+  {
+    Slot* slot = it->second;
+    assert(slot->outstanding > 0);
+    --slot->outstanding;
+    slot->lastActive = Timestamp::now();
+  }
+}
+
+int TcpClientPool::numConnected() const
+{
+  MutexLockGuard lock(mutex_);
+  return static_cast<int>(slotOfConnection_.size());
+}
+
+TcpClientPool::Slot* TcpClientPool::pickRoundRobin()
+{
+  for (size_t i = 0; i < backends_.size(); ++i)
+  {
+    Backend* backend = get_pointer(backends_[nextBackend_]);
+    nextBackend_ = (nextBackend_ + 1) % backends_.size();
+    for (size_t j = 0; j < backend->slots.size(); ++j)
+    {
+      Slot* slot = backend->slots[backend->nextSlot];
+      backend->nextSlot = (backend->nextSlot + 1) % backend->slots.size();
+      if (slot->conn)
+      {
+        return slot;
+      }
+    }
+  }
+  return NULL;
+}
+
+TcpClientPool::Slot* TcpClientPool::pickLeastOutstanding()
+{
+  Slot* best = NULL;
+  // start from a rotating position, so that ties are spread evenly
+  for (size_t i = 0; i < slots_.size(); ++i)
+  {
+    Slot* slot = get_pointer(slots_[(nextSlot_ + i) % slots_.size()]);
+    if (slot->conn && (!best || slot->outstanding < best->outstanding))
+    {
+      best = slot;
+      if (best->outstanding == 0)
+      {
+        break;
+      }
+    }
+  }
+  if (!slots_.empty())
+  {
+    nextSlot_ = (nextSlot_ + 1) % slots_.size();
+  }
+  return best;
+}
+
+void TcpClientPool::onConnection(Slot* slot, const TcpConnectionPtr& conn)
+{
+  LOG_INFO << "TcpClientPool::onConnection [" << name_ << "] - "
+           << conn->name() << " is " << (conn->connected() ? "UP" : "DOWN");
+  {
+    MutexLockGuard lock(mutex_);
+    if (conn->connected())
+    {
+      slot->conn = conn;
+      slot->outstanding = 0;
+      slot->lastActive = Timestamp::now();
+      slot->probeSent = Timestamp::invalid();
+      slotOfConnection_[get_pointer(conn)] = slot;
+    }
+    else
+    {
+      slot->conn.reset();
+      slotOfConnection_.erase(get_pointer(conn));
+    }
+  }
+  connectionCallback_(conn);
+}
+
+void TcpClientPool::onMessage(Slot* slot, const TcpConnectionPtr& conn,
+                              Buffer* buf, Timestamp receiveTime)
+{
+  {
+    MutexLockGuard lock(mutex_);
+    slot->lastActive = receiveTime;
+    slot->probeSent = Timestamp::invalid();
+  }
+  messageCallback_(conn, buf, receiveTime);
+}
+
+void TcpClientPool::checkHealth()
+{
+  baseLoop_->assertInLoopThread();
+  Timestamp now(Timestamp::now());
+  std::vector<TcpConnectionPtr> toProbe;
+  std::vector<TcpConnectionPtr> toClose;
+  {
+    MutexLockGuard lock(mutex_);
+    for (const auto& slot : slots_)
+    {
+      // busy connections are checked by the requests themselves
+      if (!slot->conn || slot->outstanding > 0)
+        continue;
+
+      if (slot->probeSent.valid())
+      {
+        if (timeDifference(now, slot->probeSent) > healthCheckTimeout_)
+        {
+          toClose.push_back(slot->conn);
+        }
+      }
+      else if (timeDifference(now, slot->lastActive) >= healthCheckInterval_)
+      {
+        slot->probeSent = now;
+        toProbe.push_back(slot->conn);
+      }
+    }
+  }
+
+  for (const auto& conn : toClose)
+  {
+    LOG_WARN << "TcpClientPool::checkHealth [" << name_ << "] - "
+             << conn->name() << " failed health check, reconnecting";
+    conn->forceClose();
+  }
+  for (const auto& conn : toProbe)
+  {
+    conn->getLoop()->runInLoop(std::bind(healthCheckCallback_, conn));
+  }
+}
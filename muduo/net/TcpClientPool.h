@@ -0,0 +1,151 @@
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+//
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+//
+// This is a public header file, it must only include public header files.
+
+#ifndef MUDUO_NET_TCPCLIENTPOOL_H
+#define MUDUO_NET_TCPCLIENTPOOL_H
+
+#include "muduo/base/Mutex.h"
+#include "muduo/net/InetAddress.h"
+#include "muduo/net/TcpConnection.h"
+#include "muduo/net/TimerId.h"
+
+#include <map>
+#include <vector>
+
+namespace muduo
+{
+namespace net
+{
+
+class EventLoop;
+class EventLoopThreadPool;
+class TcpClient;
+
+///
+/// A pool of warm TCP connections to a set of backends.
+///
+/// Keeps @c connectionsPerBackend() connections open to every backend,
+/// spread over IO loops, reconnecting with TcpClient's retry logic.
+/// Callers check a connection out with acquire() for each request and
+/// give it back with release().  Idle connections are probed with
+/// the health check callback, and closed if they stay silent.
+///
+class TcpClientPool : noncopyable
+{
+ public:
+  typedef std::function<void(EventLoop*)> ThreadInitCallback;
+  typedef std::function<void (const TcpConnectionPtr&)> HealthCheckCallback;
+
+  enum Balancing
+  {
+    kRoundRobin,
+    kLeastOutstanding,
+  };
+
+  TcpClientPool(EventLoop* baseLoop, const string& nameArg);
+  ~TcpClientPool();  // force out-line dtor, for std::unique_ptr members.
+
+  const string& name() const { return name_; }
+  EventLoop* getLoop() const { return baseLoop_; }
+
+  /// Must be called before @c start
+  void addBackend(const InetAddress& serverAddr);
+
+  /// Must be called before @c start
+  void setConnectionsPerBackend(int n);
+  int connectionsPerBackend() const { return connectionsPerBackend_; }
+
+  /// Set the number of IO threads, same meaning as TcpServer::setThreadNum.
+  /// Must be called before @c start
+  void setThreadNum(int numThreads);
+  void setThreadInitCallback(const ThreadInitCallback& cb)
+  { threadInitCallback_ = cb; }
+
+  /// Must be called before @c start
+  void setBalancing(Balancing balancing) { balancing_ = balancing; }
+
+  /// Probe idle connections every @c interval seconds with @c cb, which
+  /// runs in the connection's loop and usually sends a ping.  A probed
+  /// connection that receives nothing within @c timeout seconds is closed
+  /// and reconnected.
+  /// Must be called before @c start
+  void setHealthCheck(const HealthCheckCallback& cb, double interval, double timeout);
+
+  /// Opens all connections.
+  /// Must be called in base loop's thread.
+  void start();
+
+  /// Checks out the best connection according to the balancing policy.
+  /// Returns an empty pointer if no backend is connected.
+  /// Thread safe.
+  TcpConnectionPtr acquire();
+
+  /// Returns a connection got from acquire().
+  /// Thread safe.
+  void release(const TcpConnectionPtr& conn);
+
+  /// Number of connections that are up.
+  /// Thread safe.
+  int numConnected() const;
+
+  /// Set connection callback.
+  /// Not thread safe.
+  void setConnectionCallback(const ConnectionCallback& cb)
+  { connectionCallback_ = cb; }
+
+  /// Set message callback.
+  /// Not thread safe.
+  void setMessageCallback(const MessageCallback& cb)
+  { messageCallback_ = cb; }
+
+  /// Set write complete callback.
+  /// Not thread safe.
+  void setWriteCompleteCallback(const WriteCompleteCallback& cb)
+  { writeCompleteCallback_ = cb; }
+
+ private:
+  struct Slot;
+  struct Backend;
+
+  /// Not thread safe, but in slot's loop
+  void onConnection(Slot* slot, const TcpConnectionPtr& conn);
+  /// Not thread safe, but in slot's loop
+  void onMessage(Slot* slot, const TcpConnectionPtr& conn,
+                 Buffer* buf, Timestamp receiveTime);
+  /// Not thread safe, but in base loop
+  void checkHealth();
+
+  Slot* pickRoundRobin() REQUIRES(mutex_);
+  Slot* pickLeastOutstanding() REQUIRES(mutex_);
+
+  EventLoop* baseLoop_;
+  const string name_;
+  std::unique_ptr<EventLoopThreadPool> threadPool_;
+  ThreadInitCallback threadInitCallback_;
+  ConnectionCallback connectionCallback_;
+  MessageCallback messageCallback_;
+  WriteCompleteCallback writeCompleteCallback_;
+  HealthCheckCallback healthCheckCallback_;
+  double healthCheckInterval_;
+  double healthCheckTimeout_;
+  TimerId healthCheckTimer_;
+  Balancing balancing_;
+  int connectionsPerBackend_;
+  bool started_;
+
+  mutable MutexLock mutex_;
+  std::vector<std::unique_ptr<Backend>> backends_;  // fixed after start()
+  std::vector<std::unique_ptr<Slot>> slots_;        // fixed after start()
+  std::map<const TcpConnection*, Slot*> slotOfConnection_ GUARDED_BY(mutex_);
+  size_t nextBackend_ GUARDED_BY(mutex_);
+  size_t nextSlot_ GUARDED_BY(mutex_);
+};
+
+}  // namespace net
+}  // namespace muduo
+
+#endif  // MUDUO_NET_TCPCLIENTPOOL_H
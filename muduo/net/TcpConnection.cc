@@ -16,6 +16,9 @@
 #include "muduo/net/SocketsOps.h"
 
 #include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>  // snprintf
+#include <sys/uio.h>  // writev
 
 using namespace muduo;
 using namespace muduo::net;
@@ -41,6 +44,7 @@ TcpConnection::TcpConnection(EventLoop* loop,
                              const InetAddress& localAddr,
                              const InetAddress& peerAddr)
   : loop_(CHECK_NOTNULL(loop)),
+    id_(0),
     name_(nameArg),
     state_(kConnecting),
     reading_(true),
@@ -48,7 +52,10 @@ TcpConnection::TcpConnection(EventLoop* loop,
     channel_(new Channel(loop, sockfd)),
     localAddr_(localAddr),
     peerAddr_(peerAddr),
-    highWaterMark_(64*1024*1024)
+    highWaterMark_(64*1024*1024),
+    fileFd_(-1),
+    fileOffset_(0),
+    fileRemaining_(0)
 {
   channel_->setReadCallback(
       std::bind(&TcpConnection::handleRead, this, _1));
@@ -63,14 +70,63 @@ TcpConnection::TcpConnection(EventLoop* loop,
   socket_->setKeepAlive(true);
 }
 
+TcpConnection::TcpConnection(EventLoop* loop,
+                             const std::shared_ptr<const string>& namePrefix,
+                             int64_t id,
+                             int sockfd,
+                             const InetAddress& localAddr,
+                             const InetAddress& peerAddr)
+  : loop_(CHECK_NOTNULL(loop)),
+    namePrefix_(namePrefix),
+    id_(id),
+    state_(kConnecting),
+    reading_(true),
+    socket_(new Socket(sockfd)),
+    channel_(new Channel(loop, sockfd)),
+    localAddr_(localAddr),
+    peerAddr_(peerAddr),
+    highWaterMark_(64*1024*1024),
+    fileFd_(-1),
+    fileOffset_(0),
+    fileRemaining_(0)
+{
+  channel_->setReadCallback(
+      std::bind(&TcpConnection::handleRead, this, _1));
+  channel_->setWriteCallback(
+      std::bind(&TcpConnection::handleWrite, this));
+  channel_->setCloseCallback(
+      std::bind(&TcpConnection::handleClose, this));
+  channel_->setErrorCallback(
+      std::bind(&TcpConnection::handleError, this));
+  LOG_DEBUG << "TcpConnection::ctor[" <<  name() << "] at " << this
+            << " fd=" << sockfd;
+  socket_->setKeepAlive(true);
+}
+
 TcpConnection::~TcpConnection()
 {
-  LOG_DEBUG << "TcpConnection::dtor[" <<  name_ << "] at " << this
+  LOG_DEBUG << "TcpConnection::dtor[" <<  name() << "] at " << this
             << " fd=" << channel_->fd()
             << " state=" << stateToString();
   assert(state_ == kDisconnected);
 }
 
+const string& TcpConnection::name() const
+{
+  std::call_once(nameOnce_, &TcpConnection::formatName, this);
+  return name_;
+}
+
+void TcpConnection::formatName() const
+{
+  if (namePrefix_)
+  {
+    char buf[32];
+    snprintf(buf, sizeof buf, "#%" PRId64, id_);
+    name_ = *namePrefix_ + buf;
+  }
+}
+
 bool TcpConnection::getTcpInfo(struct tcp_info* tcpi) const
 {
   return socket_->getTcpInfo(tcpi);
@@ -144,7 +200,7 @@ void TcpConnection::sendInLoop(const void* data, size_t len)
   bool faultError = false;
   if (state_ == kDisconnected)
   {
-    LOG_WARN << "disconnected, give up writing";
+    LOG_WARN_RATE_LIMITED(10, 100) << "disconnected, give up writing";
     return;
   }
   // if no thing in output queue, try writing directly
@@ -164,7 +220,7 @@ void TcpConnection::sendInLoop(const void* data, size_t len)
       nwrote = 0;
       if (errno != EWOULDBLOCK)
       {
-        LOG_SYSERR << "TcpConnection::sendInLoop";
+        LOG_SYSERR_RATE_LIMITED(10, 100) << "TcpConnection::sendInLoop";
         if (errno == EPIPE || errno == ECONNRESET) // FIXME: any others?
         {
           faultError = true;
@@ -191,6 +247,146 @@ void TcpConnection::sendInLoop(const void* data, size_t len)
   }
 }
 
+void TcpConnection::sendOutputBuffer(const StringPiece& data)
+{
+  loop_->assertInLoopThread();
+  if (state_ == kDisconnected)
+  {
+    LOG_WARN_RATE_LIMITED(10, 100) << "disconnected, give up writing";
+    return;
+  }
+  if (outputBuffer_.readableBytes() == 0 && data.empty())
+  {
+    return;
+  }
+  size_t len = data.size();
+  size_t nwrote = 0;
+  bool faultError = false;
+  // handleWrite() carries on with outputBuffer_ if writing
+  if (!channel_->isWriting())
+  {
+    size_t pending = outputBuffer_.readableBytes();
+    struct iovec vec[2];
+    vec[0].iov_base = const_cast<char*>(outputBuffer_.peek());
+    vec[0].iov_len = pending;
+    vec[1].iov_base = const_cast<char*>(data.data());
+    vec[1].iov_len = len;
+    ssize_t n = sockets::writev(channel_->fd(), vec, len > 0 ? 2 : 1);
+    if (n >= 0)
+    {
+      size_t written = static_cast<size_t>(n);
+      if (written >= pending)
+      {
+        outputBuffer_.retrieveAll();
+        nwrote = written - pending;
+      }
+      else
+      {
+        outputBuffer_.retrieve(written);
+      }
+      if (nwrote == len && outputBuffer_.readableBytes() == 0 && writeCompleteCallback_)
+      {
+        loop_->queueInLoop(std::bind(writeCompleteCallback_, shared_from_this()));
+      }
+    }
+    else // n < 0
+    {
+      if (errno != EWOULDBLOCK)
+      {
+        LOG_SYSERR_RATE_LIMITED(10, 100) << "TcpConnection::sendOutputBuffer";
+        if (errno == EPIPE || errno == ECONNRESET)
+        {
+          faultError = true;
+        }
+      }
+    }
+  }
+
+  if (!faultError)
+  {
+    size_t remaining = len - nwrote;
+    if (remaining > 0)
+    {
+      size_t oldLen = outputBuffer_.readableBytes();
+      if (oldLen + remaining >= highWaterMark_
+          && oldLen < highWaterMark_
+          && highWaterMarkCallback_)
+      {
+        loop_->queueInLoop(std::bind(highWaterMarkCallback_, shared_from_this(), oldLen + remaining));
+      }
+      outputBuffer_.append(data.data() + nwrote, remaining);
+    }
+    if (outputBuffer_.readableBytes() > 0 && !channel_->isWriting())
+    {
+      channel_->enableWriting();
+    }
+  }
+}
+
+void TcpConnection::sendFile(int fd, off_t offset, size_t count)
+{
+  loop_->assertInLoopThread();
+  if (state_ == kDisconnected)
+  {
+    LOG_WARN_RATE_LIMITED(10, 100) << "disconnected, give up writing";
+    return;
+  }
+  assert(fileRemaining_ == 0);
+  fileFd_ = fd;
+  fileOffset_ = offset;
+  fileRemaining_ = count;
+  // handleWrite() carries on if writing
+  if (!channel_->isWriting())
+  {
+    if (outputBuffer_.readableBytes() > 0)
+    {
+      ssize_t n = sockets::write(channel_->fd(),
+                                 outputBuffer_.peek(),
+                                 outputBuffer_.readableBytes());
+      if (n > 0)
+      {
+        outputBuffer_.retrieve(n);
+      }
+      else if (n < 0 && errno != EWOULDBLOCK)
+      {
+        LOG_SYSERR_RATE_LIMITED(10, 100) << "TcpConnection::sendFile";
+      }
+    }
+    if (outputBuffer_.readableBytes() == 0)
+    {
+      writeFile();
+    }
+    if (outputBuffer_.readableBytes() > 0 || fileRemaining_ > 0)
+    {
+      channel_->enableWriting();
+    }
+    else if (writeCompleteCallback_)
+    {
+      loop_->queueInLoop(std::bind(writeCompleteCallback_, shared_from_this()));
+    }
+  }
+}
+
+void TcpConnection::writeFile()
+{
+  if (fileRemaining_ == 0)
+  {
+    return;
+  }
+  ssize_t n = sockets::sendfile(channel_->fd(), fileFd_, &fileOffset_, fileRemaining_);
+  if (n > 0)
+  {
+    fileRemaining_ -= static_cast<size_t>(n);
+  }
+  else if (n == 0 || errno != EWOULDBLOCK)
+  {
+    // the file shrank, or the peer is gone, what was promised can't be sent
+    LOG_SYSERR_RATE_LIMITED(10, 100) << "TcpConnection::writeFile fd = " << fileFd_;
+    fileRemaining_ = 0;
+    forceClose();
+  }
+}
+
 void TcpConnection::shutdown()
 {
   // FIXME: use compare and swap
@@ -325,6 +521,7 @@ void TcpConnection::connectEstablished()
   loop_->assertInLoopThread();
   assert(state_ == kConnecting);
   setState(kConnected);
+  lastReceiveTime_ = Timestamp::now();
   channel_->tie(shared_from_this());
   channel_->enableReading();
 
@@ -334,7 +531,8 @@ void TcpConnection::connectEstablished()
 void TcpConnection::connectDestroyed()
 {
   loop_->assertInLoopThread();
-  if (state_ == kConnected)
+  // shutdown() leaves it kDisconnecting till the peer closes
+  if (state_ == kConnected || state_ == kDisconnecting)
   {
     setState(kDisconnected);
     channel_->disableAll();
@@ -351,6 +549,7 @@ void TcpConnection::handleRead(Timestamp receiveTime)
   ssize_t n = inputBuffer_.readFd(channel_->fd(), &savedErrno);
   if (n > 0)
   {
+    lastReceiveTime_ = receiveTime;
     messageCallback_(shared_from_this(), &inputBuffer_, receiveTime);
   }
   else if (n == 0)
@@ -370,32 +569,39 @@ void TcpConnection::handleWrite()
   loop_->assertInLoopThread();
   if (channel_->isWriting())
   {
-    ssize_t n = sockets::write(channel_->fd(),
-                               outputBuffer_.peek(),
-                               outputBuffer_.readableBytes());
-    if (n > 0)
+    if (outputBuffer_.readableBytes() > 0)
     {
-      outputBuffer_.retrieve(n);
-      if (outputBuffer_.readableBytes() == 0)
+      ssize_t n = sockets::write(channel_->fd(),
+                                 outputBuffer_.peek(),
+                                 outputBuffer_.readableBytes());
+      if (n > 0)
       {
-        channel_->disableWriting();
-        if (writeCompleteCallback_)
-        {
-          loop_->queueInLoop(std::bind(writeCompleteCallback_, shared_from_this()));
-        }
-        if (state_ == kDisconnecting)
-        {
-          shutdownInLoop();
-        }
+        outputBuffer_.retrieve(n);
+      }
+      else
+      {
+        LOG_SYSERR << "TcpConnection::handleWrite";
+        // if (state_ == kDisconnecting)
+        // {
+        //   shutdownInLoop();
+        // }
       }
     }
-    else
+    if (outputBuffer_.readableBytes() == 0)
     {
-      LOG_SYSERR << "TcpConnection::handleWrite";
-      // if (state_ == kDisconnecting)
-      // {
-      //   shutdownInLoop();
-      // }
+      writeFile();
+    }
+    if (outputBuffer_.readableBytes() == 0 && fileRemaining_ == 0)
+    {
+      channel_->disableWriting();
+      if (writeCompleteCallback_)
+      {
+        loop_->queueInLoop(std::bind(writeCompleteCallback_, shared_from_this()));
+      }
+      if (state_ == kDisconnecting)
+      {
+        shutdownInLoop();
+      }
     }
   }
   else
@@ -423,7 +629,7 @@ void TcpConnection::handleClose()
 void TcpConnection::handleError()
 {
   int err = sockets::getSocketError(channel_->fd());
-  LOG_ERROR << "TcpConnection::handleError [" << name_
+  LOG_ERROR << "TcpConnection::handleError [" << name()
             << "] - SO_ERROR = " << err << " " << strerror_tl(err);
 }
 
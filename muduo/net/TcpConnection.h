@@ -16,9 +16,11 @@
 #include "muduo/base/Types.h"
 #include "muduo/net/Callbacks.h"
 #include "muduo/net/Buffer.h"
+#include "muduo/net/ConnectionContext.h"
 #include "muduo/net/InetAddress.h"
 
 #include <memory>
+#include <mutex>
 
 #include <boost/any.hpp>
 
@@ -50,10 +52,23 @@ class TcpConnection : noncopyable,
                 int sockfd,
                 const InetAddress& localAddr,
                 const InetAddress& peerAddr);
+  /// Constructs a TcpConnection named "namePrefix#id",
+  /// the name is only formatted when name() is first called.
+  ///
+  /// User should not create this object.
+  TcpConnection(EventLoop* loop,
+                const std::shared_ptr<const string>& namePrefix,
+                int64_t id,
+                int sockfd,
+                const InetAddress& localAddr,
+                const InetAddress& peerAddr);
   ~TcpConnection();
 
   EventLoop* getLoop() const { return loop_; }
-  const string& name() const { return name_; }
+  /// Thread safe.
+  const string& name() const;
+  /// Unique within a TcpServer or TcpClient, 0 if not given.
+  int64_t id() const { return id_; }
   const InetAddress& localAddress() const { return localAddr_; }
   const InetAddress& peerAddress() const { return peerAddr_; }
   bool connected() const { return state_ == kConnected; }
@@ -76,6 +91,8 @@ class TcpConnection : noncopyable,
   void startRead();
   void stopRead();
   bool isReading() const { return reading_; }; // NOT thread safe, may race with start/stopReadInLoop
+  // time of last incoming data, or of connectEstablished(), NOT thread safe
+  Timestamp lastReceiveTime() const { return lastReceiveTime_; }
 
   void setContext(const boost::any& context)
   { context_ = context; }
@@ -86,6 +103,25 @@ class TcpConnection : noncopyable,
   boost::any* getMutableContext()
   { return &context_; }
 
+  /// Typed context, no allocation nor type check, see ConnectionContexts.
+  /// Not thread safe, but in loop.
+  template<typename T, typename... Args>
+  T* emplaceContext(ContextSlot<T> slot, Args&&... args)
+  { return contexts_.emplace(slot, std::forward<Args>(args)...); }
+
+  /// The context of @c slot must have been emplaced.
+  template<typename T>
+  T* context(ContextSlot<T> slot)
+  { return contexts_.get(slot); }
+
+  template<typename T>
+  bool hasContext(ContextSlot<T> slot) const
+  { return contexts_.has(slot); }
+
+  template<typename T>
+  void resetContext(ContextSlot<T> slot)
+  { contexts_.reset(slot); }
+
   void setConnectionCallback(const ConnectionCallback& cb)
   { connectionCallback_ = cb; }
 
@@ -105,6 +141,17 @@ class TcpConnection : noncopyable,
   Buffer* outputBuffer()
   { return &outputBuffer_; }
 
+  /// Advanced interface, in loop thread.
+  /// Sends what has been appended to outputBuffer(), then data, with one
+  /// writev(); data is copied only if the socket doesn't take it all.
+  void sendOutputBuffer(const StringPiece& data = StringPiece());
+
+  /// Advanced interface, in loop thread.
+  /// Sends count bytes of fd from offset with sendfile(2), after what is in
+  /// outputBuffer().  fd must stay open and nothing else be sent until the
+  /// write complete callback.
+  void sendFile(int fd, off_t offset, size_t count);
+
   /// Internal use only.
   void setCloseCallback(const CloseCallback& cb)
   { closeCallback_ = cb; }
@@ -123,6 +170,7 @@ class TcpConnection : noncopyable,
   // void sendInLoop(string&& message);
   void sendInLoop(const StringPiece& message);
   void sendInLoop(const void* message, size_t len);
+  void writeFile();
   void shutdownInLoop();
   // void shutdownAndForceCloseInLoop(double seconds);
   void forceCloseInLoop();
@@ -130,9 +178,13 @@ class TcpConnection : noncopyable,
   const char* stateToString() const;
   void startReadInLoop();
   void stopReadInLoop();
+  void formatName() const;
 
   EventLoop* loop_;
-  const string name_;
+  const std::shared_ptr<const string> namePrefix_;
+  const int64_t id_;
+  mutable string name_;
+  mutable std::once_flag nameOnce_;
   StateE state_;  // FIXME: use atomic variable
   bool reading_;
   // we don't expose those classes to client.
@@ -148,9 +200,14 @@ class TcpConnection : noncopyable,
   size_t highWaterMark_;
   Buffer inputBuffer_;
   Buffer outputBuffer_; // FIXME: use list<Buffer> as output buffer.
+  // sendFile() after outputBuffer_
+  int fileFd_;
+  off_t fileOffset_;
+  size_t fileRemaining_;
   boost::any context_;
-  // FIXME: creationTime_, lastReceiveTime_
-  //        bytesReceived_, bytesSent_
+  ConnectionContexts contexts_;
+  Timestamp lastReceiveTime_;
+  // FIXME: creationTime_, bytesReceived_, bytesSent_
 };
 
 typedef std::shared_ptr<TcpConnection> TcpConnectionPtr;
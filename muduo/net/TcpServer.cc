@@ -8,17 +8,139 @@
 
 #include "muduo/net/TcpServer.h"
 
+#include "muduo/base/CountDownLatch.h"
 #include "muduo/base/Logging.h"
 #include "muduo/net/Acceptor.h"
 #include "muduo/net/EventLoop.h"
 #include "muduo/net/EventLoopThreadPool.h"
+#include "muduo/net/IdleTimingWheel.h"
 #include "muduo/net/SocketsOps.h"
 
-#include <stdio.h>  // snprintf
+#include <algorithm>
+#include <vector>
 
 using namespace muduo;
 using namespace muduo::net;
 
+///
+/// Open addressing hash table from connection id to connection,
+/// with linear probing and backward shift deletion.
+///
+/// Ids are given out sequentially, so the low bits are a good hash.
+///
+class TcpServer::ConnectionMap : noncopyable
+{
+ public:
+  ConnectionMap()
+    : entries_(kInitialCapacity),
+      size_(0)
+  {
+  }
+
+  size_t size() const { return size_; }
+
+  void insert(const TcpConnectionPtr& conn)
+  {
+    assert(conn->id() != kEmpty);
+    if ((size_ + 1) * 2 > entries_.size())
+    {
+      grow();
+    }
+    insertEntry(conn);
+    ++size_;
+  }
+
+  bool erase(int64_t id)
+  {
+    const size_t mask = entries_.size() - 1;
+    size_t i = indexOf(id);
+    while (entries_[i].id != id)
+    {
+      if (entries_[i].id == kEmpty)
+        return false;
+      i = (i + 1) & mask;
+    }
+    entries_[i].id = kEmpty;
+    entries_[i].conn.reset();
+    --size_;
+
+    // shift back entries that can't be found after the hole
+    for (size_t j = (i + 1) & mask; entries_[j].id != kEmpty; j = (j + 1) & mask)
+    {
+      size_t home = indexOf(entries_[j].id);
+      bool movable = (i <= j) ? (home <= i || home > j) : (home <= i && home > j);
+      if (movable)
+      {
+        entries_[i] = std::move(entries_[j]);
+        entries_[j].id = kEmpty;
+        i = j;
+      }
+    }
+    return true;
+  }
+
+  /// Removes all connections, calls f for each of them.
+  template<typename Func>
+  void clear(Func f)
+  {
+    for (Entry& entry : entries_)
+    {
+      if (entry.id != kEmpty)
+      {
+        TcpConnectionPtr conn(std::move(entry.conn));
+        entry.id = kEmpty;
+        f(conn);
+      }
+    }
+    size_ = 0;
+  }
+
+ private:
+  static const int64_t kEmpty = 0;
+  static const size_t kInitialCapacity = 64;
+
+  struct Entry
+  {
+    Entry() : id(kEmpty) { }
+    int64_t id;
+    TcpConnectionPtr conn;
+  };
+
+  size_t indexOf(int64_t id) const
+  {
+    return static_cast<size_t>(id) & (entries_.size() - 1);
+  }
+
+  void insertEntry(const TcpConnectionPtr& conn)
+  {
+    const size_t mask = entries_.size() - 1;
+    size_t i = indexOf(conn->id());
+    while (entries_[i].id != kEmpty)
+    {
+      assert(entries_[i].id != conn->id());
+      i = (i + 1) & mask;
+    }
+    entries_[i].id = conn->id();
+    entries_[i].conn = conn;
+  }
+
+  void grow()
+  {
+    std::vector<Entry> old(entries_.size() * 2);
+    old.swap(entries_);
+    for (Entry& entry : old)
+    {
+      if (entry.id != kEmpty)
+      {
+        insertEntry(entry.conn);
+      }
+    }
+  }
+
+  std::vector<Entry> entries_;  // size is power of 2
+  size_t size_;
+};
+
 TcpServer::TcpServer(EventLoop* loop,
                      const InetAddress& listenAddr,
                      const string& nameArg,
@@ -30,7 +152,16 @@ TcpServer::TcpServer(EventLoop* loop,
     threadPool_(new EventLoopThreadPool(loop, name_)),
     connectionCallback_(defaultConnectionCallback),
     messageCallback_(defaultMessageCallback),
-    nextConnId_(1)
+    nextConnId_(1),
+    connNamePrefix_(std::make_shared<const string>(name_ + "-" + ipPort_)),
+    connections_(new ConnectionMap),
+    idleSeconds_(0.0),
+    maxConnections_(0),
+    maxConnectionsPerIp_(0),
+    acceptRate_(0.0),
+    acceptBurst_(0.0),
+    acceptTokens_(0.0),
+    acceptTokenTimerPending_(false)
 {
   acceptor_->setNewConnectionCallback(
       std::bind(&TcpServer::newConnection, this, _1, _2));
@@ -41,13 +172,61 @@ TcpServer::~TcpServer()
   loop_->assertInLoopThread();
   LOG_TRACE << "TcpServer::~TcpServer [" << name_ << "] destructing";
 
-  for (auto& item : connections_)
+  if (acceptTokenTimerPending_)
+  {
+    loop_->cancel(acceptTokenTimer_);
+  }
+
+  connections_->clear([](const TcpConnectionPtr& conn)
   {
-    TcpConnectionPtr conn(item.second);
-    item.second.reset();
     conn->getLoop()->runInLoop(
       std::bind(&TcpConnection::connectDestroyed, conn));
+  });
+
+  // wheels must die in their own loops, the loops are still running
+  CountDownLatch latch(static_cast<int>(idleWheels_.size()));
+  for (auto& item : idleWheels_)
+  {
+    IdleTimingWheel* wheel = item.second.release();
+    item.first->runInLoop([wheel, &latch]
+    {
+      delete wheel;
+      latch.countDown();
+    });
   }
+  latch.wait();
+}
+
+void TcpServer::setIdleTimeout(double seconds)
+{
+  assert(started_.get() == 0);
+  assert(seconds >= 0.0);
+  idleSeconds_ = seconds;
+}
+
+void TcpServer::setMaxConnections(int maxConnections)
+{
+  assert(started_.get() == 0);
+  assert(maxConnections >= 0);
+  maxConnections_ = static_cast<size_t>(maxConnections);
+}
+
+void TcpServer::setMaxConnectionsPerIp(int maxConnectionsPerIp)
+{
+  assert(started_.get() == 0);
+  assert(maxConnectionsPerIp >= 0);
+  maxConnectionsPerIp_ = maxConnectionsPerIp;
+}
+
+void TcpServer::setAcceptRate(double connectionsPerSecond, int burst)
+{
+  assert(started_.get() == 0);
+  assert(connectionsPerSecond >= 0.0);
+  assert(connectionsPerSecond == 0.0 || burst >= 1);
+  acceptRate_ = connectionsPerSecond;
+  acceptBurst_ = burst;
+  acceptTokens_ = burst;
+  lastTokenRefill_ = Timestamp::now();
 }
 
 void TcpServer::setThreadNum(int numThreads)
@@ -61,6 +240,10 @@ void TcpServer::start()
   if (started_.getAndSet(1) == 0)
   {
     threadPool_->start(threadInitCallback_);
+    if (idleSeconds_ > 0.0)
+    {
+      loop_->runInLoop(std::bind(&TcpServer::startIdleTimingWheels, this));
+    }
 
     assert(!acceptor_->listenning());
     loop_->runInLoop(
@@ -68,33 +251,67 @@ void TcpServer::start()
   }
 }
 
+void TcpServer::startIdleTimingWheels()
+{
+  loop_->assertInLoopThread();
+  // created in base loop before listening, so newConnection never misses one
+  for (EventLoop* ioLoop : threadPool_->getAllLoops())
+  {
+    CountDownLatch latch(1);
+    IdleTimingWheel* wheel = NULL;
+    ioLoop->runInLoop([ioLoop, this, &wheel, &latch]
+    {
+      wheel = new IdleTimingWheel(ioLoop, idleSeconds_);
+      latch.countDown();
+    });
+    latch.wait();
+    idleWheels_[ioLoop].reset(wheel);
+  }
+}
+
 void TcpServer::newConnection(int sockfd, const InetAddress& peerAddr)
 {
   loop_->assertInLoopThread();
+  // a rejected peer doesn't spend the token of the next one
+  if (maxConnectionsPerIp_ > 0 && !admitPeer(peerAddr.toIp()))
+  {
+    LOG_WARN_RATE_LIMITED(10, 100) << "TcpServer::newConnection [" << name_
+                                   << "] - too many connections from " << peerAddr.toIp();
+    sockets::close(sockfd);
+    return;
+  }
+  if (acceptRate_ > 0.0)
+  {
+    acceptTokens_ -= 1.0;
+  }
+
   EventLoop* ioLoop = threadPool_->getNextLoop();
-  char buf[64];
-  snprintf(buf, sizeof buf, "-%s#%d", ipPort_.c_str(), nextConnId_);
-  ++nextConnId_;
-  string connName = name_ + buf;
+  int64_t connId = nextConnId_++;
 
   LOG_INFO << "TcpServer::newConnection [" << name_
-           << "] - new connection [" << connName
-           << "] from " << peerAddr.toIpPort();
+           << "] - new connection #" << connId
+           << " from " << peerAddr.toIpPort();
   InetAddress localAddr(sockets::getLocalAddr(sockfd));
   // FIXME poll with zero timeout to double confirm the new connection
-  // FIXME use make_shared if necessary
-  TcpConnectionPtr conn(new TcpConnection(ioLoop,
-                                          connName,
-                                          sockfd,
-                                          localAddr,
-                                          peerAddr));
-  connections_[connName] = conn;
+  TcpConnectionPtr conn = std::make_shared<TcpConnection>(ioLoop,
+                                                          connNamePrefix_,
+                                                          connId,
+                                                          sockfd,
+                                                          localAddr,
+                                                          peerAddr);
+  connections_->insert(conn);
+  updateAdmission();
   conn->setConnectionCallback(connectionCallback_);
   conn->setMessageCallback(messageCallback_);
   conn->setWriteCompleteCallback(writeCompleteCallback_);
   conn->setCloseCallback(
       std::bind(&TcpServer::removeConnection, this, _1)); // FIXME: unsafe
   ioLoop->runInLoop(std::bind(&TcpConnection::connectEstablished, conn));
+  if (idleSeconds_ > 0.0)
+  {
+    IdleTimingWheel* wheel = idleWheels_.at(ioLoop).get();
+    ioLoop->runInLoop(std::bind(&IdleTimingWheel::add, wheel, conn));
+  }
 }
 
 void TcpServer::removeConnection(const TcpConnectionPtr& conn)
@@ -107,12 +324,73 @@ void TcpServer::removeConnectionInLoop(const TcpConnectionPtr& conn)
 {
   loop_->assertInLoopThread();
   LOG_INFO << "TcpServer::removeConnectionInLoop [" << name_
-           << "] - connection " << conn->name();
-  size_t n = connections_.erase(conn->name());
-  (void)n;
-  assert(n == 1);
+           << "] - connection #" << conn->id();
+  bool erased = connections_->erase(conn->id());
+  (void)erased;
+  assert(erased);
+  if (maxConnectionsPerIp_ > 0)
+  {
+    auto it = connectionsPerIp_.find(conn->peerAddress().toIp());
+    assert(it != connectionsPerIp_.end());
+    if (--it->second == 0)
+    {
+      connectionsPerIp_.erase(it);
+    }
+  }
+  updateAdmission();
   EventLoop* ioLoop = conn->getLoop();
   ioLoop->queueInLoop(
       std::bind(&TcpConnection::connectDestroyed, conn));
 }
 
+bool TcpServer::admitPeer(const string& peerIp)
+{
+  loop_->assertInLoopThread();
+  int& count = connectionsPerIp_[peerIp];
+  if (count >= maxConnectionsPerIp_)
+  {
+    return false;
+  }
+  ++count;
+  return true;
+}
+
+void TcpServer::updateAdmission()
+{
+  loop_->assertInLoopThread();
+  if (maxConnections_ == 0 && acceptRate_ == 0.0)
+    return;
+
+  bool full = maxConnections_ > 0 && connections_->size() >= maxConnections_;
+  bool throttled = false;
+  if (acceptRate_ > 0.0)
+  {
+    Timestamp now(Timestamp::now());
+    acceptTokens_ = std::min(acceptBurst_,
+        acceptTokens_ + timeDifference(now, lastTokenRefill_) * acceptRate_);
+    lastTokenRefill_ = now;
+    throttled = acceptTokens_ < 1.0;
+    if (throttled && !acceptTokenTimerPending_)
+    {
+      acceptTokenTimerPending_ = true;
+      acceptTokenTimer_ = loop_->runAfter(
+          (1.0 - acceptTokens_) / acceptRate_,
+          std::bind(&TcpServer::onAcceptTokensDue, this));
+    }
+  }
+
+  if (full || throttled)
+  {
+    acceptor_->pause();
+  }
+  else
+  {
+    acceptor_->resume();
+  }
+}
+
+void TcpServer::onAcceptTokensDue()
+{
+  acceptTokenTimerPending_ = false;
+  updateAdmission();
+}
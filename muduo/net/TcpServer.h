@@ -14,6 +14,7 @@
 #include "muduo/base/Atomic.h"
 #include "muduo/base/Types.h"
 #include "muduo/net/TcpConnection.h"
+#include "muduo/net/TimerId.h"
 
 #include <map>
 
@@ -25,6 +26,7 @@ namespace net
 class Acceptor;
 class EventLoop;
 class EventLoopThreadPool;
+class IdleTimingWheel;
 
 ///
 /// TCP server, supports single-threaded and thread-pool models.
@@ -64,6 +66,31 @@ class TcpServer : noncopyable
   void setThreadNum(int numThreads);
   void setThreadInitCallback(const ThreadInitCallback& cb)
   { threadInitCallback_ = cb; }
+
+  /// Force-closes connections that have received nothing for @c seconds.
+  /// Costs one timer per loop, not per connection.
+  /// 0 (the default) keeps idle connections forever.
+  /// Must be called before @c start
+  void setIdleTimeout(double seconds);
+
+  // Admission control, all limits are off by default.
+  // Over the global cap or the accept rate, the server stops accepting
+  // and lets the kernel backlog absorb the burst, instead of accepting
+  // and closing.  The per-IP cap can't pause the listening socket, so
+  // connections over it are closed right after accept.
+
+  /// Stops accepting while @c maxConnections are open, 0 means no limit.
+  /// Must be called before @c start
+  void setMaxConnections(int maxConnections);
+  /// Closes new connections from an IP that already has
+  /// @c maxConnectionsPerIp open, 0 means no limit.
+  /// Must be called before @c start
+  void setMaxConnectionsPerIp(int maxConnectionsPerIp);
+  /// Token bucket on accept(2): on average @c connectionsPerSecond,
+  /// up to @c burst at once.  0 means no limit.
+  /// Must be called before @c start
+  void setAcceptRate(double connectionsPerSecond, int burst);
+
   /// valid after calling start()
   std::shared_ptr<EventLoopThreadPool> threadPool()
   { return threadPool_; }
@@ -96,8 +123,16 @@ class TcpServer : noncopyable
   void removeConnection(const TcpConnectionPtr& conn);
   /// Not thread safe, but in loop
   void removeConnectionInLoop(const TcpConnectionPtr& conn);
+  /// Not thread safe, but in loop
+  void startIdleTimingWheels();
+  /// Not thread safe, but in loop
+  bool admitPeer(const string& peerIp);
+  /// Not thread safe, but in loop
+  void updateAdmission();
+  /// Not thread safe, but in loop
+  void onAcceptTokensDue();
 
-  typedef std::map<string, TcpConnectionPtr> ConnectionMap;
+  class ConnectionMap;
 
   EventLoop* loop_;  // the acceptor loop
   const string ipPort_;
@@ -110,8 +145,22 @@ class TcpServer : noncopyable
   ThreadInitCallback threadInitCallback_;
   AtomicInt32 started_;
   // always in loop thread
-  int nextConnId_;
-  ConnectionMap connections_;
+  int64_t nextConnId_;
+  const std::shared_ptr<const string> connNamePrefix_;
+  std::unique_ptr<ConnectionMap> connections_;
+  double idleSeconds_;
+  // one per IO loop, each lives in its loop
+  std::map<EventLoop*, std::unique_ptr<IdleTimingWheel>> idleWheels_;
+  // admission control, always in loop thread
+  size_t maxConnections_;
+  int maxConnectionsPerIp_;
+  std::map<string, int> connectionsPerIp_;
+  double acceptRate_;
+  double acceptBurst_;
+  double acceptTokens_;
+  Timestamp lastTokenRefill_;
+  TimerId acceptTokenTimer_;
+  bool acceptTokenTimerPending_;
 };
 
 }  // namespace net
@@ -41,17 +41,22 @@ class ZlibInputStream : noncopyable
   int zerror_;
 };
 
-// input is uncompressed data, output zlib compressed data
+// input is uncompressed data, output zlib compressed data,
+// or gzip data, as HTTP Content-Encoding: gzip wants.
 class ZlibOutputStream : noncopyable
 {
  public:
-  explicit ZlibOutputStream(Buffer* output)
+  explicit ZlibOutputStream(Buffer* output,
+                            int level = Z_DEFAULT_COMPRESSION,
+                            bool gzip = false)
     : output_(output),
       zerror_(Z_OK),
       bufferSize_(1024)
   {
     memZero(&zstream_, sizeof zstream_);
-    zerror_ = deflateInit(&zstream_, Z_DEFAULT_COMPRESSION);
+    // 16 more window bits for a gzip header and trailer
+    zerror_ = deflateInit2(&zstream_, level, Z_DEFLATED, gzip ? MAX_WBITS + 16 : MAX_WBITS,
+                           8, Z_DEFAULT_STRATEGY);
   }
 
   ~ZlibOutputStream()
@@ -120,6 +125,37 @@ class ZlibOutputStream : noncopyable
     return ok;
   }
 
+  // Like finish(), but keeps the stream for more data compressed anew,
+  // which is much cheaper than a new stream.
+  bool finishAndReset()
+  {
+    if (zerror_ != Z_OK)
+      return false;
+
+    while (zerror_ == Z_OK)
+    {
+      zerror_ = compress(Z_FINISH);
+    }
+    bool ok = zerror_ == Z_STREAM_END;
+    zerror_ = deflateReset(&zstream_);
+    return ok && zerror_ == Z_OK;
+  }
+
+  // Before writing, or right after finishAndReset().
+  bool setLevel(int level)
+  {
+    if (zerror_ != Z_OK)
+      return false;
+
+    // may write the header
+    output_->ensureWritableBytes(bufferSize_);
+    zstream_.next_out = reinterpret_cast<Bytef*>(output_->beginWrite());
+    zstream_.avail_out = static_cast<int>(output_->writableBytes());
+    zerror_ = deflateParams(&zstream_, level, Z_DEFAULT_STRATEGY);
+    output_->hasWritten(output_->writableBytes() - zstream_.avail_out);
+    return zerror_ == Z_OK;
+  }
+
  private:
   int compress(int flush)
   {
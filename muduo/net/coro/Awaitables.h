@@ -0,0 +1,130 @@
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+//
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+//
+// This is a public header file, it must only include public header files.
+// Needs C++20.
+
+#ifndef MUDUO_NET_CORO_AWAITABLES_H
+#define MUDUO_NET_CORO_AWAITABLES_H
+
+#include "muduo/net/EventLoop.h"
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace muduo
+{
+namespace net
+{
+namespace coro
+{
+
+///
+/// co_await sleepFor(loop, 0.5); suspends for half a second on loop's
+/// TimerQueue, then resumes in loop's thread.
+///
+/// The coroutine leaks if loop quits before the timer fires.
+///
+class SleepAwaiter
+{
+ public:
+  SleepAwaiter(EventLoop* loop, double seconds)
+    : loop_(loop),
+      seconds_(seconds)
+  {
+  }
+
+  bool await_ready() const noexcept { return false; }
+
+  void await_suspend(std::coroutine_handle<> h)
+  {
+    loop_->runAfter(seconds_, [h] { h.resume(); });
+  }
+
+  void await_resume() const noexcept { }
+
+ private:
+  EventLoop* loop_;
+  double seconds_;
+};
+
+inline SleepAwaiter sleepFor(EventLoop* loop, double seconds)
+{
+  return SleepAwaiter(loop, seconds);
+}
+
+///
+/// auto result = co_await runIn(otherLoop, func); calls func in
+/// otherLoop's thread, then resumes with its result in the current
+/// EventLoop thread.  Exceptions thrown by func are rethrown there.
+///
+template<typename Func>
+class RunInAwaiter
+{
+ public:
+  typedef std::invoke_result_t<Func&> Result;
+
+  RunInAwaiter(EventLoop* loop, Func func)
+    : loop_(loop),
+      func_(std::move(func))
+  {
+  }
+
+  bool await_ready() const noexcept { return false; }
+
+  void await_suspend(std::coroutine_handle<> h)
+  {
+    EventLoop* home = EventLoop::getEventLoopOfCurrentThread();
+    assert(home != NULL);
+    loop_->runInLoop([this, h, home]
+    {
+      try
+      {
+        if constexpr (std::is_void_v<Result>)
+          func_();
+        else
+          result_.emplace(func_());
+      }
+      catch (...)
+      {
+        exception_ = std::current_exception();
+      }
+      // queued, never resumed from inside await_suspend
+      home->queueInLoop([h] { h.resume(); });
+    });
+  }
+
+  Result await_resume()
+  {
+    if (exception_)
+      std::rethrow_exception(exception_);
+    if constexpr (!std::is_void_v<Result>)
+      return std::move(*result_);
+  }
+
+ private:
+  typedef std::conditional_t<std::is_void_v<Result>, char, Result> Storage;
+
+  EventLoop* loop_;
+  Func func_;
+  std::optional<Storage> result_;
+  std::exception_ptr exception_;
+};
+
+/// Must be co_await'ed in an EventLoop thread.
+template<typename Func>
+RunInAwaiter<std::decay_t<Func>> runIn(EventLoop* loop, Func&& func)
+{
+  return RunInAwaiter<std::decay_t<Func>>(loop, std::forward<Func>(func));
+}
+
+}  // namespace coro
+}  // namespace net
+}  // namespace muduo
+
+#endif  // MUDUO_NET_CORO_AWAITABLES_H
@@ -0,0 +1,195 @@
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+//
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+
+#include "muduo/net/coro/CoroStream.h"
+
+#include "muduo/net/EventLoop.h"
+
+#include <algorithm>
+
+using namespace muduo;
+using namespace muduo::net;
+using namespace muduo::net::coro;
+
+namespace
+{
+const ContextSlot<CoroStreamPtr> kStreamSlot =
+    ConnectionContexts::registerSlot<CoroStreamPtr>();
+}  // namespace
+
+CoroStream::CoroStream(const TcpConnectionPtr& conn)
+  : conn_(conn),
+    mode_(kNone),
+    wantBytes_(0),
+    searched_(0),
+    closed_(false)
+{
+}
+
+CoroStream::~CoroStream()
+{
+  // a suspended coroutine holds a CoroStreamPtr
+  assert(!reader_);
+  assert(!drainer_);
+}
+
+CoroStream::ReadAwaiter CoroStream::read(size_t n)
+{
+  wantBytes_ = n;
+  return startRead(kExactly);
+}
+
+CoroStream::ReadAwaiter CoroStream::readUntil(const string& delim)
+{
+  assert(!delim.empty());
+  delim_ = delim;
+  searched_ = 0;
+  return startRead(kDelimiter);
+}
+
+CoroStream::ReadAwaiter CoroStream::readSome()
+{
+  return startRead(kSome);
+}
+
+CoroStream::DrainAwaiter CoroStream::drain()
+{
+  getLoop()->assertInLoopThread();
+  assert(!drainer_);
+  return DrainAwaiter(this);
+}
+
+CoroStream::ReadAwaiter CoroStream::startRead(ReadMode mode)
+{
+  getLoop()->assertInLoopThread();
+  assert(!reader_);
+  assert(mode_ == kNone);
+  mode_ = mode;
+  return ReadAwaiter(this);
+}
+
+bool CoroStream::tryRead()
+{
+  Buffer* buf = conn_->inputBuffer();
+  bool done = false;
+  switch (mode_)
+  {
+    case kExactly:
+      if (buf->readableBytes() >= wantBytes_)
+      {
+        result_ = buf->retrieveAsString(wantBytes_);
+        done = true;
+      }
+      break;
+    case kDelimiter:
+      {
+        const char* end = buf->peek() + buf->readableBytes();
+        const char* found = std::search(buf->peek() + searched_, end,
+                                        delim_.begin(), delim_.end());
+        if (found != end)
+        {
+          size_t len = static_cast<size_t>(found - buf->peek()) + delim_.size();
+          result_ = buf->retrieveAsString(len);
+          done = true;
+        }
+        else if (buf->readableBytes() >= delim_.size())
+        {
+          // delim_ may straddle what we have and what comes next
+          searched_ = buf->readableBytes() - delim_.size() + 1;
+        }
+      }
+      break;
+    case kSome:
+      if (buf->readableBytes() > 0)
+      {
+        result_ = buf->retrieveAllAsString();
+        done = true;
+      }
+      break;
+    case kNone:
+      assert(false);
+      break;
+  }
+  if (!done && closed_)
+  {
+    result_ = buf->retrieveAllAsString();
+    done = true;
+  }
+  if (done)
+  {
+    mode_ = kNone;
+  }
+  return done;
+}
+
+bool CoroStream::drained() const
+{
+  return closed_ || conn_->outputBuffer()->readableBytes() == 0;
+}
+
+string CoroStream::takeResult()
+{
+  string result;
+  result.swap(result_);
+  return result;
+}
+
+void CoroStream::onMessage()
+{
+  if (reader_ && tryRead())
+  {
+    std::coroutine_handle<> h = reader_;
+    reader_ = nullptr;
+    h.resume();
+  }
+}
+
+void CoroStream::onWriteComplete()
+{
+  if (drainer_ && drained())
+  {
+    std::coroutine_handle<> h = drainer_;
+    drainer_ = nullptr;
+    h.resume();
+  }
+}
+
+void CoroStream::onClose()
+{
+  closed_ = true;
+  onMessage();
+  onWriteComplete();
+}
+
+namespace
+{
+
+void onStreamConnection(const StreamHandler& handler, const TcpConnectionPtr& conn)
+{
+  if (conn->connected())
+  {
+    CoroStreamPtr stream(std::make_shared<CoroStream>(conn));
+    // a cycle, broken when the connection goes down
+    conn->emplaceContext(kStreamSlot, stream);
+    conn->setMessageCallback(std::bind(&CoroStream::onMessage, stream));
+    conn->setWriteCompleteCallback(std::bind(&CoroStream::onWriteComplete, stream));
+    spawn(handler(stream));
+  }
+  else
+  {
+    CoroStreamPtr stream(*conn->context(kStreamSlot));
+    conn->resetContext(kStreamSlot);
+    conn->setMessageCallback(defaultMessageCallback);
+    conn->setWriteCompleteCallback(WriteCompleteCallback());
+    stream->onClose();
+  }
+}
+
+}  // namespace
+
+ConnectionCallback muduo::net::coro::connectionCallback(const StreamHandler& handler)
+{
+  return std::bind(onStreamConnection, handler, _1);
+}
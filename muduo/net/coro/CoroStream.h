@@ -0,0 +1,136 @@
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+//
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+//
+// This is a public header file, it must only include public header files.
+// Needs C++20.
+
+#ifndef MUDUO_NET_CORO_COROSTREAM_H
+#define MUDUO_NET_CORO_COROSTREAM_H
+
+#include "muduo/net/TcpConnection.h"
+#include "muduo/net/coro/Task.h"
+
+#include <coroutine>
+
+namespace muduo
+{
+namespace net
+{
+namespace coro
+{
+
+///
+/// Sequential reads and writes of a TcpConnection, for coroutines.
+///
+/// Lives in the connection's loop, all members must be called there.
+/// At most one read and one drain may be pending at a time.
+///
+///   Task<void> echo(CoroStreamPtr stream)
+///   {
+///     while (true)
+///     {
+///       string line = co_await stream->readUntil("\n");
+///       if (stream->closed())
+///         break;
+///       stream->write(line);
+///     }
+///   }
+///   server.setConnectionCallback(coro::connectionCallback(echo));
+///
+class CoroStream : noncopyable
+{
+ public:
+  class ReadAwaiter;
+  class DrainAwaiter;
+
+  explicit CoroStream(const TcpConnectionPtr& conn);
+  ~CoroStream();
+
+  const TcpConnectionPtr& connection() const { return conn_; }
+  EventLoop* getLoop() const { return conn_->getLoop(); }
+
+  /// True after the peer has closed, or the connection is gone.
+  /// Reads return what was left in the input buffer, possibly nothing.
+  bool closed() const { return closed_; }
+
+  /// Awaits exactly @c n bytes.
+  ReadAwaiter read(size_t n);
+  /// Awaits data up to and including @c delim.
+  ReadAwaiter readUntil(const string& delim);
+  /// Awaits whatever arrives next.
+  ReadAwaiter readSome();
+
+  /// Never suspends, data goes to the output buffer if the socket is full.
+  void write(StringPiece data) { conn_->send(data); }
+  /// Awaits until the output buffer is flushed to the kernel.
+  /// Returns false if the connection was closed first.
+  DrainAwaiter drain();
+
+  void shutdown() { conn_->shutdown(); }
+
+  class ReadAwaiter
+  {
+   public:
+    bool await_ready() { return stream_->tryRead(); }
+    void await_suspend(std::coroutine_handle<> h) { stream_->reader_ = h; }
+    string await_resume() { return stream_->takeResult(); }
+
+   private:
+    friend class CoroStream;
+    explicit ReadAwaiter(CoroStream* stream) : stream_(stream) { }
+    CoroStream* stream_;
+  };
+
+  class DrainAwaiter
+  {
+   public:
+    bool await_ready() { return stream_->drained(); }
+    void await_suspend(std::coroutine_handle<> h) { stream_->drainer_ = h; }
+    bool await_resume() { return !stream_->closed_; }
+
+   private:
+    friend class CoroStream;
+    explicit DrainAwaiter(CoroStream* stream) : stream_(stream) { }
+    CoroStream* stream_;
+  };
+
+  // used by connectionCallback()
+  void onMessage();
+  void onWriteComplete();
+  void onClose();
+
+ private:
+  enum ReadMode { kNone, kExactly, kDelimiter, kSome };
+
+  ReadAwaiter startRead(ReadMode mode);
+  bool tryRead();
+  bool drained() const;
+  string takeResult();
+
+  TcpConnectionPtr conn_;
+  std::coroutine_handle<> reader_;
+  std::coroutine_handle<> drainer_;
+  ReadMode mode_;
+  size_t wantBytes_;
+  string delim_;
+  size_t searched_;  // bytes of input known to have no delim_
+  string result_;
+  bool closed_;
+};
+
+typedef std::shared_ptr<CoroStream> CoroStreamPtr;
+// takes the stream by value, a reference would dangle in the coroutine frame
+typedef std::function<Task<void> (CoroStreamPtr)> StreamHandler;
+
+/// Makes a ConnectionCallback that runs @c handler as a coroutine for each
+/// new connection.  It takes over the connection's message and write
+/// complete callbacks, and its context.
+ConnectionCallback connectionCallback(const StreamHandler& handler);
+
+}  // namespace coro
+}  // namespace net
+}  // namespace muduo
+
+#endif  // MUDUO_NET_CORO_COROSTREAM_H
@@ -0,0 +1,220 @@
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+//
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+//
+// This is a public header file, it must only include public header files.
+// Needs C++20.
+
+#ifndef MUDUO_NET_CORO_TASK_H
+#define MUDUO_NET_CORO_TASK_H
+
+#include "muduo/base/Logging.h"
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+
+namespace muduo
+{
+namespace net
+{
+namespace coro
+{
+
+template<typename T> class Task;
+
+namespace detail
+{
+
+struct PromiseBase
+{
+  // resumes the awaiting coroutine, without growing the stack
+  struct FinalAwaiter
+  {
+    bool await_ready() noexcept { return false; }
+
+    template<typename Promise>
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> h) noexcept
+    {
+      std::coroutine_handle<> continuation = h.promise().continuation_;
+      return continuation ? continuation : std::noop_coroutine();
+    }
+
+    void await_resume() noexcept { }
+  };
+
+  std::suspend_always initial_suspend() noexcept { return {}; }
+  FinalAwaiter final_suspend() noexcept { return {}; }
+  void unhandled_exception() { exception_ = std::current_exception(); }
+
+  void rethrowIfFailed()
+  {
+    if (exception_)
+      std::rethrow_exception(exception_);
+  }
+
+  std::coroutine_handle<> continuation_;
+  std::exception_ptr exception_;
+};
+
+}  // namespace detail
+
+///
+/// A lazily started coroutine that produces a T.
+///
+/// Starts when co_await'ed, and resumes its awaiter when done, in whatever
+/// thread it finishes, normally the EventLoop thread of a connection.
+/// Use spawn() to start a Task<void> from plain code.
+///
+template<typename T = void>
+class Task
+{
+ public:
+  struct promise_type : detail::PromiseBase
+  {
+    Task get_return_object()
+    { return Task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+
+    template<typename U>
+    void return_value(U&& value) { value_.emplace(std::forward<U>(value)); }
+
+    std::optional<T> value_;
+  };
+
+  Task(Task&& rhs) noexcept
+    : handle_(std::exchange(rhs.handle_, nullptr))
+  {
+  }
+
+  Task(const Task&) = delete;
+  Task& operator=(const Task&) = delete;
+
+  ~Task()
+  {
+    if (handle_)
+      handle_.destroy();
+  }
+
+  bool await_ready() const noexcept { return false; }
+
+  std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiter) noexcept
+  {
+    handle_.promise().continuation_ = awaiter;
+    return handle_;
+  }
+
+  T await_resume()
+  {
+    handle_.promise().rethrowIfFailed();
+    return std::move(*handle_.promise().value_);
+  }
+
+ private:
+  explicit Task(std::coroutine_handle<promise_type> h)
+    : handle_(h)
+  {
+  }
+
+  std::coroutine_handle<promise_type> handle_;
+};
+
+template<>
+class Task<void>
+{
+ public:
+  struct promise_type : detail::PromiseBase
+  {
+    Task get_return_object()
+    { return Task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+
+    void return_void() { }
+  };
+
+  Task(Task&& rhs) noexcept
+    : handle_(std::exchange(rhs.handle_, nullptr))
+  {
+  }
+
+  Task(const Task&) = delete;
+  Task& operator=(const Task&) = delete;
+
+  ~Task()
+  {
+    if (handle_)
+      handle_.destroy();
+  }
+
+  bool await_ready() const noexcept { return false; }
+
+  std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiter) noexcept
+  {
+    handle_.promise().continuation_ = awaiter;
+    return handle_;
+  }
+
+  void await_resume()
+  {
+    handle_.promise().rethrowIfFailed();
+  }
+
+ private:
+  explicit Task(std::coroutine_handle<promise_type> h)
+    : handle_(h)
+  {
+  }
+
+  std::coroutine_handle<promise_type> handle_;
+};
+
+namespace detail
+{
+
+// owns itself, the frame is freed when the body finishes
+struct Detached
+{
+  struct promise_type
+  {
+    Detached get_return_object() { return {}; }
+    std::suspend_never initial_suspend() noexcept { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void return_void() { }
+
+    void unhandled_exception()
+    {
+      try
+      {
+        throw;
+      }
+      catch (const std::exception& ex)
+      {
+        LOG_FATAL << "coro::spawn - uncaught exception: " << ex.what();
+      }
+      catch (...)
+      {
+        LOG_FATAL << "coro::spawn - uncaught exception";
+      }
+    }
+  };
+};
+
+inline Detached runDetached(Task<void> task)
+{
+  co_await task;
+}
+
+}  // namespace detail
+
+/// Runs @c task until its first suspension, then lets it go on its own.
+/// An exception escaping @c task is fatal.
+inline void spawn(Task<void> task)
+{
+  detail::runDetached(std::move(task));
+}
+
+}  // namespace coro
+}  // namespace net
+}  // namespace muduo
+
+#endif  // MUDUO_NET_CORO_TASK_H
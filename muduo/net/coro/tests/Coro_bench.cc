@@ -0,0 +1,111 @@
+// Per-request overhead of the coroutine layer, against a callback based
+// line echo server.  One blocking client does request-response round trips.
+//
+// Usage: coro_bench [requests]
+
+#include "muduo/net/coro/CoroStream.h"
+
+#include "muduo/base/Logging.h"
+#include "muduo/net/EventLoop.h"
+#include "muduo/net/EventLoopThread.h"
+#include "muduo/net/TcpServer.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+using namespace muduo;
+using namespace muduo::net;
+
+void onCallbackMessage(const TcpConnectionPtr& conn, Buffer* buf, Timestamp)
+{
+  const char* eol;
+  while ((eol = buf->findEOL()) != NULL)
+  {
+    conn->send(buf->peek(), static_cast<int>(eol + 1 - buf->peek()));
+    buf->retrieveUntil(eol + 1);
+  }
+}
+
+coro::Task<void> coroEcho(coro::CoroStreamPtr stream)
+{
+  while (true)
+  {
+    string line = co_await stream->readUntil("\n");
+    if (stream->closed())
+      break;
+    stream->write(line);
+  }
+}
+
+double roundTrips(uint16_t port, int requests)
+{
+  int sockfd = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  InetAddress serverAddr("127.0.0.1", port);
+  if (::connect(sockfd, serverAddr.getSockAddr(),
+                static_cast<socklen_t>(sizeof(struct sockaddr_in))) != 0)
+  {
+    perror("connect");
+    exit(1);
+  }
+  const char request[] = "GET /index.html\n";
+  const size_t len = sizeof(request) - 1;
+  char response[sizeof request];
+  Timestamp start(Timestamp::now());
+  for (int i = 0; i < requests; ++i)
+  {
+    if (::write(sockfd, request, len) != static_cast<ssize_t>(len))
+      abort();
+    size_t got = 0;
+    while (got < len)
+    {
+      ssize_t n = ::read(sockfd, response + got, len - got);
+      if (n <= 0)
+        abort();
+      got += static_cast<size_t>(n);
+    }
+  }
+  double elapsed = timeDifference(Timestamp::now(), start);
+  ::close(sockfd);
+  return elapsed;
+}
+
+int main(int argc, char* argv[])
+{
+  int requests = argc > 1 ? atoi(argv[1]) : 100000;
+  Logger::setLogLevel(Logger::WARN);
+
+  EventLoopThread serverThread;
+  EventLoop* loop = serverThread.startLoop();
+  std::unique_ptr<TcpServer> callbackServer;
+  std::unique_ptr<TcpServer> coroServer;
+  loop->runInLoop([&]
+  {
+    callbackServer.reset(new TcpServer(loop, InetAddress("127.0.0.1", 2040), "Callback"));
+    callbackServer->setMessageCallback(onCallbackMessage);
+    callbackServer->start();
+    coroServer.reset(new TcpServer(loop, InetAddress("127.0.0.1", 2041), "Coro"));
+    coroServer->setConnectionCallback(coro::connectionCallback(coroEcho));
+    coroServer->start();
+  });
+  usleep(100 * 1000);
+
+  // warm up
+  roundTrips(2040, requests / 10);
+  roundTrips(2041, requests / 10);
+
+  double callback = roundTrips(2040, requests);
+  double coroutine = roundTrips(2041, requests);
+  printf("%d requests\n", requests);
+  printf("callback  %.3f us/request\n", callback * 1e6 / requests);
+  printf("coroutine %.3f us/request\n", coroutine * 1e6 / requests);
+  printf("overhead  %.3f us/request\n", (coroutine - callback) * 1e6 / requests);
+
+  loop->runInLoop([&]
+  {
+    callbackServer.reset();
+    coroServer.reset();
+  });
+  usleep(100 * 1000);
+}
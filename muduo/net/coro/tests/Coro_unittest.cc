@@ -0,0 +1,182 @@
+#include "muduo/net/coro/Awaitables.h"
+#include "muduo/net/coro/CoroStream.h"
+
+#include "muduo/net/EventLoop.h"
+#include "muduo/net/EventLoopThread.h"
+#include "muduo/net/TcpServer.h"
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+//#define BOOST_TEST_MODULE CoroTest
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+using namespace muduo;
+using namespace muduo::net;
+using namespace muduo::net::coro;
+
+const size_t kBigMessage = 4 * 1024 * 1024;
+
+EventLoop* g_otherLoop;
+AtomicInt32 g_sessionsDone;
+
+Task<string> readLine(CoroStreamPtr stream)
+{
+  string line = co_await stream->readUntil("\r\n");
+  co_return line;
+}
+
+Task<void> session(CoroStreamPtr stream)
+{
+  while (true)
+  {
+    string line = co_await readLine(stream);
+    if (stream->closed())
+      break;
+
+    if (line == "read4\r\n")
+    {
+      string data = co_await stream->read(4);
+      stream->write("got " + data + "\r\n");
+    }
+    else if (line == "sleep\r\n")
+    {
+      Timestamp start(Timestamp::now());
+      co_await sleepFor(stream->getLoop(), 0.1);
+      bool slept = timeDifference(Timestamp::now(), start) >= 0.09
+          && stream->getLoop()->isInLoopThread();
+      stream->write(slept ? "slept\r\n" : "woke early\r\n");
+    }
+    else if (line == "other\r\n")
+    {
+      int answer = co_await runIn(g_otherLoop, []
+      {
+        return g_otherLoop->isInLoopThread() ? 42 : -1;
+      });
+      bool home = stream->getLoop()->isInLoopThread();
+      stream->write(home ? std::to_string(answer) + "\r\n" : "lost\r\n");
+    }
+    else if (line == "big\r\n")
+    {
+      stream->write(string(kBigMessage, 'x'));
+      bool flushedLater = stream->connection()->outputBuffer()->readableBytes() > 0;
+      bool ok = co_await stream->drain();
+      bool empty = stream->connection()->outputBuffer()->readableBytes() == 0;
+      stream->write(ok && empty && flushedLater ? "drained\r\n" : "not drained\r\n");
+    }
+    else
+    {
+      stream->write(line);
+    }
+  }
+  g_sessionsDone.increment();
+}
+
+class Client
+{
+ public:
+  explicit Client(uint16_t port)
+    : sockfd_(::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0))
+  {
+    InetAddress serverAddr("127.0.0.1", port);
+    int ret = ::connect(sockfd_, serverAddr.getSockAddr(),
+                        static_cast<socklen_t>(sizeof(struct sockaddr_in)));
+    BOOST_CHECK(ret == 0);
+  }
+
+  ~Client()
+  {
+    ::close(sockfd_);
+  }
+
+  void send(const string& data)
+  {
+    BOOST_CHECK(::write(sockfd_, data.data(), data.size()) == static_cast<ssize_t>(data.size()));
+  }
+
+  string readLine()
+  {
+    size_t eol;
+    while ((eol = buffer_.find("\r\n")) == string::npos)
+    {
+      char buf[65536];
+      ssize_t n = ::read(sockfd_, buf, sizeof buf);
+      if (n <= 0)
+        return string();
+      buffer_.append(buf, static_cast<size_t>(n));
+    }
+    string line(buffer_, 0, eol + 2);
+    buffer_.erase(0, eol + 2);
+    return line;
+  }
+
+ private:
+  int sockfd_;
+  string buffer_;
+};
+
+BOOST_AUTO_TEST_CASE(testSession)
+{
+  EventLoopThread otherThread;
+  g_otherLoop = otherThread.startLoop();
+
+  EventLoopThread serverThread;
+  EventLoop* loop = serverThread.startLoop();
+  const uint16_t port = 2039;
+  std::unique_ptr<TcpServer> server;
+  loop->runInLoop([&]
+  {
+    server.reset(new TcpServer(loop, InetAddress("127.0.0.1", port), "CoroServer"));
+    server->setThreadNum(1);
+    server->setConnectionCallback(connectionCallback(session));
+    server->start();
+  });
+  usleep(100 * 1000);
+
+  {
+    Client client(port);
+    client.send("hello\r\n");
+    BOOST_CHECK(client.readLine() == "hello\r\n");
+
+    // the delimiter arrives in pieces
+    client.send("hel");
+    usleep(20 * 1000);
+    client.send("lo\r");
+    usleep(20 * 1000);
+    client.send("\n");
+    BOOST_CHECK(client.readLine() == "hello\r\n");
+
+    // pipelined
+    client.send("a\r\nb\r\n");
+    BOOST_CHECK(client.readLine() == "a\r\n");
+    BOOST_CHECK(client.readLine() == "b\r\n");
+
+    client.send("read4\r\nab");
+    usleep(20 * 1000);
+    client.send("cd");
+    BOOST_CHECK(client.readLine() == "got abcd\r\n");
+
+    client.send("sleep\r\n");
+    BOOST_CHECK(client.readLine() == "slept\r\n");
+
+    client.send("other\r\n");
+    BOOST_CHECK(client.readLine() == "42\r\n");
+
+    client.send("big\r\n");
+    string big = client.readLine();
+    BOOST_CHECK(big.size() == kBigMessage + 9);
+    BOOST_CHECK(big.size() > 9 && big.compare(kBigMessage, 9, "drained\r\n") == 0);
+  }
+  {
+    Client client2(port);
+    client2.send("bye\r\n");
+    BOOST_CHECK(client2.readLine() == "bye\r\n");
+  }
+  usleep(100 * 1000);
+  BOOST_CHECK(g_sessionsDone.get() == 2);
+
+  loop->runInLoop([&] { server.reset(); });
+  usleep(100 * 1000);
+}
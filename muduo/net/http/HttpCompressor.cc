@@ -0,0 +1,397 @@
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+//
+
+#include "muduo/net/http/HttpCompressor.h"
+
+#include "muduo/base/Logging.h"
+#include "muduo/net/ZlibStream.h"
+#include "muduo/net/http/HttpRequest.h"
+#include "muduo/net/http/HttpResponse.h"
+
+#include <algorithm>
+
+#include <strings.h>
+
+using namespace muduo;
+using namespace muduo::net;
+
+namespace
+{
+
+// waited longer than these, the loop is busy, then overloaded
+const double kBusyLag = 0.001;
+const double kOverloadedLag = 0.010;
+
+bool equalsIgnoreCase(StringPiece a, StringPiece b)
+{
+  return a.size() == b.size() && ::strncasecmp(a.data(), b.data(), a.size()) == 0;
+}
+
+bool containsIgnoreCase(StringPiece s, StringPiece word)
+{
+  for (int i = 0; i + word.size() <= s.size(); ++i)
+  {
+    if (::strncasecmp(s.data() + i, word.data(), word.size()) == 0)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+StringPiece trim(const char* begin, const char* end)
+{
+  while (begin < end && isspace(*begin))
+  {
+    ++begin;
+  }
+  while (begin < end && isspace(end[-1]))
+  {
+    --end;
+  }
+  return StringPiece(begin, static_cast<int>(end - begin));
+}
+
+// ";q=0", ";q=0.000" and the like
+bool qualityZero(StringPiece params)
+{
+  const char* end = params.end();
+  for (const char* p = params.begin(); p < end; ++p)
+  {
+    if ((*p == 'q' || *p == 'Q') && p + 1 < end && p[1] == '=')
+    {
+      StringPiece value = trim(p + 2, std::find(p, end, ';'));
+      return !value.empty() && value[0] == '0' &&
+             std::find_if(value.begin(), value.end(),
+                          [](char c) { return c != '0' && c != '.'; }) == value.end();
+    }
+  }
+  return false;
+}
+
+// in the headers set one by one, then in the raw ones
+StringPiece findHeader(const HttpResponse& resp, StringPiece field)
+{
+  for (const auto& header : resp.headers())
+  {
+    if (equalsIgnoreCase(header.field, field))
+    {
+      return header.value;
+    }
+  }
+  if (resp.rawHeaders())
+  {
+    const string& lines = *resp.rawHeaders();
+    size_t start = 0;
+    size_t crlf;
+    while ((crlf = lines.find("\r\n", start)) != string::npos)
+    {
+      StringPiece line(lines.data() + start, static_cast<int>(crlf - start));
+      if (line.size() > field.size() && line[field.size()] == ':' &&
+          ::strncasecmp(line.data(), field.data(), field.size()) == 0)
+      {
+        return trim(line.begin() + field.size() + 1, line.end());
+      }
+      start = crlf + 2;
+    }
+  }
+  return StringPiece();
+}
+
+// a strong ETag names the bytes sent, which differ once compressed
+std::shared_ptr<const string> weakenETag(const std::shared_ptr<const string>& rawHeaders)
+{
+  if (!rawHeaders)
+  {
+    return rawHeaders;
+  }
+  size_t pos = rawHeaders->find("ETag: \"");
+  if (pos == string::npos || (pos > 0 && (*rawHeaders)[pos-1] != '\n'))
+  {
+    return rawHeaders;
+  }
+  std::shared_ptr<string> lines(new string(*rawHeaders));
+  lines->insert(pos + 6, "W/");
+  return lines;
+}
+
+// once the body is replaced by its gzip, both the raw and the set ones
+void weakenETags(HttpResponse* resp)
+{
+  resp->setRawHeaders(weakenETag(resp->rawHeaders()));
+  for (const auto& header : resp->headers())
+  {
+    if (equalsIgnoreCase(header.field, "ETag") && !StringPiece(header.value).starts_with("W/"))
+    {
+      resp->addHeader("ETag", "W/" + header.value);
+      break;
+    }
+  }
+}
+
+// the client revalidates the gzip it got before, with the weakened ETag
+bool revalidatesGzip(const HttpRequest& req, const HttpResponse& resp)
+{
+  StringPiece etag = findHeader(resp, "ETag");
+  if (etag.empty() || etag.starts_with("W/"))
+  {
+    return false;
+  }
+  string weak = "W/" + etag.as_string();
+  StringPiece ifNoneMatch = req.getHeader("If-None-Match");
+  return std::search(ifNoneMatch.begin(), ifNoneMatch.end(),
+                     weak.begin(), weak.end()) != ifNoneMatch.end();
+}
+
+// Setting up a deflate stream costs more than compressing a few KiB,
+// so each thread keeps one.
+struct Deflater
+{
+  Deflater()
+    : level(Z_DEFAULT_COMPRESSION),
+      stream(new ZlibOutputStream(&output, level, true))
+  {
+  }
+
+  Buffer output;
+  int level;
+  std::unique_ptr<ZlibOutputStream> stream;
+};
+
+thread_local Deflater t_deflater;
+
+// NULL if no smaller
+std::shared_ptr<const string> gzip(StringPiece body, int level)
+{
+  Deflater& deflater = t_deflater;
+  bool ok = (level == deflater.level || deflater.stream->setLevel(level)) &&
+            deflater.stream->write(body) &&
+            deflater.stream->finishAndReset();
+  if (!ok)
+  {
+    LOG_ERROR << "HttpCompressor gzip " << deflater.stream->zlibErrorCode();
+    deflater.output.retrieveAll();
+    deflater.level = Z_DEFAULT_COMPRESSION;
+    deflater.stream.reset(new ZlibOutputStream(&deflater.output, deflater.level, true));
+    return std::shared_ptr<const string>();
+  }
+  deflater.level = level;
+  if (deflater.output.readableBytes() >= static_cast<size_t>(body.size()))
+  {
+    deflater.output.retrieveAll();
+    return std::shared_ptr<const string>();
+  }
+  return std::make_shared<const string>(deflater.output.retrieveAllAsString());
+}
+
+}  // namespace
+
+HttpCompressor::HttpCompressor(int level, size_t minSize, size_t maxCachedBytes)
+  : level_(level),
+    minSize_(minSize),
+    maxCachedBytes_(maxCachedBytes),
+    cachedBytes_(0)
+{
+}
+
+void HttpCompressor::compress(const HttpRequest& req,
+                              HttpResponse* resp,
+                              Timestamp receiveTime)
+{
+  if (req.method() == HttpRequest::kHead ||
+      resp->statusCode() == HttpResponse::k206PartialContent ||
+      resp->file() || resp->chunkWriter() ||
+      !compressible(findHeader(*resp, "Content-Type")) ||
+      !findHeader(*resp, "Content-Encoding").empty())
+  {
+    return;
+  }
+
+  // either encoding may be sent for the url
+  StringPiece vary = findHeader(*resp, "Vary");
+  if (vary.empty())
+  {
+    resp->addHeader("Vary", "Accept-Encoding");
+  }
+  else if (!containsIgnoreCase(vary, "Accept-Encoding") && vary != "*")
+  {
+    resp->addHeader("Vary", vary.as_string() + ", Accept-Encoding");
+  }
+  if (!acceptsGzip(req.getHeader("Accept-Encoding")))
+  {
+    return;
+  }
+  if (resp->statusCode() == HttpResponse::k304NotModified)
+  {
+    // no body, but the headers of the gzip it stands for
+    if (revalidatesGzip(req, *resp))
+    {
+      weakenETags(resp);
+    }
+    return;
+  }
+  if (static_cast<size_t>(resp->body().size()) < minSize_)
+  {
+    return;
+  }
+
+  if (resp->sharedBody())
+  {
+    compressShared(resp);
+    return;
+  }
+
+  int level = levelFor(timeDifference(Timestamp::now(), receiveTime));
+  std::shared_ptr<const string> gzipped = gzip(resp->body(), level);
+  if (gzipped)
+  {
+    resp->setSharedBody(gzipped);
+    weakenETags(resp);
+    resp->addHeader("Content-Encoding", "gzip");
+  }
+}
+
+// Repeated static bodies are compressed once, looked up by address, which
+// the weak pointers tell apart from a new body at the same place.
+void HttpCompressor::compressShared(HttpResponse* resp)
+{
+  const std::shared_ptr<const string>& body = resp->sharedBody();
+  Node node;
+  bool found = false;
+  {
+    MutexLockGuard lock(mutex_);
+    auto it = index_.find(body.get());
+    if (it != index_.end())
+    {
+      if (it->second->body.lock() == body &&
+          it->second->rawHeaders.lock() == resp->rawHeaders())
+      {
+        lru_.splice(lru_.begin(), lru_, it->second);
+        node = lru_.front();
+        found = true;
+      }
+      else
+      {
+        erase(it->second);
+      }
+    }
+  }
+
+  if (!found)
+  {
+    // outside the lock, another thread may do the same, the later wins
+    node.key = body.get();
+    node.body = body;
+    node.rawHeaders = resp->rawHeaders();
+    node.gzipped = gzip(*body, level_);
+    node.gzippedRawHeaders = weakenETag(resp->rawHeaders());
+
+    MutexLockGuard lock(mutex_);
+    auto it = index_.find(body.get());
+    if (it != index_.end())
+    {
+      erase(it->second);
+    }
+    lru_.push_front(node);
+    index_[body.get()] = lru_.begin();
+    cachedBytes_ += cost(node);
+    evict();
+  }
+
+  if (node.gzipped)
+  {
+    resp->setSharedBody(node.gzipped);
+    resp->setRawHeaders(node.gzippedRawHeaders);
+    resp->addHeader("Content-Encoding", "gzip");
+  }
+}
+
+// Bodies not worth compressing are kept too, so that they are not tried
+// again, and cost the node at least.
+size_t HttpCompressor::cost(const Node& node)
+{
+  return kNodeCost + (node.gzipped ? node.gzipped->size() : 0);
+}
+
+void HttpCompressor::erase(NodeList::iterator it)
+{
+  cachedBytes_ -= cost(*it);
+  index_.erase(it->key);
+  lru_.erase(it);
+}
+
+// Over the budget the least recently used go, and bodies gone with the
+// files they were read from go as soon as they come to the end.
+void HttpCompressor::evict()
+{
+  while (lru_.size() > 1 &&
+         (cachedBytes_ > maxCachedBytes_ || lru_.size() > kMaxCachedBodies ||
+          lru_.back().body.expired()))
+  {
+    erase(std::prev(lru_.end()));
+  }
+}
+
+int HttpCompressor::levelFor(double lag) const
+{
+  if (lag < kBusyLag)
+  {
+    return level_;
+  }
+  else if (lag < kOverloadedLag)
+  {
+    return std::max(1, level_ / 2);
+  }
+  else
+  {
+    return 1;
+  }
+}
+
+size_t HttpCompressor::cachedBodies() const
+{
+  MutexLockGuard lock(mutex_);
+  return lru_.size();
+}
+
+size_t HttpCompressor::cachedBytes() const
+{
+  MutexLockGuard lock(mutex_);
+  return cachedBytes_;
+}
+
+bool HttpCompressor::acceptsGzip(StringPiece acceptEncoding)
+{
+  bool any = false;
+  const char* p = acceptEncoding.begin();
+  const char* end = acceptEncoding.end();
+  while (p < end)
+  {
+    const char* comma = std::find(p, end, ',');
+    const char* semicolon = std::find(p, comma, ';');
+    StringPiece coding = trim(p, semicolon);
+    bool refused = qualityZero(StringPiece(semicolon, static_cast<int>(comma - semicolon)));
+    if (equalsIgnoreCase(coding, "gzip") || equalsIgnoreCase(coding, "x-gzip"))
+    {
+      return !refused;
+    }
+    else if (coding == "*")
+    {
+      any = !refused;
+    }
+    p = comma < end ? comma + 1 : end;
+  }
+  return any;
+}
+
+bool HttpCompressor::compressible(StringPiece contentType)
+{
+  // images, audio, video and archives are compressed already
+  return (contentType.size() >= 5 && ::strncasecmp(contentType.data(), "text/", 5) == 0) ||
+         containsIgnoreCase(contentType, "json") ||
+         containsIgnoreCase(contentType, "javascript") ||
+         containsIgnoreCase(contentType, "xml");
+}
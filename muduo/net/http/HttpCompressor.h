@@ -0,0 +1,97 @@
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+//
+// This is an internal header file, you should not include this.
+
+#ifndef MUDUO_NET_HTTP_HTTPCOMPRESSOR_H
+#define MUDUO_NET_HTTP_HTTPCOMPRESSOR_H
+
+#include "muduo/base/Mutex.h"
+#include "muduo/base/noncopyable.h"
+#include "muduo/base/StringPiece.h"
+#include "muduo/base/Timestamp.h"
+#include "muduo/base/Types.h"
+
+#include <list>
+#include <memory>
+#include <unordered_map>
+
+namespace muduo
+{
+namespace net
+{
+
+class HttpRequest;
+class HttpResponse;
+
+/// Compresses response bodies with gzip for HttpServer::setCompression().
+///
+/// Text, JSON, JavaScript and XML bodies of at least minSize bytes are
+/// compressed for clients that accept gzip; all responses of these types
+/// get Vary: Accept-Encoding, and a 304 to a client revalidating the gzip
+/// gets the weak ETag the gzip was sent with.  The level drops towards 1 as
+/// requests wait longer in a busy event loop.  Shared bodies, such as
+/// HttpStaticFiles sets, are compressed once at the full level and kept,
+/// up to maxCachedBytes and kMaxCachedBodies, the least recently used go
+/// first.
+class HttpCompressor : noncopyable
+{
+ public:
+  static const size_t kMaxCachedBodies = 4096;
+  // bookkeeping counted for each cached body
+  static const size_t kNodeCost = 256;
+
+  HttpCompressor(int level, size_t minSize, size_t maxCachedBytes);
+
+  /// Thread safe.
+  /// Replaces the body of resp by its gzip if worth it, receiveTime tells
+  /// how long the request has waited.  Not for HEAD, nor file, chunked or
+  /// partial bodies.
+  void compress(const HttpRequest& req, HttpResponse* resp, Timestamp receiveTime);
+
+  /// For a request that has waited lag seconds.
+  int levelFor(double lag) const;
+
+  /// Thread safe.
+  size_t cachedBodies() const;
+
+  /// Thread safe.  Of gzipped bodies, with kNodeCost for each.
+  size_t cachedBytes() const;
+
+  static bool acceptsGzip(StringPiece acceptEncoding);
+  static bool compressible(StringPiece contentType);
+
+ private:
+  // the gzip of a shared body, and its headers with the ETag weakened
+  struct Node
+  {
+    const string* key;
+    std::weak_ptr<const string> body;
+    std::weak_ptr<const string> rawHeaders;
+    std::shared_ptr<const string> gzipped;      // NULL if no smaller
+    std::shared_ptr<const string> gzippedRawHeaders;
+  };
+  typedef std::list<Node> NodeList;
+
+  void compressShared(HttpResponse* resp);
+  static size_t cost(const Node& node);
+  void erase(NodeList::iterator it) REQUIRES(mutex_);
+  void evict() REQUIRES(mutex_);
+
+  const int level_;
+  const size_t minSize_;
+  const size_t maxCachedBytes_;
+
+  mutable MutexLock mutex_;
+  // most recently used first
+  NodeList lru_ GUARDED_BY(mutex_);
+  std::unordered_map<const string*, NodeList::iterator> index_ GUARDED_BY(mutex_);
+  size_t cachedBytes_ GUARDED_BY(mutex_);
+};
+
+}  // namespace net
+}  // namespace muduo
+
+#endif  // MUDUO_NET_HTTP_HTTPCOMPRESSOR_H
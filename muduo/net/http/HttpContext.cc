@@ -10,9 +10,30 @@
 #include "muduo/net/Buffer.h"
 #include "muduo/net/http/HttpContext.h"
 
+#include <ctype.h>
+#include <strings.h>
+
 using namespace muduo;
 using namespace muduo::net;
 
+namespace
+{
+
+bool equalsIgnoreCase(StringPiece a, StringPiece b)
+{
+  return a.size() == b.size() && ::strncasecmp(a.data(), b.data(), a.size()) == 0;
+}
+
+bool isBodyHeader(StringPiece field)
+{
+  return equalsIgnoreCase(field, "Content-Length") ||
+         equalsIgnoreCase(field, "Transfer-Encoding");
+}
+
+}  // namespace
+
+const size_t HttpContext::kDefaultMaxBodySize;
+
 bool HttpContext::processRequestLine(const char* begin, const char* end)
 {
   bool succeed = false;
@@ -21,10 +42,15 @@ bool HttpContext::processRequestLine(const char* begin, const char* end)
   if (space != end && request_.setMethod(start, space))
   {
     start = space+1;
-    space = std::find(start, end, ' ');
-    if (space != end)
+    // URLs can be long, search them a block at a time
+    const char* question = Buffer::findAnyOf(start, end, " ?");
+    space = question;
+    if (question != NULL && *question == '?')
+    {
+      space = Buffer::findAnyOf(question, end, " ");
+    }
+    if (space != NULL)
     {
-      const char* question = std::find(start, space, '?');
       if (question != space)
       {
         request_.setPath(start, question);
@@ -56,23 +82,147 @@ bool HttpContext::processRequestLine(const char* begin, const char* end)
   return succeed;
 }
 
+bool HttpContext::processBodyHeaders(Buffer* buf, bool streaming)
+{
+  if (!bodyHeaders_)
+  {
+    // most requests, no need to look the headers up
+    state_ = kGotAll;
+    return true;
+  }
+
+  StringPiece transferEncoding = request_.getHeader("Transfer-Encoding");
+  StringPiece contentLength = request_.getHeader("Content-Length");
+  if (!transferEncoding.empty())
+  {
+    // FIXME: codings other than chunked
+    if (!equalsIgnoreCase(transferEncoding, "chunked"))
+    {
+      return false;
+    }
+    state_ = kExpectChunkSize;
+    if (!streaming && !chunkedBody_)
+    {
+      chunkedBody_.reset(new string);
+    }
+  }
+  else if (!contentLength.empty())
+  {
+    if (contentLength.size() > 18)
+    {
+      return false;
+    }
+    remaining_ = 0;
+    for (char c : contentLength)
+    {
+      if (!isdigit(c))
+      {
+        return false;
+      }
+      remaining_ = remaining_ * 10 + static_cast<size_t>(c - '0');
+    }
+    if (!streaming && remaining_ > maxBodySize_)
+    {
+      bodyTooLarge_ = true;
+      return false;
+    }
+    state_ = remaining_ > 0 ? kExpectBody : kGotAll;
+  }
+  else
+  {
+    state_ = kGotAll;
+  }
+
+  if (state_ != kGotAll)
+  {
+    streaming_ = streaming;
+    expectContinue_ = equalsIgnoreCase(request_.getHeader("Expect"), "100-continue");
+    if (streaming_)
+    {
+      // the body is retrieved as it is passed on, take the head out of buf
+      request_ = HttpRequest(request_);
+      buf->retrieve(parsed_);
+      parsed_ = 0;
+    }
+  }
+  return true;
+}
+
+bool HttpContext::processChunkSize(const char* begin, const char* end)
+{
+  size_t size = 0;
+  const char* p = begin;
+  for (; p < end && p - begin < 15 && isxdigit(*p); ++p)
+  {
+    int digit = *p <= '9' ? *p - '0' : (*p | 0x20) - 'a' + 10;
+    size = size * 16 + static_cast<size_t>(digit);
+  }
+  // chunk extensions are ignored
+  if (p == begin || (p < end && *p != ';' && *p != ' ' && *p != '\t'))
+  {
+    return false;
+  }
+
+  remaining_ = size;
+  if (size == 0)
+  {
+    state_ = kExpectChunkTrailers;
+  }
+  else if (!streaming_ && chunkedBody_->size() + size > maxBodySize_)
+  {
+    bodyTooLarge_ = true;
+    return false;
+  }
+  else
+  {
+    state_ = kExpectChunkData;
+  }
+  return true;
+}
+
+void HttpContext::processBody(const char* data, size_t len, const BodyCallback& onBody)
+{
+  if (streaming_)
+  {
+    onBody(request_, StringPiece(data, static_cast<int>(len)));
+  }
+  else if (state_ == kExpectChunkData)
+  {
+    chunkedBody_->append(data, len);
+  }
+  else
+  {
+    request_.setBody(data, data + len);
+  }
+  parsed_ += len;
+  remaining_ -= len;
+}
+
 // return false if any error
-bool HttpContext::parseRequest(Buffer* buf, Timestamp receiveTime)
+bool HttpContext::parseRequest(Buffer* buf, Timestamp receiveTime, const BodyCallback& onBody)
 {
+  if (base_ != NULL && base_ != buf->peek())
+  {
+    // the buffer grew or moved its data to the front
+    request_.rebase(base_, base_ + parsed_, buf->peek());
+  }
+
   bool ok = true;
   bool hasMore = true;
   while (hasMore)
   {
+    const char* start = buf->peek() + parsed_;
+    size_t readable = buf->readableBytes() - parsed_;
     if (state_ == kExpectRequestLine)
     {
-      const char* crlf = buf->findCRLF();
+      const char* crlf = buf->findCRLF(start);
       if (crlf)
       {
-        ok = processRequestLine(buf->peek(), crlf);
+        ok = processRequestLine(start, crlf);
         if (ok)
         {
           request_.setReceiveTime(receiveTime);
-          buf->retrieveUntil(crlf + 2);
+          parsed_ = static_cast<size_t>(crlf + 2 - buf->peek());
           state_ = kExpectHeaders;
         }
         else
@@ -87,32 +237,120 @@ bool HttpContext::parseRequest(Buffer* buf, Timestamp receiveTime)
     }
     else if (state_ == kExpectHeaders)
     {
-      const char* crlf = buf->findCRLF();
+      // one pass over the line: up to the colon, then up to the CRLF
+      const char* delim = Buffer::findAnyOf(start, buf->beginWrite(), ":\r");
+      const char* crlf = delim ? buf->findCRLF(delim) : NULL;
       if (crlf)
       {
-        const char* colon = std::find(buf->peek(), crlf, ':');
+        const char* colon = *delim == ':' ? delim : std::find(start, crlf, ':');
+        parsed_ = static_cast<size_t>(crlf + 2 - buf->peek());
         if (colon != crlf)
         {
-          request_.addHeader(buf->peek(), colon, crlf);
+          request_.addHeader(start, colon, crlf);
+          bodyHeaders_ = bodyHeaders_ ||
+              isBodyHeader(StringPiece(start, static_cast<int>(colon - start)));
         }
         else
         {
           // empty line, end of header
-          // FIXME:
+          ok = processBodyHeaders(buf, static_cast<bool>(onBody));
+          hasMore = ok && state_ != kGotAll;
+        }
+      }
+      else
+      {
+        hasMore = false;
+      }
+    }
+    else if (state_ == kExpectBody)
+    {
+      // passed on as it arrives, or kept in buf until it is all there
+      if (streaming_ ? readable > 0 : readable >= remaining_)
+      {
+        processBody(start, std::min(readable, remaining_), onBody);
+      }
+      if (remaining_ == 0)
+      {
+        state_ = kGotAll;
+      }
+      hasMore = false;
+    }
+    else if (state_ == kExpectChunkSize)
+    {
+      const char* crlf = buf->findCRLF(start);
+      if (crlf)
+      {
+        ok = processChunkSize(start, crlf);
+        parsed_ = static_cast<size_t>(crlf + 2 - buf->peek());
+        hasMore = ok;
+      }
+      else
+      {
+        hasMore = false;
+      }
+    }
+    else if (state_ == kExpectChunkData)
+    {
+      if (remaining_ > 0)
+      {
+        if (readable > 0)
+        {
+          processBody(start, std::min(readable, remaining_), onBody);
+        }
+        hasMore = remaining_ == 0;
+      }
+      else if (readable >= 2)
+      {
+        // the CRLF after the data
+        ok = start[0] == '\r' && start[1] == '\n';
+        parsed_ += 2;
+        state_ = kExpectChunkSize;
+        hasMore = ok;
+      }
+      else
+      {
+        hasMore = false;
+      }
+    }
+    else if (state_ == kExpectChunkTrailers)
+    {
+      // trailers are ignored
+      const char* crlf = buf->findCRLF(start);
+      if (crlf)
+      {
+        parsed_ = static_cast<size_t>(crlf + 2 - buf->peek());
+        if (crlf == start)
+        {
+          if (!streaming_)
+          {
+            request_.setBody(chunkedBody_->data(), chunkedBody_->data() + chunkedBody_->size());
+          }
           state_ = kGotAll;
           hasMore = false;
         }
-        buf->retrieveUntil(crlf + 2);
       }
       else
       {
         hasMore = false;
       }
     }
-    else if (state_ == kExpectBody)
+    else
+    {
+      hasMore = false;
+    }
+
+    if (streaming_)
     {
-      // FIXME:
+      buf->retrieve(parsed_);
+      parsed_ = 0;
     }
   }
+  base_ = buf->peek();
   return ok;
 }
+
+void HttpContext::retrieveRequest(Buffer* buf)
+{
+  buf->retrieve(parsed_);
+  reset();
+}
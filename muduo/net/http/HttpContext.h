@@ -11,10 +11,13 @@
 #ifndef MUDUO_NET_HTTP_HTTPCONTEXT_H
 #define MUDUO_NET_HTTP_HTTPCONTEXT_H
 
-#include "muduo/base/copyable.h"
+#include "muduo/base/noncopyable.h"
 
 #include "muduo/net/http/HttpRequest.h"
 
+#include <functional>
+#include <memory>
+
 namespace muduo
 {
 namespace net
@@ -22,7 +25,7 @@ namespace net
 
 class Buffer;
 
-class HttpContext : public muduo::copyable
+class HttpContext : noncopyable
 {
  public:
   enum HttpRequestParseState
@@ -30,29 +33,91 @@ class HttpContext : public muduo::copyable
     kExpectRequestLine,
     kExpectHeaders,
     kExpectBody,
+    kExpectChunkSize,
+    kExpectChunkData,
+    kExpectChunkTrailers,
     kGotAll,
   };
 
+  typedef std::function<void (const HttpRequest&, StringPiece data)> BodyCallback;
+
+  static const size_t kDefaultMaxBodySize = 1024 * 1024;
+
   HttpContext()
-    : state_(kExpectRequestLine)
+    : parsed_(0),
+      base_(NULL),
+      remaining_(0),
+      maxBodySize_(kDefaultMaxBodySize),
+      state_(kExpectRequestLine),
+      bodyHeaders_(false),
+      streaming_(false),
+      expectContinue_(false),
+      bodyTooLarge_(false),
+      responding_(false)
   {
   }
 
-  // default copy-ctor, dtor and assignment are fine
+  // bodies kept in buf for request().body() may not be larger
+  void setMaxBodySize(size_t maxBodySize)
+  { maxBodySize_ = maxBodySize; }
 
   // return false if any error
-  bool parseRequest(Buffer* buf, Timestamp receiveTime);
+  // The request head and body are left in buf and request() points into it,
+  // so nothing may be retrieved from buf before retrieveRequest().
+  bool parseRequest(Buffer* buf, Timestamp receiveTime)
+  { return parseRequest(buf, receiveTime, BodyCallback()); }
+
+  // With onBody, the body is passed to it piece by piece as it arrives and
+  // retrieved from buf, with no size limit, and request().body() is empty.
+  bool parseRequest(Buffer* buf, Timestamp receiveTime, const BodyCallback& onBody);
 
   bool gotAll() const
   { return state_ == kGotAll; }
 
+  // the error was a body larger than the max body size
+  bool bodyTooLarge() const
+  { return bodyTooLarge_; }
+
+  // true once, after the head of a request that has a body yet to come and
+  // "Expect: 100-continue"
+  bool takeExpectContinue()
+  {
+    bool expect = expectContinue_;
+    expectContinue_ = false;
+    return expect;
+  }
+
+  // drops the parsed request from buf, then reset()
+  void retrieveRequest(Buffer* buf);
+
   void reset()
   {
     state_ = kExpectRequestLine;
-    HttpRequest dummy;
-    request_.swap(dummy);
+    request_.clear();
+    parsed_ = 0;
+    base_ = NULL;
+    remaining_ = 0;
+    if (chunkedBody_ && chunkedBody_->capacity() > 64 * 1024)
+    {
+      chunkedBody_.reset();
+    }
+    else if (chunkedBody_)
+    {
+      chunkedBody_->clear();
+    }
+    bodyHeaders_ = false;
+    streaming_ = false;
+    expectContinue_ = false;
+    bodyTooLarge_ = false;
   }
 
+  // a chunked response is being written, requests after it have to wait
+  void setResponding(bool on)
+  { responding_ = on; }
+
+  bool responding() const
+  { return responding_; }
+
   const HttpRequest& request() const
   { return request_; }
 
@@ -61,9 +126,23 @@ class HttpContext : public muduo::copyable
 
  private:
   bool processRequestLine(const char* begin, const char* end);
+  bool processBodyHeaders(Buffer* buf, bool streaming);
+  bool processChunkSize(const char* begin, const char* end);
+  void processBody(const char* data, size_t len, const BodyCallback& onBody);
 
-  HttpRequestParseState state_;
   HttpRequest request_;
+  size_t parsed_;       // bytes of the request parsed, from buf->peek()
+  const char* base_;    // buf->peek() when last parsed
+  size_t remaining_;    // of the body or the chunk
+  size_t maxBodySize_;
+  // decoded, unless streaming, made for the first chunked request
+  std::unique_ptr<string> chunkedBody_;
+  HttpRequestParseState state_;
+  bool bodyHeaders_;    // Content-Length or Transfer-Encoding seen
+  bool streaming_;      // the body goes to a BodyCallback
+  bool expectContinue_;
+  bool bodyTooLarge_;
+  bool responding_;
 };
 
 }  // namespace net
@@ -12,18 +12,26 @@
 #define MUDUO_NET_HTTP_HTTPREQUEST_H
 
 #include "muduo/base/copyable.h"
+#include "muduo/base/StringPiece.h"
 #include "muduo/base/Timestamp.h"
 #include "muduo/base/Types.h"
 
-#include <map>
+#include <memory>
+#include <vector>
 #include <assert.h>
+#include <ctype.h>
 #include <stdio.h>
+#include <string.h>
+#include <strings.h>
 
 namespace muduo
 {
 namespace net
 {
 
+/// path(), query(), the headers and body() point into the connection's input
+/// buffer and are valid until the HttpCallback returns, copy the HttpRequest
+/// or call as_string() to keep them longer.  A copy owns its bytes.
 class HttpRequest : public muduo::copyable
 {
  public:
@@ -36,12 +44,42 @@ class HttpRequest : public muduo::copyable
     kUnknown, kHttp10, kHttp11
   };
 
+  struct Header
+  {
+    StringPiece field;
+    StringPiece value;
+  };
+
   HttpRequest()
     : method_(kInvalid),
       version_(kUnknown)
   {
   }
 
+  HttpRequest(const HttpRequest& that)
+    : method_(that.method_),
+      version_(that.version_),
+      path_(that.path_),
+      query_(that.query_),
+      receiveTime_(that.receiveTime_),
+      headers_(that.headers_),
+      body_(that.body_),
+      storage_(that.storage_)
+  {
+    if (!storage_)
+    {
+      own();
+    }
+  }
+
+  HttpRequest(HttpRequest&&) = default;
+
+  HttpRequest& operator=(HttpRequest that)
+  {
+    swap(that);
+    return *this;
+  }
+
   void setVersion(Version v)
   {
     version_ = v;
@@ -53,7 +91,7 @@ class HttpRequest : public muduo::copyable
   bool setMethod(const char* start, const char* end)
   {
     assert(method_ == kInvalid);
-    string m(start, end);
+    StringPiece m(start, static_cast<int>(end - start));
     if (m == "GET")
     {
       method_ = kGet;
@@ -110,20 +148,22 @@ class HttpRequest : public muduo::copyable
     return result;
   }
 
+  /// Does not copy, [start, end) must outlive the request.
   void setPath(const char* start, const char* end)
   {
-    path_.assign(start, end);
+    path_.set(start, static_cast<int>(end - start));
   }
 
-  const string& path() const
+  StringPiece path() const
   { return path_; }
 
+  /// Does not copy, [start, end) must outlive the request.
   void setQuery(const char* start, const char* end)
   {
-    query_.assign(start, end);
+    query_.set(start, static_cast<int>(end - start));
   }
 
-  const string& query() const
+  StringPiece query() const
   { return query_; }
 
   void setReceiveTime(Timestamp t)
@@ -132,53 +172,147 @@ class HttpRequest : public muduo::copyable
   Timestamp receiveTime() const
   { return receiveTime_; }
 
+  /// Does not copy, [start, end) must outlive the request.
   void addHeader(const char* start, const char* colon, const char* end)
   {
-    string field(start, colon);
-    ++colon;
-    while (colon < end && isspace(*colon))
+    const char* value = colon + 1;
+    while (value < end && isspace(*value))
     {
-      ++colon;
+      ++value;
     }
-    string value(colon, end);
-    while (!value.empty() && isspace(value[value.size()-1]))
+    while (value < end && isspace(end[-1]))
     {
-      value.resize(value.size()-1);
+      --end;
     }
-    headers_[field] = value;
+    Header header;
+    header.field.set(start, static_cast<int>(colon - start));
+    header.value.set(value, static_cast<int>(end - value));
+    headers_.push_back(header);
   }
 
-  string getHeader(const string& field) const
+  /// Case-insensitive, returns the first one, or an empty piece.
+  StringPiece getHeader(StringPiece field) const
   {
-    string result;
-    std::map<string, string>::const_iterator it = headers_.find(field);
-    if (it != headers_.end())
+    for (const Header& header : headers_)
     {
-      result = it->second;
+      if (header.field.size() == field.size() &&
+          ::strncasecmp(header.field.data(), field.data(), field.size()) == 0)
+      {
+        return header.value;
+      }
     }
-    return result;
+    return StringPiece();
   }
 
-  const std::map<string, string>& headers() const
+  /// In the order received.
+  const std::vector<Header>& headers() const
   { return headers_; }
 
+  /// Does not copy, [start, end) must outlive the request.
+  void setBody(const char* start, const char* end)
+  {
+    body_.set(start, static_cast<int>(end - start));
+  }
+
+  /// Empty if the body was passed to an HttpBodyCallback instead.
+  StringPiece body() const
+  { return body_; }
+
+  /// Keeps the capacity of headers, for the next request on the connection.
+  void clear()
+  {
+    method_ = kInvalid;
+    version_ = kUnknown;
+    path_.clear();
+    query_.clear();
+    receiveTime_ = Timestamp();
+    headers_.clear();
+    body_.clear();
+    storage_.reset();
+  }
+
+  /// The bytes in [oldBegin, oldEnd) moved to newBegin, e.g. the input
+  /// buffer grew.  Pieces pointing elsewhere stay.
+  void rebase(const char* oldBegin, const char* oldEnd, const char* newBegin)
+  {
+    rebase(&path_, oldBegin, oldEnd, newBegin);
+    rebase(&query_, oldBegin, oldEnd, newBegin);
+    for (Header& header : headers_)
+    {
+      rebase(&header.field, oldBegin, oldEnd, newBegin);
+      rebase(&header.value, oldBegin, oldEnd, newBegin);
+    }
+    rebase(&body_, oldBegin, oldEnd, newBegin);
+  }
+
   void swap(HttpRequest& that)
   {
     std::swap(method_, that.method_);
     std::swap(version_, that.version_);
-    path_.swap(that.path_);
-    query_.swap(that.query_);
+    std::swap(path_, that.path_);
+    std::swap(query_, that.query_);
     receiveTime_.swap(that.receiveTime_);
     headers_.swap(that.headers_);
+    std::swap(body_, that.body_);
+    storage_.swap(that.storage_);
   }
 
  private:
+  static void rebase(StringPiece* piece,
+                     const char* oldBegin, const char* oldEnd, const char* newBegin)
+  {
+    if (oldBegin <= piece->data() && piece->end() <= oldEnd)
+    {
+      piece->set(newBegin + (piece->data() - oldBegin), piece->size());
+    }
+  }
+
+  static void copyTo(StringPiece* piece, char** out)
+  {
+    if (piece->data() == NULL)
+    {
+      return;
+    }
+    memcpy(*out, piece->data(), piece->size());
+    piece->set(*out, piece->size());
+    *out += piece->size();
+  }
+
+  // copies what the pieces point to into storage_
+  void own()
+  {
+    size_t len = path_.size() + query_.size();
+    for (const Header& header : headers_)
+    {
+      len += header.field.size() + header.value.size();
+    }
+    len += body_.size();
+    if (len == 0)
+    {
+      return;
+    }
+    std::shared_ptr<string> storage(new string(len, '\0'));
+    char* out = &(*storage)[0];
+    copyTo(&path_, &out);
+    copyTo(&query_, &out);
+    for (Header& header : headers_)
+    {
+      copyTo(&header.field, &out);
+      copyTo(&header.value, &out);
+    }
+    copyTo(&body_, &out);
+    storage_ = storage;
+  }
+
   Method method_;
   Version version_;
-  string path_;
-  string query_;
+  StringPiece path_;
+  StringPiece query_;
   Timestamp receiveTime_;
-  std::map<string, string> headers_;
+  std::vector<Header> headers_;
+  StringPiece body_;
+  // immutable once set, shared by copies
+  std::shared_ptr<const string> storage_;
 };
 
 }  // namespace net
@@ -8,40 +8,224 @@
 //
 
 #include "muduo/net/http/HttpResponse.h"
+
+#include "muduo/base/Logging.h"
 #include "muduo/net/Buffer.h"
 
 #include <stdio.h>
+#include <strings.h>
+#include <unistd.h>
 
 using namespace muduo;
 using namespace muduo::net;
 
-void HttpResponse::appendToBuffer(Buffer* output) const
+namespace
 {
-  char buf[32];
-  snprintf(buf, sizeof buf, "HTTP/1.1 %d ", statusCode_);
-  output->append(buf);
-  output->append(statusMessage_);
-  output->append("\r\n");
 
+const int kStatusLinePrefix = sizeof "HTTP/1.1 200 " - 1;
+
+// "HTTP/1.1 200 OK\r\n", empty if not a known code
+StringPiece statusLine(int code)
+{
+  switch (code)
+  {
+#define STATUS_LINE(num, reason) \
+    case num: return StringPiece("HTTP/1.1 " #num " " reason "\r\n");
+    STATUS_LINE(200, "OK")
+    STATUS_LINE(204, "No Content")
+    STATUS_LINE(206, "Partial Content")
+    STATUS_LINE(301, "Moved Permanently")
+    STATUS_LINE(302, "Found")
+    STATUS_LINE(304, "Not Modified")
+    STATUS_LINE(400, "Bad Request")
+    STATUS_LINE(403, "Forbidden")
+    STATUS_LINE(404, "Not Found")
+    STATUS_LINE(405, "Method Not Allowed")
+    STATUS_LINE(413, "Payload Too Large")
+    STATUS_LINE(416, "Range Not Satisfiable")
+    STATUS_LINE(500, "Internal Server Error")
+    STATUS_LINE(503, "Service Unavailable")
+#undef STATUS_LINE
+    default:
+      return StringPiece();
+  }
+}
+
+const char* const kDays[] = { "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat" };
+const char* const kMonths[] = { "Jan", "Feb", "Mar", "Apr", "May", "Jun",
+                                "Jul", "Aug", "Sep", "Oct", "Nov", "Dec" };
+
+int formatHttpDate(char* buf, size_t size, const char* prefix, time_t seconds)
+{
+  struct tm tm_time;
+  ::gmtime_r(&seconds, &tm_time);
+  return snprintf(buf, size, "%s%s, %02d %s %4d %02d:%02d:%02d GMT",
+                  prefix, kDays[tm_time.tm_wday], tm_time.tm_mday,
+                  kMonths[tm_time.tm_mon], tm_time.tm_year + 1900,
+                  tm_time.tm_hour, tm_time.tm_min, tm_time.tm_sec);
+}
+
+// formatted once a second by each loop thread
+__thread char t_date[64];
+__thread int t_dateLength;
+__thread int64_t t_dateSecond;
+
+// "Date: Sun, 06 Nov 1994 08:49:37 GMT\r\n"
+StringPiece dateHeader(Timestamp now)
+{
+  int64_t seconds = now.secondsSinceEpoch();
+  if (seconds != t_dateSecond || t_dateLength == 0)
+  {
+    t_dateSecond = seconds;
+    t_dateLength = formatHttpDate(t_date, sizeof t_date - 2, "Date: ",
+                                  static_cast<time_t>(seconds));
+    t_date[t_dateLength++] = '\r';
+    t_date[t_dateLength++] = '\n';
+  }
+  return StringPiece(t_date, t_dateLength);
+}
+
+// writes the decimal digits of value before end, returns where they start
+char* formatDecimal(char* end, size_t value)
+{
+  char* p = end;
+  do
+  {
+    *--p = static_cast<char>('0' + value % 10);
+    value /= 10;
+  } while (value != 0);
+  return p;
+}
+
+}  // namespace
+
+HttpResponse::File::~File()
+{
+  ::close(fd_);
+}
+
+string HttpResponse::formatDate(time_t seconds)
+{
+  char buf[64];
+  int len = formatHttpDate(buf, sizeof buf, "", seconds);
+  return string(buf, len);
+}
+
+void HttpResponse::addHeader(StringPiece field, StringPiece value)
+{
+  for (auto& header : headers_)
+  {
+    if (header.field.size() == static_cast<size_t>(field.size()) &&
+        ::strncasecmp(header.field.data(), field.data(), field.size()) == 0)
+    {
+      value.CopyToString(&header.value);
+      return;
+    }
+  }
+  headers_.push_back(Header{ field.as_string(), value.as_string() });
+}
+
+void HttpResponse::appendHeadToBuffer(Buffer* output, Timestamp now) const
+{
+  StringPiece line = statusLine(statusCode_);
+  if (!line.empty() &&
+      (statusMessage_.empty() ||
+       StringPiece(line.data() + kStatusLinePrefix,
+                   line.size() - kStatusLinePrefix - 2) == statusMessage_))
+  {
+    output->append(line);
+  }
+  else
+  {
+    char buf[32];
+    char* end = buf + sizeof buf;
+    char* start = formatDecimal(end, statusCode_);
+    output->append("HTTP/1.1 ");
+    output->append(start, end - start);
+    output->append(" ");
+    output->append(statusMessage_);
+    output->append("\r\n");
+  }
+
+  if (now.valid())
+  {
+    output->append(dateHeader(now));
+  }
+  if (chunkWriter_ && !closeDelimited_)
+  {
+    output->append("Transfer-Encoding: chunked\r\n");
+  }
+  // with close too, for HEAD, but none with a 204 or 304, nor with chunks
+  if (!chunkWriter_ && statusCode_ != k204NoContent && statusCode_ != k304NotModified)
+  {
+    char buf[32];
+    char* end = buf + sizeof buf;
+    *--end = '\n';
+    *--end = '\r';
+    char* start = formatDecimal(end, file_ ? fileLength_ : static_cast<size_t>(body().size()));
+    output->append("Content-Length: ");
+    output->append(start, buf + sizeof buf - start);
+  }
   if (closeConnection_)
   {
     output->append("Connection: close\r\n");
   }
   else
   {
-    snprintf(buf, sizeof buf, "Content-Length: %zd\r\n", body_.size());
-    output->append(buf);
     output->append("Connection: Keep-Alive\r\n");
   }
 
   for (const auto& header : headers_)
   {
-    output->append(header.first);
+    output->append(header.field);
     output->append(": ");
-    output->append(header.second);
+    output->append(header.value);
     output->append("\r\n");
   }
+  if (rawHeaders_)
+  {
+    output->append(*rawHeaders_);
+  }
 
   output->append("\r\n");
-  output->append(body_);
+}
+
+void HttpResponse::appendToBuffer(Buffer* output) const
+{
+  appendHeadToBuffer(output);
+  if (file_)
+  {
+    off_t offset = fileOffset_;
+    size_t remaining = fileLength_;
+    while (remaining > 0)
+    {
+      output->ensureWritableBytes(remaining);
+      ssize_t n = ::pread(file_->fd(), output->beginWrite(), remaining, offset);
+      if (n <= 0)
+      {
+        LOG_SYSERR << "HttpResponse::appendToBuffer pread";
+        break;
+      }
+      output->hasWritten(n);
+      offset += n;
+      remaining -= static_cast<size_t>(n);
+    }
+  }
+  else if (!chunkWriter_ || closeDelimited_)
+  {
+    output->append(body());
+  }
+  else if (!body().empty())
+  {
+    appendChunk(output, body());
+  }
+}
+
+void HttpResponse::appendChunk(Buffer* output, StringPiece data)
+{
+  char buf[32];
+  snprintf(buf, sizeof buf, "%x\r\n", static_cast<unsigned>(data.size()));
+  output->append(buf);
+  output->append(data);
+  output->append("\r\n");
 }
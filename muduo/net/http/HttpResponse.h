@@ -12,9 +12,17 @@
 #define MUDUO_NET_HTTP_HTTPRESPONSE_H
 
 #include "muduo/base/copyable.h"
+#include "muduo/base/noncopyable.h"
+#include "muduo/base/StringPiece.h"
+#include "muduo/base/Timestamp.h"
 #include "muduo/base/Types.h"
 
-#include <map>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <sys/types.h>  // off_t
+#include <time.h>
 
 namespace muduo
 {
@@ -29,20 +37,64 @@ class HttpResponse : public muduo::copyable
   {
     kUnknown,
     k200Ok = 200,
+    k204NoContent = 204,
+    k206PartialContent = 206,
     k301MovedPermanently = 301,
+    k302Found = 302,
+    k304NotModified = 304,
     k400BadRequest = 400,
+    k403Forbidden = 403,
     k404NotFound = 404,
+    k405MethodNotAllowed = 405,
+    k413PayloadTooLarge = 413,
+    k416RangeNotSatisfiable = 416,
+    k500InternalServerError = 500,
+    k503ServiceUnavailable = 503,
+  };
+
+  struct Header
+  {
+    string field;
+    string value;
+  };
+
+  /// Appends the next piece of the body to the Buffer, at least a byte,
+  /// returns false after the last piece.
+  typedef std::function<bool (Buffer* piece)> ChunkWriter;
+
+  /// An open file, closed when the last holder is gone.
+  class File : noncopyable
+  {
+   public:
+    explicit File(int fd)
+      : fd_(fd)
+    {
+    }
+    ~File();
+
+    int fd() const { return fd_; }
+
+   private:
+    const int fd_;
   };
+  typedef std::shared_ptr<const File> FilePtr;
 
   explicit HttpResponse(bool close)
     : statusCode_(kUnknown),
-      closeConnection_(close)
+      closeConnection_(close),
+      closeDelimited_(false),
+      fileOffset_(0),
+      fileLength_(0)
   {
   }
 
   void setStatusCode(HttpStatusCode code)
   { statusCode_ = code; }
 
+  HttpStatusCode statusCode() const
+  { return statusCode_; }
+
+  /// The standard reason phrase if not set.
   void setStatusMessage(const string& message)
   { statusMessage_ = message; }
 
@@ -52,25 +104,104 @@ class HttpResponse : public muduo::copyable
   bool closeConnection() const
   { return closeConnection_; }
 
-  void setContentType(const string& contentType)
+  void setContentType(StringPiece contentType)
   { addHeader("Content-Type", contentType); }
 
-  // FIXME: replace string with StringPiece
-  void addHeader(const string& key, const string& value)
-  { headers_[key] = value; }
+  /// Replaces the value of a header of the same field, case insensitive.
+  void addHeader(StringPiece field, StringPiece value);
+
+  /// In the order added.
+  const std::vector<Header>& headers() const
+  { return headers_; }
+
+  /// Header lines serialized beforehand, each ending with CRLF, written
+  /// after the others without copying.
+  void setRawHeaders(const std::shared_ptr<const string>& lines)
+  { rawHeaders_ = lines; }
+
+  const std::shared_ptr<const string>& rawHeaders() const
+  { return rawHeaders_; }
 
   void setBody(const string& body)
   { body_ = body; }
 
+  /// Instead of setBody(), without copying, for content kept elsewhere.
+  void setSharedBody(const std::shared_ptr<const string>& body)
+  { sharedBody_ = body; }
+
+  const std::shared_ptr<const string>& sharedBody() const
+  { return sharedBody_; }
+
+  StringPiece body() const
+  { return sharedBody_ ? StringPiece(*sharedBody_) : StringPiece(body_); }
+
+  /// Instead of the body, length bytes of file from offset, which HttpServer
+  /// sends with sendfile(2), holding the file open till then.
+  void setFileBody(const FilePtr& file, off_t offset, size_t length)
+  {
+    file_ = file;
+    fileOffset_ = offset;
+    fileLength_ = length;
+  }
+
+  const FilePtr& file() const
+  { return file_; }
+
+  off_t fileOffset() const
+  { return fileOffset_; }
+
+  size_t fileLength() const
+  { return fileLength_; }
+
+  /// Sends the body with chunked transfer encoding, the one set by setBody()
+  /// first, then what the writer gives each time the output buffer drains,
+  /// so a large body never sits in memory whole.
+  void setChunkWriter(const ChunkWriter& writer)
+  { chunkWriter_ = writer; }
+
+  const ChunkWriter& chunkWriter() const
+  { return chunkWriter_; }
+
+  /// For HTTP/1.0 clients, which know no chunks: the body and the pieces
+  /// from the ChunkWriter are sent as they are, and closing the connection
+  /// ends the body.
+  void setCloseDelimited()
+  {
+    closeDelimited_ = true;
+    closeConnection_ = true;
+  }
+
+  bool closeDelimited() const
+  { return closeDelimited_; }
+
+  /// Without the last chunk if chunked, which HttpServer adds after the
+  /// writer is done.  A file body is read into output.
   void appendToBuffer(Buffer* output) const;
 
+  /// The status line and headers, with a Date header if now is valid,
+  /// but not the body, so that the caller may send body() by reference.
+  void appendHeadToBuffer(Buffer* output, Timestamp now = Timestamp()) const;
+
+  /// Appends data as one chunk, empty data as the last chunk.
+  static void appendChunk(Buffer* output, StringPiece data);
+
+  /// "Sun, 06 Nov 1994 08:49:37 GMT"
+  static string formatDate(time_t seconds);
+
  private:
-  std::map<string, string> headers_;
+  std::vector<Header> headers_;
   HttpStatusCode statusCode_;
   // FIXME: add http version
   string statusMessage_;
   bool closeConnection_;
+  bool closeDelimited_;
   string body_;
+  std::shared_ptr<const string> sharedBody_;
+  std::shared_ptr<const string> rawHeaders_;
+  ChunkWriter chunkWriter_;
+  FilePtr file_;
+  off_t fileOffset_;
+  size_t fileLength_;
 };
 
 }  // namespace net
@@ -0,0 +1,294 @@
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+//
+
+#include "muduo/net/http/HttpRouter.h"
+
+#include "muduo/base/Logging.h"
+#include "muduo/net/http/HttpResponse.h"
+
+#include <algorithm>
+
+#include <string.h>
+
+using namespace muduo;
+using namespace muduo::net;
+
+namespace
+{
+
+const int kMethods = HttpRequest::kDelete + 1;
+
+const char* const kMethodNames[kMethods] =
+{
+  "", "GET", "POST", "HEAD", "PUT", "DELETE"
+};
+
+// a parameter or wildcard starts a segment
+bool isParamStart(const char* p, const char* begin)
+{
+  return (*p == ':' || *p == '*') && p > begin && p[-1] == '/';
+}
+
+}  // namespace
+
+struct HttpRouter::Node
+{
+  string prefix;      // static text, empty at the root, a parameter or wildcard
+  string indices;     // the first bytes of children
+  std::vector<std::unique_ptr<Node>> children;
+  std::unique_ptr<Node> param;     // ":name", one segment
+  std::unique_ptr<Node> wildcard;  // "*name", the rest
+  string name;        // of the parameter or wildcard
+  Handler handlers[kMethods];      // kInvalid for any method
+};
+
+namespace
+{
+
+// the node at the end of s under node, splitting nodes on the way
+template<typename Node>
+Node* insertStatic(Node* node, StringPiece s)
+{
+  while (!s.empty())
+  {
+    size_t i = node->indices.find(s[0]);
+    if (i == string::npos)
+    {
+      Node* child = new Node;
+      child->prefix = s.as_string();
+      node->indices += s[0];
+      node->children.emplace_back(child);
+      return child;
+    }
+
+    Node* child = node->children[i].get();
+    size_t common = 0;
+    size_t limit = std::min(child->prefix.size(), static_cast<size_t>(s.size()));
+    while (common < limit && child->prefix[common] == s[static_cast<int>(common)])
+    {
+      ++common;
+    }
+    if (common < child->prefix.size())
+    {
+      // child keeps what follows the common part
+      Node* middle = new Node;
+      middle->prefix = child->prefix.substr(0, common);
+      child->prefix.erase(0, common);
+      middle->indices = child->prefix[0];
+      middle->children.push_back(std::move(node->children[i]));
+      node->children[i].reset(middle);
+      child = middle;
+    }
+    s.remove_prefix(static_cast<int>(common));
+    node = child;
+  }
+  return node;
+}
+
+}  // namespace
+
+HttpRouter::HttpRouter()
+  : root_(new Node)
+{
+}
+
+HttpRouter::~HttpRouter() = default;
+
+void HttpRouter::add(HttpRequest::Method method, StringPiece pattern, const Handler& handler)
+{
+  if (pattern.empty() || pattern[0] != '/')
+  {
+    LOG_FATAL << "HttpRouter::add pattern must start with '/': " << pattern.as_string();
+  }
+  Node* node = root_.get();
+  int params = 0;
+  const char* p = pattern.begin();
+  const char* end = pattern.end();
+  while (p < end)
+  {
+    if (isParamStart(p, pattern.begin()))
+    {
+      bool wildcard = *p == '*';
+      const char* nameEnd = static_cast<const char*>(memchr(p, '/', end - p));
+      if (nameEnd == NULL)
+      {
+        nameEnd = end;
+      }
+      string name(p + 1, nameEnd);
+      if (name.empty() || ++params > Params::kMaxParams || (wildcard && nameEnd != end))
+      {
+        LOG_FATAL << "HttpRouter::add bad parameter in " << pattern.as_string();
+      }
+      std::unique_ptr<Node>& child = wildcard ? node->wildcard : node->param;
+      if (!child)
+      {
+        child.reset(new Node);
+        child->name = name;
+      }
+      else if (child->name != name)
+      {
+        LOG_FATAL << "HttpRouter::add " << pattern.as_string()
+                  << " conflicts with parameter " << child->name;
+      }
+      node = child.get();
+      p = nameEnd;
+    }
+    else
+    {
+      const char* staticEnd = p + 1;
+      while (staticEnd < end && !isParamStart(staticEnd, pattern.begin()))
+      {
+        ++staticEnd;
+      }
+      node = insertStatic(node, StringPiece(p, static_cast<int>(staticEnd - p)));
+      p = staticEnd;
+    }
+  }
+
+  if (node->handlers[method])
+  {
+    LOG_FATAL << "HttpRouter::add " << kMethodNames[method] << " "
+              << pattern.as_string() << " twice";
+  }
+  node->handlers[method] = handler;
+}
+
+const HttpRouter::Handler* HttpRouter::handlerOf(const Node* node, int method)
+{
+  if (method < 0)
+  {
+    for (const Handler& handler : node->handlers)
+    {
+      if (handler)
+      {
+        return &handler;
+      }
+    }
+    return NULL;
+  }
+  if (node->handlers[method])
+  {
+    return &node->handlers[method];
+  }
+  // HttpServer sends the head only
+  if (method == HttpRequest::kHead && node->handlers[HttpRequest::kGet])
+  {
+    return &node->handlers[HttpRequest::kGet];
+  }
+  return node->handlers[HttpRequest::kInvalid] ? &node->handlers[HttpRequest::kInvalid] : NULL;
+}
+
+const HttpRouter::Node* HttpRouter::matchNode(const Node* node, int method,
+                                              const char* path, const char* end,
+                                              Params* params)
+{
+  if (path == end)
+  {
+    if (handlerOf(node, method))
+    {
+      return node;
+    }
+  }
+  else
+  {
+    // static text first, one child at most begins with the byte
+    size_t i = node->indices.find(*path);
+    if (i != string::npos)
+    {
+      const Node* child = node->children[i].get();
+      size_t len = child->prefix.size();
+      if (static_cast<size_t>(end - path) >= len &&
+          memcmp(path, child->prefix.data(), len) == 0)
+      {
+        if (const Node* found = matchNode(child, method, path + len, end, params))
+        {
+          return found;
+        }
+      }
+    }
+
+    // then a parameter
+    if (node->param)
+    {
+      const char* segmentEnd = static_cast<const char*>(memchr(path, '/', end - path));
+      if (segmentEnd == NULL)
+      {
+        segmentEnd = end;
+      }
+      if (segmentEnd > path)
+      {
+        int saved = params->size_;
+        Params::Param& param = params->params_[params->size_++];
+        param.name = node->param->name;
+        param.value.set(path, static_cast<int>(segmentEnd - path));
+        if (const Node* found = matchNode(node->param.get(), method, segmentEnd, end, params))
+        {
+          return found;
+        }
+        params->size_ = saved;
+      }
+    }
+  }
+
+  // then a wildcard, for the rest, empty or not
+  if (node->wildcard && handlerOf(node->wildcard.get(), method))
+  {
+    Params::Param& param = params->params_[params->size_++];
+    param.name = node->wildcard->name;
+    param.value.set(path, static_cast<int>(end - path));
+    return node->wildcard.get();
+  }
+  return NULL;
+}
+
+const HttpRouter::Handler* HttpRouter::match(HttpRequest::Method method,
+                                             StringPiece path,
+                                             Params* params) const
+{
+  params->size_ = 0;
+  const Node* node = matchNode(root_.get(), method, path.begin(), path.end(), params);
+  return node ? handlerOf(node, method) : NULL;
+}
+
+void HttpRouter::route(const HttpRequest& req, HttpResponse* resp) const
+{
+  Params params;
+  const Handler* handler = match(req.method(), req.path(), &params);
+  if (handler)
+  {
+    (*handler)(req, params, resp);
+    return;
+  }
+
+  params.size_ = 0;
+  const Node* node = matchNode(root_.get(), -1, req.path().begin(), req.path().end(), &params);
+  if (node)
+  {
+    string allow;
+    for (int method = 1; method < kMethods; ++method)
+    {
+      if (node->handlers[method])
+      {
+        if (!allow.empty())
+        {
+          allow += ", ";
+        }
+        allow += kMethodNames[method];
+      }
+    }
+    resp->setStatusCode(HttpResponse::k405MethodNotAllowed);
+    resp->addHeader("Allow", allow);
+  }
+  else if (notFound_)
+  {
+    params.size_ = 0;
+    notFound_(req, params, resp);
+  }
+  else
+  {
+    resp->setStatusCode(HttpResponse::k404NotFound);
+  }
+}
@@ -0,0 +1,125 @@
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+//
+// This is a public header file, it must only include public header files.
+
+#ifndef MUDUO_NET_HTTP_HTTPROUTER_H
+#define MUDUO_NET_HTTP_HTTPROUTER_H
+
+#include "muduo/base/noncopyable.h"
+#include "muduo/base/StringPiece.h"
+#include "muduo/net/http/HttpRequest.h"
+
+#include <functional>
+#include <memory>
+
+namespace muduo
+{
+namespace net
+{
+
+class HttpResponse;
+
+/// Routes requests to handlers by method and path, with a compressed
+/// prefix trie.
+///
+/// A pattern is made of static text, ":name" matching one non-empty path
+/// segment, and a last "*name" matching the rest of the path, possibly
+/// empty.  Static text wins over a parameter, which wins over a wildcard.
+///
+///   HttpRouter router;
+///   router.add(HttpRequest::kGet, "/users/:id", getUser);
+///   router.add(HttpRequest::kGet, "/files/*path", getFile);
+///   server.setHttpCallback(
+///       std::bind(&HttpRouter::route, &router, _1, _2));
+///
+/// Routes are added before the HttpServer starts, after which matching is
+/// thread safe and allocates nothing.
+class HttpRouter : noncopyable
+{
+ public:
+  /// Values captured by a match, pointing into the request path.
+  class Params
+  {
+   public:
+    static const int kMaxParams = 8;
+
+    Params()
+      : size_(0)
+    {
+    }
+
+    /// Empty if there is none of the name.
+    StringPiece get(StringPiece name) const
+    {
+      for (int i = 0; i < size_; ++i)
+      {
+        if (params_[i].name == name)
+        {
+          return params_[i].value;
+        }
+      }
+      return StringPiece();
+    }
+
+    int size() const { return size_; }
+    StringPiece name(int i) const { return params_[i].name; }
+    StringPiece value(int i) const { return params_[i].value; }
+
+   private:
+    friend class HttpRouter;
+    struct Param
+    {
+      StringPiece name;
+      StringPiece value;
+    };
+    Param params_[kMaxParams];
+    int size_;
+  };
+
+  typedef std::function<void (const HttpRequest&,
+                              const Params&,
+                              HttpResponse*)> Handler;
+
+  HttpRouter();
+  ~HttpRouter();
+
+  /// Not thread safe, before serving.
+  /// Dies on a pattern that is malformed or taken by the same method.
+  void add(HttpRequest::Method method, StringPiece pattern, const Handler& handler);
+
+  /// For every method, after those added for the method.
+  void add(StringPiece pattern, const Handler& handler)
+  { add(HttpRequest::kInvalid, pattern, handler); }
+
+  /// Called when no pattern matches the path, 404 by default.
+  void setNotFound(const Handler& handler)
+  { notFound_ = handler; }
+
+  /// The handler for method and path, filling params, or NULL.
+  const Handler* match(HttpRequest::Method method,
+                       StringPiece path,
+                       Params* params) const;
+
+  /// An HttpCallback, 405 if the path matches with other methods only.
+  void route(const HttpRequest& req, HttpResponse* resp) const;
+
+ private:
+  struct Node;
+
+  // method < 0 for any
+  static const Handler* handlerOf(const Node* node, int method);
+  static const Node* matchNode(const Node* node, int method,
+                               const char* path, const char* end,
+                               Params* params);
+
+  std::unique_ptr<Node> root_;
+  Handler notFound_;
+};
+
+}  // namespace net
+}  // namespace muduo
+
+#endif  // MUDUO_NET_HTTP_HTTPROUTER_H
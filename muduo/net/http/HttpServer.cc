@@ -10,10 +10,13 @@
 #include "muduo/net/http/HttpServer.h"
 
 #include "muduo/base/Logging.h"
+#include "muduo/net/http/HttpCompressor.h"
 #include "muduo/net/http/HttpContext.h"
 #include "muduo/net/http/HttpRequest.h"
 #include "muduo/net/http/HttpResponse.h"
 
+#include <algorithm>
+
 using namespace muduo;
 using namespace muduo::net;
 
@@ -35,12 +38,33 @@ void defaultHttpCallback(const HttpRequest&, HttpResponse* resp)
 }  // namespace net
 }  // namespace muduo
 
+namespace
+{
+const ContextSlot<HttpContext> kHttpContextSlot =
+    ConnectionContexts::registerSlot<HttpContext>();
+// RpcServer and CoroStream keep a shared_ptr each, all three are inline
+// whichever registers first
+static_assert(sizeof(HttpContext) + 2 * sizeof(std::shared_ptr<void>) <=
+              ConnectionContexts::kInlineSize,
+              "HttpContext leaves no room inline for the RPC and coroutine slots");
+
+// larger bodies are not copied into the output buffer
+const size_t kBodyByReference = 4096;
+
+const size_t kDefaultCompressMinSize = 1024;
+// of gzipped shared bodies
+const size_t kMaxCompressCachedBytes = 16 * 1024 * 1024;
+}  // namespace
+
 HttpServer::HttpServer(EventLoop* loop,
                        const InetAddress& listenAddr,
                        const string& name,
                        TcpServer::Option option)
   : server_(loop, listenAddr, name, option),
-    httpCallback_(detail::defaultHttpCallback)
+    httpCallback_(detail::defaultHttpCallback),
+    maxBodySize_(HttpContext::kDefaultMaxBodySize),
+    compressLevel_(0),
+    compressMinSize_(kDefaultCompressMinSize)
 {
   server_.setConnectionCallback(
       std::bind(&HttpServer::onConnection, this, _1));
@@ -48,8 +72,20 @@ HttpServer::HttpServer(EventLoop* loop,
       std::bind(&HttpServer::onMessage, this, _1, _2, _3));
 }
 
+HttpServer::~HttpServer() = default;
+
 void HttpServer::start()
 {
+  if (compressLevel_ > 0)
+  {
+#ifdef HAVE_ZLIB
+    compressor_.reset(new HttpCompressor(std::min(compressLevel_, 9),
+                                         compressMinSize_,
+                                         kMaxCompressCachedBytes));
+#else
+    LOG_ERROR << "HttpServer[" << server_.name() << "] built without zlib, no compression";
+#endif
+  }
   LOG_WARN << "HttpServer[" << server_.name()
     << "] starts listenning on " << server_.ipPort();
   server_.start();
@@ -59,7 +95,8 @@ void HttpServer::onConnection(const TcpConnectionPtr& conn)
 {
   if (conn->connected())
   {
-    conn->setContext(HttpContext());
+    HttpContext* context = conn->emplaceContext(kHttpContextSlot);
+    context->setMaxBodySize(maxBodySize_);
   }
 }
 
@@ -67,34 +104,171 @@ void HttpServer::onMessage(const TcpConnectionPtr& conn,
                            Buffer* buf,
                            Timestamp receiveTime)
 {
-  HttpContext* context = boost::any_cast<HttpContext>(conn->getMutableContext());
+  HttpContext* context = conn->context(kHttpContextSlot);
+  if (context->responding())
+  {
+    // after the chunked or file response
+    return;
+  }
+  if (!conn->connected())
+  {
+    // shutting down after a response with Connection: close
+    buf->retrieveAll();
+    return;
+  }
 
-  if (!context->parseRequest(buf, receiveTime))
+  // Handles every complete request in buf, pipelined ones included, and
+  // serializes their responses straight into the output buffer, which is
+  // sent with one write at the end.
+  Buffer* output = conn->outputBuffer();
+  bool close = false;
+  while (!close && !context->responding())
   {
-    conn->send("HTTP/1.1 400 Bad Request\r\n\r\n");
-    conn->shutdown();
+    if (!context->parseRequest(buf, receiveTime, httpBodyCallback_))
+    {
+      output->append(context->bodyTooLarge() ?
+                     "HTTP/1.1 413 Payload Too Large\r\n\r\n" :
+                     "HTTP/1.1 400 Bad Request\r\n\r\n");
+      buf->retrieveAll();
+      context->reset();
+      close = true;
+    }
+    else if (context->gotAll())
+    {
+      // the request points into buf until retrieved
+      close = onRequest(conn, context->request(), receiveTime);
+      context->retrieveRequest(buf);
+    }
+    else
+    {
+      if (context->takeExpectContinue())
+      {
+        output->append("HTTP/1.1 100 Continue\r\n\r\n");
+      }
+      break;
+    }
   }
 
-  if (context->gotAll())
+  conn->sendOutputBuffer();
+  if (close && !context->responding())
   {
-    onRequest(conn, context->request());
-    context->reset();
+    conn->shutdown();
   }
 }
 
-void HttpServer::onRequest(const TcpConnectionPtr& conn, const HttpRequest& req)
+bool HttpServer::onRequest(const TcpConnectionPtr& conn,
+                           const HttpRequest& req,
+                           Timestamp receiveTime)
 {
-  const string& connection = req.getHeader("Connection");
+  StringPiece connection = req.getHeader("Connection");
   bool close = connection == "close" ||
     (req.getVersion() == HttpRequest::kHttp10 && connection != "Keep-Alive");
   HttpResponse response(close);
   httpCallback_(req, &response);
-  Buffer buf;
-  response.appendToBuffer(&buf);
-  conn->send(&buf);
-  if (response.closeConnection())
+  if (response.chunkWriter() && req.getVersion() == HttpRequest::kHttp10)
   {
-    conn->shutdown();
+    response.setCloseDelimited();
+  }
+  close = response.closeConnection();
+#ifdef HAVE_ZLIB
+  if (compressor_)
+  {
+    compressor_->compress(req, &response, receiveTime);
+  }
+#endif
+
+  Buffer* output = conn->outputBuffer();
+  response.appendHeadToBuffer(output, receiveTime);
+  if (req.method() == HttpRequest::kHead)
+  {
+    return close;
+  }
+
+  StringPiece body = response.body();
+  if (response.file())
+  {
+    // the rest of the batch waits, the callback holds the file open
+    conn->context(kHttpContextSlot)->setResponding(true);
+    HttpResponse::FilePtr file = response.file();
+    conn->setWriteCompleteCallback([this, file, close](const TcpConnectionPtr& c)
+    {
+      finishResponse(c, close);
+    });
+    conn->sendFile(file->fd(), response.fileOffset(), response.fileLength());
+  }
+  else if (response.chunkWriter())
+  {
+    bool chunked = !response.closeDelimited();
+    if (!chunked)
+    {
+      output->append(body);
+    }
+    else if (!body.empty())
+    {
+      HttpResponse::appendChunk(output, body);
+    }
+    // the rest of the body each time the output drains
+    conn->context(kHttpContextSlot)->setResponding(true);
+    conn->setWriteCompleteCallback(
+        std::bind(&HttpServer::onWriteComplete, this, _1, response.chunkWriter(), chunked, close));
+  }
+  else if (static_cast<size_t>(body.size()) >= kBodyByReference)
+  {
+    // with the head in one writev, copied only if the socket is full
+    conn->sendOutputBuffer(body);
+  }
+  else
+  {
+    output->append(body);
+  }
+  return close;
+}
+
+void HttpServer::onWriteComplete(const TcpConnectionPtr& conn,
+                                 const HttpResponse::ChunkWriter& chunkWriter,
+                                 bool chunked,
+                                 bool close)
+{
+  Buffer piece;
+  bool more = chunkWriter(&piece);
+  Buffer* output = conn->outputBuffer();
+  if (!chunked)
+  {
+    output->append(piece.peek(), piece.readableBytes());
+  }
+  else if (piece.readableBytes() > 0)
+  {
+    HttpResponse::appendChunk(output, piece.toStringPiece());
+  }
+  if (!more)
+  {
+    if (chunked)
+    {
+      HttpResponse::appendChunk(output, StringPiece());
+    }
+    // not to be called again by the write below
+    conn->setWriteCompleteCallback(WriteCompleteCallback());
+  }
+  conn->sendOutputBuffer();
+
+  if (!more)
+  {
+    finishResponse(conn, close);
   }
 }
 
+void HttpServer::finishResponse(const TcpConnectionPtr& conn, bool close)
+{
+  // the callback being run is a copy
+  conn->setWriteCompleteCallback(WriteCompleteCallback());
+  conn->context(kHttpContextSlot)->setResponding(false);
+  if (close)
+  {
+    conn->shutdown();
+  }
+  else if (conn->inputBuffer()->readableBytes() > 0)
+  {
+    // requests that came during the response
+    onMessage(conn, conn->inputBuffer(), Timestamp::now());
+  }
+}
@@ -18,6 +18,7 @@ namespace muduo
 namespace net
 {
 
+class HttpCompressor;
 class HttpRequest;
 class HttpResponse;
 
@@ -30,11 +31,14 @@ class HttpServer : noncopyable
  public:
   typedef std::function<void (const HttpRequest&,
                               HttpResponse*)> HttpCallback;
+  typedef std::function<void (const HttpRequest&,
+                              StringPiece data)> HttpBodyCallback;
 
   HttpServer(EventLoop* loop,
              const InetAddress& listenAddr,
              const string& name,
              TcpServer::Option option = TcpServer::kNoReusePort);
+  ~HttpServer();
 
   EventLoop* getLoop() const { return server_.getLoop(); }
 
@@ -44,6 +48,38 @@ class HttpServer : noncopyable
     httpCallback_ = cb;
   }
 
+  /// Not thread safe, callback be registered before calling start().
+  /// Request bodies are passed to it piece by piece as they arrive, of any
+  /// size, then the HttpCallback is called with an empty body().  Without it,
+  /// bodies are kept whole for HttpRequest::body().
+  void setHttpBodyCallback(const HttpBodyCallback& cb)
+  {
+    httpBodyCallback_ = cb;
+  }
+
+  /// Must be called before @c start.
+  /// Larger bodies kept for HttpRequest::body() get 413, default 1 MiB.
+  void setMaxBodySize(size_t maxBodySize)
+  {
+    maxBodySize_ = maxBodySize;
+  }
+
+  /// Must be called before @c start.
+  /// Compresses text, JSON, JavaScript and XML bodies with gzip for clients
+  /// that accept it, at the level from 1 to 9 while the loop keeps up, and
+  /// lower while it lags behind.  0 for none, the default.
+  void setCompression(int level)
+  {
+    compressLevel_ = level;
+  }
+
+  /// Must be called before @c start.
+  /// Smaller bodies are not worth compressing, default 1 KiB.
+  void setCompressMinSize(size_t minSize)
+  {
+    compressMinSize_ = minSize;
+  }
+
   void setThreadNum(int numThreads)
   {
     server_.setThreadNum(numThreads);
@@ -56,10 +92,24 @@ class HttpServer : noncopyable
   void onMessage(const TcpConnectionPtr& conn,
                  Buffer* buf,
                  Timestamp receiveTime);
-  void onRequest(const TcpConnectionPtr&, const HttpRequest&);
+  // returns true if the connection should be closed after the response
+  bool onRequest(const TcpConnectionPtr& conn,
+                 const HttpRequest&,
+                 Timestamp receiveTime);
+  void onWriteComplete(const TcpConnectionPtr& conn,
+                       const std::function<bool (Buffer*)>& chunkWriter,
+                       bool chunked,
+                       bool close);
+  // after a chunked or file response, goes on with the requests behind it
+  void finishResponse(const TcpConnectionPtr& conn, bool close);
 
   TcpServer server_;
   HttpCallback httpCallback_;
+  HttpBodyCallback httpBodyCallback_;
+  size_t maxBodySize_;
+  int compressLevel_;
+  size_t compressMinSize_;
+  std::unique_ptr<HttpCompressor> compressor_;
 };
 
 }  // namespace net
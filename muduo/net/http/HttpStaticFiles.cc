@@ -0,0 +1,481 @@
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+//
+
+#include "muduo/net/http/HttpStaticFiles.h"
+
+#include "muduo/base/Logging.h"
+#include "muduo/net/http/HttpRequest.h"
+#include "muduo/net/http/HttpResponse.h"
+
+#include <algorithm>
+
+#include <ctype.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace muduo;
+using namespace muduo::net;
+
+struct HttpStaticFiles::Entry
+{
+  HttpResponse::FilePtr file;  // larger files
+  string content;              // or the content of small ones
+  string headers;              // Content-Type, Last-Modified, ETag, Accept-Ranges
+  string etag;
+  off_t size;
+  dev_t dev;
+  ino_t ino;
+  struct timespec mtime;
+};
+
+namespace
+{
+
+const char* contentType(StringPiece filename)
+{
+  static const struct { const char* ext; const char* type; } kTypes[] = {
+    { ".html", "text/html; charset=utf-8" },
+    { ".htm", "text/html; charset=utf-8" },
+    { ".css", "text/css" },
+    { ".js", "application/javascript" },
+    { ".json", "application/json" },
+    { ".txt", "text/plain; charset=utf-8" },
+    { ".xml", "application/xml" },
+    { ".png", "image/png" },
+    { ".jpg", "image/jpeg" },
+    { ".jpeg", "image/jpeg" },
+    { ".gif", "image/gif" },
+    { ".svg", "image/svg+xml" },
+    { ".ico", "image/x-icon" },
+    { ".pdf", "application/pdf" },
+    { ".wasm", "application/wasm" },
+  };
+  for (const auto& t : kTypes)
+  {
+    int len = static_cast<int>(strlen(t.ext));
+    if (filename.size() > len &&
+        ::strncasecmp(filename.end() - len, t.ext, len) == 0)
+    {
+      return t.type;
+    }
+  }
+  return "application/octet-stream";
+}
+
+bool sameFile(const struct stat& st, off_t size, dev_t dev, ino_t ino,
+              const struct timespec& mtime)
+{
+  return st.st_size == size && st.st_dev == dev && st.st_ino == ino &&
+         st.st_mtim.tv_sec == mtime.tv_sec && st.st_mtim.tv_nsec == mtime.tv_nsec;
+}
+
+int hexValue(char c)
+{
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+enum RangeResult { kWhole, kPartial, kUnsatisfiable };
+
+// a single range of "bytes=first-last", "bytes=first-" or "bytes=-suffix",
+// others are ignored and the whole file is sent
+RangeResult parseRange(StringPiece range, off_t size, off_t* offset, off_t* length)
+{
+  if (!range.starts_with("bytes="))
+  {
+    return kWhole;
+  }
+  range.remove_prefix(6);
+  const char* p = range.begin();
+  const char* end = range.end();
+  bool hasFirst = false, hasLast = false;
+  off_t first = 0, last = 0;
+  const off_t kMax = (static_cast<off_t>(1) << 62) / 10;
+  for (; p < end && isdigit(*p) && first < kMax; ++p)
+  {
+    first = first * 10 + (*p - '0');
+    hasFirst = true;
+  }
+  if (p == end || *p != '-')
+  {
+    return kWhole;
+  }
+  for (++p; p < end && isdigit(*p) && last < kMax; ++p)
+  {
+    last = last * 10 + (*p - '0');
+    hasLast = true;
+  }
+  if (p != end || (!hasFirst && !hasLast) || (hasFirst && hasLast && first > last))
+  {
+    // several ranges or garbage
+    return kWhole;
+  }
+
+  if (!hasFirst)
+  {
+    // the last bytes
+    if (last == 0)
+    {
+      return kUnsatisfiable;
+    }
+    first = last < size ? size - last : 0;
+    last = size - 1;
+  }
+  else if (!hasLast || last >= size)
+  {
+    last = size - 1;
+  }
+  if (first >= size)
+  {
+    return kUnsatisfiable;
+  }
+  *offset = first;
+  *length = last - first + 1;
+  return kPartial;
+}
+
+// If-None-Match: "etag1", W/"etag2" or *
+bool etagMatches(StringPiece ifNoneMatch, const string& etag)
+{
+  if (ifNoneMatch == "*")
+  {
+    return true;
+  }
+  const char* found = std::search(ifNoneMatch.begin(), ifNoneMatch.end(),
+                                  etag.begin(), etag.end());
+  return found != ifNoneMatch.end();
+}
+
+}  // namespace
+
+HttpStaticFiles::HttpStaticFiles(const string& root, const string& prefix)
+  : root_(root),
+    prefix_(prefix),
+    maxOpenFiles_(1024),
+    maxCachedFileSize_(64 * 1024),
+    maxCachedBytes_(32 * 1024 * 1024),
+    validSeconds_(1.0),
+    cachedBytes_(0),
+    openedFiles_(0)
+{
+}
+
+HttpStaticFiles::~HttpStaticFiles() = default;
+
+bool HttpStaticFiles::serve(const HttpRequest& req, HttpResponse* resp)
+{
+  if (req.method() != HttpRequest::kGet && req.method() != HttpRequest::kHead)
+  {
+    return false;
+  }
+  string filename;
+  if (!resolve(req.path(), &filename))
+  {
+    return false;
+  }
+  Timestamp now = req.receiveTime().valid() ? req.receiveTime() : Timestamp::now();
+  EntryPtr entry = lookup(filename, now);
+  if (!entry)
+  {
+    return false;
+  }
+
+  // shares the entry, not a copy
+  resp->setRawHeaders(std::shared_ptr<const string>(entry, &entry->headers));
+  StringPiece ifNoneMatch = req.getHeader("If-None-Match");
+  if (!ifNoneMatch.empty() && etagMatches(ifNoneMatch, entry->etag))
+  {
+    resp->setStatusCode(HttpResponse::k304NotModified);
+    return true;
+  }
+
+  off_t offset = 0;
+  off_t length = entry->size;
+  StringPiece range = req.getHeader("Range");
+  RangeResult result = range.empty() ? kWhole :
+                       parseRange(range, entry->size, &offset, &length);
+  char buf[96];
+  if (result == kUnsatisfiable)
+  {
+    resp->setStatusCode(HttpResponse::k416RangeNotSatisfiable);
+    snprintf(buf, sizeof buf, "bytes */%jd", static_cast<intmax_t>(entry->size));
+    resp->addHeader("Content-Range", buf);
+    return true;
+  }
+  else if (result == kPartial)
+  {
+    resp->setStatusCode(HttpResponse::k206PartialContent);
+    snprintf(buf, sizeof buf, "bytes %jd-%jd/%jd",
+             static_cast<intmax_t>(offset),
+             static_cast<intmax_t>(offset + length - 1),
+             static_cast<intmax_t>(entry->size));
+    resp->addHeader("Content-Range", buf);
+  }
+  else
+  {
+    resp->setStatusCode(HttpResponse::k200Ok);
+  }
+
+  if (entry->file)
+  {
+    resp->setFileBody(entry->file, offset, static_cast<size_t>(length));
+  }
+  else if (result == kPartial)
+  {
+    resp->setBody(entry->content.substr(static_cast<size_t>(offset),
+                                        static_cast<size_t>(length)));
+  }
+  else
+  {
+    resp->setSharedBody(std::shared_ptr<const string>(entry, &entry->content));
+  }
+  return true;
+}
+
+// url path to a file name under root_, without "..", hidden files, nor NUL
+bool HttpStaticFiles::resolve(StringPiece path, string* filename) const
+{
+  if (!path.starts_with(prefix_))
+  {
+    return false;
+  }
+  path.remove_prefix(static_cast<int>(prefix_.size()));
+
+  string decoded;
+  decoded.reserve(path.size());
+  for (const char* p = path.begin(); p < path.end(); ++p)
+  {
+    char c = *p;
+    if (c == '%' && path.end() - p >= 3 && hexValue(p[1]) >= 0 && hexValue(p[2]) >= 0)
+    {
+      c = static_cast<char>(hexValue(p[1]) * 16 + hexValue(p[2]));
+      p += 2;
+    }
+    if (c == '\0')
+    {
+      return false;
+    }
+    decoded += c;
+  }
+
+  // each segment
+  size_t begin = 0;
+  while (begin < decoded.size())
+  {
+    size_t slash = decoded.find('/', begin);
+    if (slash == string::npos)
+    {
+      slash = decoded.size();
+    }
+    if (slash > begin && decoded[begin] == '.')
+    {
+      return false;
+    }
+    begin = slash + 1;
+  }
+
+  filename->assign(root_);
+  filename->push_back('/');
+  filename->append(decoded);
+  if (decoded.empty() || decoded.back() == '/')
+  {
+    filename->append("index.html");
+  }
+  return true;
+}
+
+HttpStaticFiles::EntryPtr HttpStaticFiles::lookup(const string& filename, Timestamp now)
+{
+  bool cached = false;
+  {
+    ReadLockGuard lock(rwlock_);
+    auto it = index_.find(filename);
+    if (it != index_.end())
+    {
+      // a fresh hit leaves the order alone, no writer needed
+      if (timeDifference(now, it->second->validated) < validSeconds_)
+      {
+        return it->second->entry;
+      }
+      cached = true;
+    }
+  }
+
+  // the order changes once per validSeconds_ at most for a file in use
+  EntryPtr stale;
+  if (cached)
+  {
+    WriteLockGuard lock(rwlock_);
+    auto it = index_.find(filename);
+    if (it != index_.end())
+    {
+      lru_.splice(lru_.begin(), lru_, it->second);
+      stale = it->second->entry;
+    }
+  }
+
+  // out of the lock
+  if (stale)
+  {
+    struct stat st;
+    if (::stat(filename.c_str(), &st) == 0 &&
+        sameFile(st, stale->size, stale->dev, stale->ino, stale->mtime))
+    {
+      WriteLockGuard lock(rwlock_);
+      auto it = index_.find(filename);
+      if (it != index_.end() && it->second->entry == stale)
+      {
+        it->second->validated = now;
+      }
+      return stale;
+    }
+  }
+
+  EntryPtr entry = open(filename);
+  if (entry)
+  {
+    insert(filename, entry, now);
+  }
+  else if (stale)
+  {
+    erase(filename);
+  }
+  return entry;
+}
+
+HttpStaticFiles::EntryPtr HttpStaticFiles::open(const string& filename)
+{
+  int fd = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0)
+  {
+    return EntryPtr();
+  }
+  HttpResponse::FilePtr file(new HttpResponse::File(fd));
+  struct stat st;
+  if (::fstat(fd, &st) != 0 || !S_ISREG(st.st_mode))
+  {
+    return EntryPtr();
+  }
+
+  std::shared_ptr<Entry> entry(new Entry);
+  entry->size = st.st_size;
+  entry->dev = st.st_dev;
+  entry->ino = st.st_ino;
+  entry->mtime = st.st_mtim;
+  if (static_cast<size_t>(st.st_size) <= maxCachedFileSize_)
+  {
+    entry->content.resize(static_cast<size_t>(st.st_size));
+    size_t done = 0;
+    while (done < entry->content.size())
+    {
+      ssize_t n = ::pread(fd, &entry->content[done], entry->content.size() - done,
+                          static_cast<off_t>(done));
+      if (n <= 0)
+      {
+        LOG_SYSERR << "HttpStaticFiles::open read " << filename;
+        return EntryPtr();
+      }
+      done += static_cast<size_t>(n);
+    }
+  }
+  else
+  {
+    entry->file = file;
+  }
+
+  // what sameFile() compares, a rewrite within a second changes tv_nsec
+  char etag[96];
+  snprintf(etag, sizeof etag, "\"%jx-%jx.%lx-%jx\"",
+           static_cast<uintmax_t>(st.st_ino),
+           static_cast<intmax_t>(st.st_mtim.tv_sec),
+           static_cast<unsigned long>(st.st_mtim.tv_nsec),
+           static_cast<intmax_t>(st.st_size));
+  entry->etag = etag;
+  entry->headers = "Content-Type: ";
+  entry->headers += contentType(filename);
+  entry->headers += "\r\nLast-Modified: ";
+  entry->headers += HttpResponse::formatDate(st.st_mtim.tv_sec);
+  entry->headers += "\r\nETag: ";
+  entry->headers += entry->etag;
+  entry->headers += "\r\nAccept-Ranges: bytes\r\n";
+
+  WriteLockGuard lock(rwlock_);
+  ++openedFiles_;
+  return entry;
+}
+
+void HttpStaticFiles::insert(const string& filename, const EntryPtr& entry, Timestamp now)
+{
+  WriteLockGuard lock(rwlock_);
+  auto it = index_.find(filename);
+  if (it != index_.end())
+  {
+    cachedBytes_ -= it->second->entry->content.size();
+    lru_.erase(it->second);
+    index_.erase(it);
+  }
+  Node node = { filename, entry, now };
+  lru_.push_front(node);
+  index_[filename] = lru_.begin();
+  cachedBytes_ += entry->content.size();
+
+  // the least recently validated go, responses being sent hold their own references
+  while (lru_.size() > 1 && lru_.size() > maxOpenFiles_)
+  {
+    cachedBytes_ -= lru_.back().entry->content.size();
+    index_.erase(lru_.back().filename);
+    lru_.pop_back();
+  }
+  // then those in memory till under the budget, open files stay
+  NodeList::iterator last = lru_.end();
+  while (cachedBytes_ > maxCachedBytes_ && --last != lru_.begin())
+  {
+    size_t bytes = last->entry->content.size();
+    if (bytes > 0)
+    {
+      cachedBytes_ -= bytes;
+      index_.erase(last->filename);
+      last = lru_.erase(last);
+    }
+  }
+}
+
+void HttpStaticFiles::erase(const string& filename)
+{
+  WriteLockGuard lock(rwlock_);
+  auto it = index_.find(filename);
+  if (it != index_.end())
+  {
+    cachedBytes_ -= it->second->entry->content.size();
+    lru_.erase(it->second);
+    index_.erase(it);
+  }
+}
+
+size_t HttpStaticFiles::cachedFiles() const
+{
+  ReadLockGuard lock(rwlock_);
+  return lru_.size();
+}
+
+size_t HttpStaticFiles::cachedBytes() const
+{
+  ReadLockGuard lock(rwlock_);
+  return cachedBytes_;
+}
+
+int64_t HttpStaticFiles::openedFiles() const
+{
+  ReadLockGuard lock(rwlock_);
+  return openedFiles_;
+}
@@ -0,0 +1,120 @@
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+//
+// This is a public header file, it must only include public header files.
+
+#ifndef MUDUO_NET_HTTP_HTTPSTATICFILES_H
+#define MUDUO_NET_HTTP_HTTPSTATICFILES_H
+
+#include "muduo/base/noncopyable.h"
+#include "muduo/base/RwLock.h"
+#include "muduo/base/StringPiece.h"
+#include "muduo/base/Timestamp.h"
+#include "muduo/base/Types.h"
+
+#include <list>
+#include <memory>
+#include <unordered_map>
+
+namespace muduo
+{
+namespace net
+{
+
+class HttpRequest;
+class HttpResponse;
+
+/// Serves the files under a document root for HttpServer.
+///
+/// Open files are cached, up to setMaxOpenFiles(), and checked against the
+/// file system at most once per setValidSeconds().  Files up to
+/// setMaxCachedFileSize() are kept in memory instead, up to
+/// setMaxCachedBytes() in all, the least recently validated go first.
+/// Hits within setValidSeconds() only take a shared lock.  Larger files
+/// are sent with sendfile(2).  Every file gets an ETag and
+/// Last-Modified, If-None-Match and single byte ranges are honoured.
+///
+///   HttpStaticFiles files("/var/www");
+///   server.setHttpCallback([&files](const HttpRequest& req, HttpResponse* resp)
+///   {
+///     if (!files.serve(req, resp))
+///     {
+///       ...
+///     }
+///   });
+class HttpStaticFiles : noncopyable
+{
+ public:
+  /// Serves url prefix + path with root + "/" + path, index.html for
+  /// directories ending with '/'.  prefix ends with '/'.
+  explicit HttpStaticFiles(const string& root, const string& prefix = "/");
+  ~HttpStaticFiles();
+
+  /// Must be called before serving.
+  void setMaxOpenFiles(size_t maxOpenFiles)
+  { maxOpenFiles_ = maxOpenFiles; }
+
+  /// Must be called before serving.
+  void setMaxCachedFileSize(size_t maxCachedFileSize)
+  { maxCachedFileSize_ = maxCachedFileSize; }
+
+  /// Must be called before serving.
+  void setMaxCachedBytes(size_t maxCachedBytes)
+  { maxCachedBytes_ = maxCachedBytes; }
+
+  /// Must be called before serving.
+  void setValidSeconds(double validSeconds)
+  { validSeconds_ = validSeconds; }
+
+  /// Thread safe.
+  /// Fills resp for a GET or HEAD of a file, returns false without touching
+  /// resp if there is no such file.
+  bool serve(const HttpRequest& req, HttpResponse* resp);
+
+  /// Thread safe.
+  size_t cachedFiles() const;
+
+  /// Thread safe.
+  size_t cachedBytes() const;
+
+  /// Thread safe.  Files opened, to tell the cache works.
+  int64_t openedFiles() const;
+
+ private:
+  struct Entry;
+  typedef std::shared_ptr<const Entry> EntryPtr;
+  struct Node
+  {
+    string filename;
+    EntryPtr entry;
+    Timestamp validated;
+  };
+  typedef std::list<Node> NodeList;
+
+  bool resolve(StringPiece path, string* filename) const;
+  EntryPtr lookup(const string& filename, Timestamp now);
+  EntryPtr open(const string& filename);
+  void insert(const string& filename, const EntryPtr& entry, Timestamp now);
+  void erase(const string& filename);
+
+  const string root_;
+  const string prefix_;
+  size_t maxOpenFiles_;
+  size_t maxCachedFileSize_;
+  size_t maxCachedBytes_;
+  double validSeconds_;
+
+  mutable RwLock rwlock_;
+  // most recently validated first
+  NodeList lru_ GUARDED_BY(rwlock_);
+  std::unordered_map<string, NodeList::iterator> index_ GUARDED_BY(rwlock_);
+  size_t cachedBytes_ GUARDED_BY(rwlock_);
+  int64_t openedFiles_ GUARDED_BY(rwlock_);
+};
+
+}  // namespace net
+}  // namespace muduo
+
+#endif  // MUDUO_NET_HTTP_HTTPSTATICFILES_H
@@ -0,0 +1,338 @@
+#include "muduo/net/http/HttpCompressor.h"
+#include "muduo/net/http/HttpServer.h"
+#include "muduo/net/http/HttpStaticFiles.h"
+#include "muduo/net/http/HttpRequest.h"
+#include "muduo/net/http/HttpResponse.h"
+#include "muduo/net/http/tests/HttpTestUtil.h"
+
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+#include <zlib.h>
+
+#include <vector>
+
+#include <stdlib.h>
+#include <string.h>
+
+//#define BOOST_TEST_MODULE HttpCompressorTest
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "muduo/base/tests/TempDir.h"
+
+using namespace muduo;
+using namespace muduo::net;
+
+string gunzip(StringPiece data)
+{
+  z_stream zstream;
+  memset(&zstream, 0, sizeof zstream);
+  inflateInit2(&zstream, MAX_WBITS + 16);
+  zstream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+  zstream.avail_in = static_cast<uInt>(data.size());
+  string result;
+  char buf[4096];
+  int error = Z_OK;
+  while (error == Z_OK)
+  {
+    zstream.next_out = reinterpret_cast<Bytef*>(buf);
+    zstream.avail_out = sizeof buf;
+    error = inflate(&zstream, Z_NO_FLUSH);
+    result.append(buf, sizeof buf - zstream.avail_out);
+  }
+  inflateEnd(&zstream);
+  return error == Z_STREAM_END ? result : "error";
+}
+
+string json()
+{
+  string body = "[";
+  for (int i = 0; i < 200; ++i)
+  {
+    body += "{\"id\": " + std::to_string(i) + ", \"name\": \"muduo\", \"ok\": true},";
+  }
+  body += "{}]";
+  return body;
+}
+
+// the header of a response, in either list
+string header(const HttpResponse& resp, const string& field)
+{
+  for (const auto& h : resp.headers())
+  {
+    if (h.field == field)
+    {
+      return h.value;
+    }
+  }
+  if (resp.rawHeaders())
+  {
+    size_t pos = resp.rawHeaders()->find(field + ": ");
+    if (pos != string::npos)
+    {
+      pos += field.size() + 2;
+      return resp.rawHeaders()->substr(pos, resp.rawHeaders()->find("\r\n", pos) - pos);
+    }
+  }
+  return "";
+}
+
+// a GET with headers "Field: value\r\n..."
+class Request
+{
+ public:
+  explicit Request(const string& headers)
+    : headers_(headers)
+  {
+    const char kGet[] = "GET";
+    req_.setMethod(kGet, kGet + 3);
+    size_t start = 0;
+    size_t crlf;
+    while ((crlf = headers_.find("\r\n", start)) != string::npos)
+    {
+      const char* line = headers_.data() + start;
+      req_.addHeader(line, strchr(line, ':'), headers_.data() + crlf);
+      start = crlf + 2;
+    }
+  }
+
+  const HttpRequest& request() const { return req_; }
+
+ private:
+  string headers_;
+  HttpRequest req_;
+};
+
+BOOST_AUTO_TEST_CASE(testAcceptsGzip)
+{
+  BOOST_CHECK(HttpCompressor::acceptsGzip("gzip"));
+  BOOST_CHECK(HttpCompressor::acceptsGzip("gzip, deflate, br"));
+  BOOST_CHECK(HttpCompressor::acceptsGzip("deflate;q=1.0 , GZIP;q=0.5"));
+  BOOST_CHECK(HttpCompressor::acceptsGzip("x-gzip"));
+  BOOST_CHECK(HttpCompressor::acceptsGzip("*"));
+  BOOST_CHECK(HttpCompressor::acceptsGzip("br;q=1, *;q=0.1"));
+  BOOST_CHECK(!HttpCompressor::acceptsGzip(""));
+  BOOST_CHECK(!HttpCompressor::acceptsGzip("identity"));
+  BOOST_CHECK(!HttpCompressor::acceptsGzip("gzip;q=0"));
+  BOOST_CHECK(!HttpCompressor::acceptsGzip("gzip; q=0.000, *"));
+  BOOST_CHECK(!HttpCompressor::acceptsGzip("*;q=0"));
+  BOOST_CHECK(!HttpCompressor::acceptsGzip("gzipped"));
+}
+
+BOOST_AUTO_TEST_CASE(testCompressible)
+{
+  BOOST_CHECK(HttpCompressor::compressible("text/html; charset=utf-8"));
+  BOOST_CHECK(HttpCompressor::compressible("application/json"));
+  BOOST_CHECK(HttpCompressor::compressible("application/problem+json"));
+  BOOST_CHECK(HttpCompressor::compressible("application/javascript"));
+  BOOST_CHECK(HttpCompressor::compressible("image/svg+xml"));
+  BOOST_CHECK(!HttpCompressor::compressible("image/png"));
+  BOOST_CHECK(!HttpCompressor::compressible("application/octet-stream"));
+  BOOST_CHECK(!HttpCompressor::compressible(""));
+}
+
+BOOST_AUTO_TEST_CASE(testLevel)
+{
+  HttpCompressor compressor(6, 1024, 1024);
+  BOOST_CHECK(compressor.levelFor(0.0) == 6);
+  BOOST_CHECK(compressor.levelFor(0.005) == 3);
+  BOOST_CHECK(compressor.levelFor(0.5) == 1);
+}
+
+BOOST_AUTO_TEST_CASE(testCompress)
+{
+  HttpCompressor compressor(6, 1024, 1024 * 1024);
+  Request gzip("Accept-Encoding: gzip, deflate\r\n");
+  string body = json();
+
+  HttpResponse resp(false);
+  resp.setStatusCode(HttpResponse::k200Ok);
+  resp.setContentType("application/json");
+  resp.addHeader("ETag", "\"v1\"");
+  resp.setBody(body);
+  compressor.compress(gzip.request(), &resp, Timestamp::now());
+  BOOST_CHECK(header(resp, "Content-Encoding") == "gzip");
+  BOOST_CHECK(header(resp, "Vary") == "Accept-Encoding");
+  BOOST_CHECK(header(resp, "ETag") == "W/\"v1\"");
+  BOOST_CHECK(resp.body().size() < static_cast<int>(body.size()) / 4);
+  BOOST_CHECK(gunzip(resp.body()) == body);
+
+  // not accepted
+  Request identity("Accept-Encoding: identity\r\n");
+  HttpResponse plain(false);
+  plain.setContentType("application/json");
+  plain.addHeader("Vary", "Origin");
+  plain.setBody(body);
+  compressor.compress(identity.request(), &plain, Timestamp::now());
+  BOOST_CHECK(header(plain, "Content-Encoding").empty());
+  BOOST_CHECK(header(plain, "Vary") == "Origin, Accept-Encoding");
+  BOOST_CHECK(plain.body() == body);
+
+  // small, or an image
+  HttpResponse small(false);
+  small.setContentType("application/json");
+  small.setBody("{\"id\": 1}");
+  compressor.compress(gzip.request(), &small, Timestamp::now());
+  BOOST_CHECK(header(small, "Content-Encoding").empty());
+  BOOST_CHECK(header(small, "Vary") == "Accept-Encoding");
+  HttpResponse image(false);
+  image.setContentType("image/png");
+  image.setBody(body);
+  compressor.compress(gzip.request(), &image, Timestamp::now());
+  BOOST_CHECK(header(image, "Content-Encoding").empty());
+  BOOST_CHECK(compressor.cachedBodies() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(testCache)
+{
+  HttpCompressor compressor(9, 1024, 1024 * 1024);
+  Request gzip("Accept-Encoding: gzip\r\n");
+  std::shared_ptr<const string> body(new string(json()));
+  std::shared_ptr<const string> headers(
+      new string("Content-Type: text/plain\r\nETag: \"1-2\"\r\nAccept-Ranges: bytes\r\n"));
+
+  HttpResponse first(false);
+  first.setRawHeaders(headers);
+  first.setSharedBody(body);
+  compressor.compress(gzip.request(), &first, Timestamp::now());
+  BOOST_CHECK(header(first, "Content-Encoding") == "gzip");
+  BOOST_CHECK(header(first, "ETag") == "W/\"1-2\"");
+  BOOST_CHECK(gunzip(first.body()) == *body);
+  BOOST_CHECK(compressor.cachedBodies() == 1);
+  BOOST_CHECK(compressor.cachedBytes() ==
+         HttpCompressor::kNodeCost + static_cast<size_t>(first.body().size()));
+
+  // compressed once
+  HttpResponse second(false);
+  second.setRawHeaders(headers);
+  second.setSharedBody(body);
+  compressor.compress(gzip.request(), &second, Timestamp::now());
+  BOOST_CHECK(second.sharedBody() == first.sharedBody());
+  BOOST_CHECK(second.rawHeaders() == first.rawHeaders());
+  BOOST_CHECK(compressor.cachedBodies() == 1);
+
+  // another body, the cache holds one
+  HttpCompressor small(9, 1024, 1);
+  small.compress(gzip.request(), &first, Timestamp::now());
+  HttpResponse other(false);
+  std::shared_ptr<const string> otherBody(new string(json() + " "));
+  other.setRawHeaders(headers);
+  other.setSharedBody(otherBody);
+  small.compress(gzip.request(), &other, Timestamp::now());
+  BOOST_CHECK(small.cachedBodies() == 1);
+  BOOST_CHECK(gunzip(other.body()) == *otherBody);
+}
+
+// the body of a response for a shared body
+std::shared_ptr<const string> compressShared(HttpCompressor* compressor,
+                                             const std::shared_ptr<const string>& body)
+{
+  Request gzip("Accept-Encoding: gzip\r\n");
+  HttpResponse resp(false);
+  resp.setContentType("text/plain");
+  resp.setSharedBody(body);
+  compressor->compress(gzip.request(), &resp, Timestamp::now());
+  return resp.sharedBody();
+}
+
+BOOST_AUTO_TEST_CASE(testEviction)
+{
+  // not worth compressing, kept at the cost of the node
+  HttpCompressor compressor(1, 1024, 3 * HttpCompressor::kNodeCost);
+  std::vector<std::shared_ptr<const string>> bodies;
+  for (int i = 0; i < 5; ++i)
+  {
+    string random;
+    for (int j = 0; j < 2048; ++j)
+    {
+      random += static_cast<char>(rand());
+    }
+    bodies.emplace_back(new string(random));
+    BOOST_CHECK(compressShared(&compressor, bodies.back()) == bodies.back());
+  }
+  BOOST_CHECK(compressor.cachedBodies() == 3);
+  BOOST_CHECK(compressor.cachedBytes() == 3 * HttpCompressor::kNodeCost);
+
+  // gone with their files
+  HttpCompressor expiring(1, 1024, 1024 * 1024);
+  std::shared_ptr<const string> old(new string(json()));
+  compressShared(&expiring, old);
+  old.reset();
+  std::shared_ptr<const string> current(new string(json() + " "));
+  compressShared(&expiring, current);
+  BOOST_CHECK(expiring.cachedBodies() == 1);
+}
+
+BOOST_AUTO_TEST_CASE(testServer)
+{
+  EventLoop loop;
+  InetAddress listenAddr("127.0.0.1", 2045);
+  HttpServer server(&loop, listenAddr, "HttpServer");
+  server.setCompression(6);
+  const string body = json();
+  server.setHttpCallback([&body](const HttpRequest&, HttpResponse* resp)
+  {
+    resp->setStatusCode(HttpResponse::k200Ok);
+    resp->setContentType("application/json");
+    resp->setBody(body);
+  });
+  server.start();
+  string received = exchange(&loop, listenAddr,
+                             "GET /a HTTP/1.1\r\nAccept-Encoding: gzip\r\n\r\n"
+                             "GET /b HTTP/1.1\r\nConnection: close\r\n\r\n");
+
+  size_t head = received.find("\r\n\r\n") + 4;
+  BOOST_CHECK(received.find("\r\nContent-Encoding: gzip\r\n") < head);
+  size_t pos = received.find("Content-Length: ") + 16;
+  size_t length = static_cast<size_t>(atoi(received.c_str() + pos));
+  BOOST_CHECK(gunzip(StringPiece(received.data() + head, static_cast<int>(length))) == body);
+  // the second without
+  string second = received.substr(head + length);
+  BOOST_CHECK(second.find("Content-Encoding") == string::npos);
+  BOOST_CHECK(second.find("\r\nVary: Accept-Encoding\r\n") != string::npos);
+  BOOST_CHECK(second.substr(second.find("\r\n\r\n") + 4) == body);
+}
+
+BOOST_FIXTURE_TEST_CASE(testRevalidate, TempDir)
+{
+  const string body = json();
+  FILE* fp = ::fopen("data.json", "w");
+  ::fwrite(body.data(), 1, body.size(), fp);
+  ::fclose(fp);
+
+  EventLoop loop;
+  InetAddress listenAddr("127.0.0.1", 2047);
+  HttpServer server(&loop, listenAddr, "HttpServer");
+  server.setCompression(6);
+  HttpStaticFiles files(dir);
+  server.setHttpCallback([&files](const HttpRequest& req, HttpResponse* resp)
+  {
+    files.serve(req, resp);
+  });
+  server.start();
+  string first = exchange(&loop, listenAddr,
+                          "GET /data.json HTTP/1.1\r\nAccept-Encoding: gzip\r\n"
+                          "Connection: close\r\n\r\n");
+  BOOST_CHECK(first.find("\r\nContent-Encoding: gzip\r\n") != string::npos);
+  size_t pos = first.find("\r\nETag: ") + 8;
+  string etag = first.substr(pos, first.find("\r\n", pos) - pos);
+  BOOST_CHECK(StringPiece(etag).starts_with("W/\""));
+
+  // the 304 carries what the gzip came with
+  string second = exchange(&loop, listenAddr,
+                           "GET /data.json HTTP/1.1\r\nAccept-Encoding: gzip\r\n"
+                           "If-None-Match: " + etag + "\r\nConnection: close\r\n\r\n");
+  BOOST_CHECK(second.compare(0, 25, "HTTP/1.1 304 Not Modified") == 0);
+  BOOST_CHECK(second.find("\r\nETag: " + etag + "\r\n") != string::npos);
+  BOOST_CHECK(second.find("\r\nVary: Accept-Encoding\r\n") != string::npos);
+  BOOST_CHECK(second.find("Content-Encoding") == string::npos);
+
+  // and the strong one for the identity body
+  string strong = etag.substr(2);
+  string third = exchange(&loop, listenAddr,
+                          "GET /data.json HTTP/1.1\r\nIf-None-Match: " + strong +
+                          "\r\nConnection: close\r\n\r\n");
+  BOOST_CHECK(third.compare(0, 25, "HTTP/1.1 304 Not Modified") == 0);
+  BOOST_CHECK(third.find("\r\nETag: " + strong + "\r\n") != string::npos);
+  ::unlink("data.json");
+}
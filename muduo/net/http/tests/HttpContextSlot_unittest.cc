@@ -0,0 +1,79 @@
+#include "muduo/net/ConnectionContext.h"
+#include "muduo/net/http/HttpContext.h"
+
+#include <memory>
+#include <vector>
+
+//#define BOOST_TEST_MODULE HttpContextSlotTest
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+using muduo::net::ConnectionContexts;
+using muduo::net::ContextSlot;
+using muduo::net::HttpContext;
+
+namespace muduo
+{
+namespace net
+{
+class RpcChannel;
+namespace coro
+{
+class CoroStream;
+}  // namespace coro
+}  // namespace net
+}  // namespace muduo
+
+// as RpcServer and CoroStream keep them
+typedef std::shared_ptr<muduo::net::RpcChannel> RpcChannelPtr;
+typedef std::shared_ptr<muduo::net::coro::CoroStream> CoroStreamPtr;
+
+const ContextSlot<HttpContext> kHttpSlot = ConnectionContexts::registerSlot<HttpContext>();
+const ContextSlot<RpcChannelPtr> kRpcSlot = ConnectionContexts::registerSlot<RpcChannelPtr>();
+const ContextSlot<CoroStreamPtr> kCoroSlot = ConnectionContexts::registerSlot<CoroStreamPtr>();
+
+bool isInline(const ConnectionContexts& contexts, const void* p)
+{
+  const char* begin = reinterpret_cast<const char*>(&contexts);
+  const char* q = static_cast<const char*>(p);
+  return q >= begin && q < begin + sizeof contexts;
+}
+
+BOOST_AUTO_TEST_CASE(testMuduoSlotsInline)
+{
+  ConnectionContexts contexts;
+  BOOST_CHECK(isInline(contexts, contexts.emplace(kHttpSlot)));
+  BOOST_CHECK(isInline(contexts, contexts.emplace(kRpcSlot)));
+  BOOST_CHECK(isInline(contexts, contexts.emplace(kCoroSlot)));
+  BOOST_CHECK(contexts.get(kHttpSlot)->request().path().empty());
+}
+
+BOOST_AUTO_TEST_CASE(testUserSlotsOnHeap)
+{
+  // as many as are left, none runs out of storage
+  std::vector<ContextSlot<std::shared_ptr<int>>> slots;
+  for (int i = 3; i < ConnectionContexts::kMaxSlots; ++i)
+  {
+    slots.push_back(ConnectionContexts::registerSlot<std::shared_ptr<int>>());
+    BOOST_CHECK(slots.back().valid());
+  }
+
+  std::shared_ptr<int> p(new int(1));
+  {
+    ConnectionContexts contexts;
+    contexts.emplace(kHttpSlot);
+    contexts.emplace(kRpcSlot);
+    contexts.emplace(kCoroSlot);
+    for (const auto& slot : slots)
+    {
+      BOOST_CHECK(!isInline(contexts, contexts.emplace(slot, p)));
+    }
+    for (const auto& slot : slots)
+    {
+      BOOST_CHECK(*contexts.get(slot) == p);
+    }
+    BOOST_CHECK_EQUAL(p.use_count(), 1 + static_cast<long>(slots.size()));
+  }
+  BOOST_CHECK_EQUAL(p.use_count(), 1);
+}
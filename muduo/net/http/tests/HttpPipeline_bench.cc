@@ -0,0 +1,134 @@
+// A pipelining load generator against an HttpServer serving /hello in
+// another thread.  Every connection keeps depth requests in flight and
+// sends a new one for each response it reads.
+//
+// Usage: httppipeline_bench [depth] [connections] [seconds]
+
+#include "muduo/net/http/HttpServer.h"
+#include "muduo/net/http/HttpRequest.h"
+#include "muduo/net/http/HttpResponse.h"
+#include "muduo/base/CountDownLatch.h"
+#include "muduo/base/Logging.h"
+#include "muduo/net/EventLoop.h"
+#include "muduo/net/EventLoopThread.h"
+#include "muduo/net/TcpClient.h"
+
+#include <memory>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace muduo;
+using namespace muduo::net;
+
+const char kRequest[] = "GET /hello HTTP/1.1\r\nHost: localhost\r\n\r\n";
+
+int g_depth = 16;
+int64_t g_responses = 0;
+
+void onRequest(const HttpRequest& req, HttpResponse* resp)
+{
+  if (req.path() == "/hello")
+  {
+    resp->setStatusCode(HttpResponse::k200Ok);
+    resp->setStatusMessage("OK");
+    resp->setContentType("text/plain");
+    resp->addHeader("Server", "Muduo");
+    resp->setBody("hello, world!\n");
+  }
+  else
+  {
+    resp->setStatusCode(HttpResponse::k404NotFound);
+    resp->setStatusMessage("Not Found");
+    resp->setCloseConnection(true);
+  }
+}
+
+void sendRequests(const TcpConnectionPtr& conn, int n)
+{
+  string requests;
+  for (int i = 0; i < n; ++i)
+  {
+    requests.append(kRequest, sizeof kRequest - 1);
+  }
+  conn->send(requests);
+}
+
+void onConnection(const TcpConnectionPtr& conn)
+{
+  if (conn->connected())
+  {
+    sendRequests(conn, g_depth);
+  }
+}
+
+// responses carry Content-Length
+void onMessage(const TcpConnectionPtr& conn, Buffer* buf, Timestamp)
+{
+  const char kEnd[] = "\r\n\r\n";
+  const char kLength[] = "Content-Length: ";
+  int done = 0;
+  while (buf->readableBytes() > 0)
+  {
+    const char* last = buf->peek() + buf->readableBytes();
+    const char* end = std::search(buf->peek(), last, kEnd, kEnd + 4);
+    if (end == last)
+    {
+      break;
+    }
+    const char* length = std::search(buf->peek(), end, kLength, kLength + sizeof kLength - 1);
+    size_t body = length == end ? 0 : atoi(length + sizeof kLength - 1);
+    size_t total = end + 4 - buf->peek() + body;
+    if (buf->readableBytes() < total)
+    {
+      break;
+    }
+    buf->retrieve(total);
+    ++done;
+  }
+  g_responses += done;
+  if (done > 0)
+  {
+    sendRequests(conn, done);
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  g_depth = argc > 1 ? atoi(argv[1]) : 16;
+  int connections = argc > 2 ? atoi(argv[2]) : 4;
+  double seconds = argc > 3 ? atof(argv[3]) : 5.0;
+  Logger::setLogLevel(Logger::WARN);
+
+  InetAddress listenAddr("127.0.0.1", 2043);
+  // the server lives in its own loop thread
+  std::unique_ptr<HttpServer> server;
+  EventLoopThread serverThread([&](EventLoop* serverLoop)
+  {
+    server.reset(new HttpServer(serverLoop, listenAddr, "HttpServer"));
+    server->setHttpCallback(onRequest);
+    server->start();
+  });
+  EventLoop* serverLoop = serverThread.startLoop();
+
+  EventLoop loop;
+  std::vector<std::unique_ptr<TcpClient>> clients;
+  for (int i = 0; i < connections; ++i)
+  {
+    clients.emplace_back(new TcpClient(&loop, listenAddr, "Client"));
+    clients.back()->setConnectionCallback(onConnection);
+    clients.back()->setMessageCallback(onMessage);
+    clients.back()->connect();
+  }
+  Timestamp start(Timestamp::now());
+  loop.runAfter(seconds, [&loop] { loop.quit(); });
+  loop.loop();
+  double elapsed = timeDifference(Timestamp::now(), start);
+  printf("depth %d, %d connections: %.0f requests/s\n",
+         g_depth, connections, static_cast<double>(g_responses) / elapsed);
+  clients.clear();
+  CountDownLatch latch(1);
+  serverLoop->runInLoop([&] { server.reset(); latch.countDown(); });
+  latch.wait();
+}
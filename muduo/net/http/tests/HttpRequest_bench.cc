@@ -0,0 +1,81 @@
+// Requests per second through HttpContext and the /hello handler of
+// HttpServer_test, without sockets: parse a typical browser request,
+// run the handler and serialize the response, Date header included,
+// as HttpServer does.
+//
+// Usage: httprequest_bench [requests]
+
+#include "muduo/net/http/HttpContext.h"
+#include "muduo/net/http/HttpRequest.h"
+#include "muduo/net/http/HttpResponse.h"
+#include "muduo/net/Buffer.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace muduo;
+using namespace muduo::net;
+
+const char kRequest[] =
+    "GET /hello HTTP/1.1\r\n"
+    "Host: localhost:8000\r\n"
+    "User-Agent: Mozilla/5.0 (X11; Linux x86_64; rv:109.0) Gecko/20100101 Firefox/115.0\r\n"
+    "Accept: text/html,application/xhtml+xml,application/xml;q=0.9,*/*;q=0.8\r\n"
+    "Accept-Language: en-US,en;q=0.5\r\n"
+    "Accept-Encoding: gzip, deflate, br\r\n"
+    "Connection: keep-alive\r\n"
+    "Upgrade-Insecure-Requests: 1\r\n"
+    "Cache-Control: max-age=0\r\n"
+    "\r\n";
+
+void onRequest(const HttpRequest& req, HttpResponse* resp)
+{
+  if (req.path() == "/hello")
+  {
+    resp->setStatusCode(HttpResponse::k200Ok);
+    resp->setStatusMessage("OK");
+    resp->setContentType("text/plain");
+    resp->addHeader("Server", "Muduo");
+    resp->setBody("hello, world!\n");
+  }
+  else
+  {
+    resp->setStatusCode(HttpResponse::k404NotFound);
+    resp->setStatusMessage("Not Found");
+    resp->setCloseConnection(true);
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  int requests = argc > 1 ? atoi(argv[1]) : 1000*1000;
+
+  HttpContext context;
+  Buffer input;
+  Buffer output;
+  size_t responseBytes = 0;
+  Timestamp start(Timestamp::now());
+  for (int i = 0; i < requests; ++i)
+  {
+    input.append(kRequest, sizeof kRequest - 1);
+    if (!context.parseRequest(&input, start) || !context.gotAll())
+    {
+      printf("bad request\n");
+      return 1;
+    }
+    const HttpRequest& req = context.request();
+    StringPiece connection = req.getHeader("Connection");
+    bool close = connection == "close" ||
+      (req.getVersion() == HttpRequest::kHttp10 && connection != "Keep-Alive");
+    HttpResponse response(close);
+    onRequest(req, &response);
+    response.appendHeadToBuffer(&output, start);
+    output.append(response.body());
+    responseBytes += output.readableBytes();
+    output.retrieveAll();
+    context.retrieveRequest(&input);
+  }
+  double seconds = timeDifference(Timestamp::now(), start);
+  printf("%d requests in %.3f seconds, %.0f requests/s, %zd bytes out\n",
+         requests, seconds, requests / seconds, responseBytes);
+}
@@ -24,10 +24,10 @@ BOOST_AUTO_TEST_CASE(testParseRequestAllInOne)
   BOOST_CHECK(context.gotAll());
   const HttpRequest& request = context.request();
   BOOST_CHECK_EQUAL(request.method(), HttpRequest::kGet);
-  BOOST_CHECK_EQUAL(request.path(), string("/index.html"));
+  BOOST_CHECK_EQUAL(request.path().as_string(), string("/index.html"));
   BOOST_CHECK_EQUAL(request.getVersion(), HttpRequest::kHttp11);
-  BOOST_CHECK_EQUAL(request.getHeader("Host"), string("www.chenshuo.com"));
-  BOOST_CHECK_EQUAL(request.getHeader("User-Agent"), string(""));
+  BOOST_CHECK_EQUAL(request.getHeader("Host").as_string(), string("www.chenshuo.com"));
+  BOOST_CHECK_EQUAL(request.getHeader("User-Agent").as_string(), string(""));
 }
 
 BOOST_AUTO_TEST_CASE(testParseRequestInTwoPieces)
@@ -50,10 +50,10 @@ BOOST_AUTO_TEST_CASE(testParseRequestInTwoPieces)
     BOOST_CHECK(context.gotAll());
     const HttpRequest& request = context.request();
     BOOST_CHECK_EQUAL(request.method(), HttpRequest::kGet);
-    BOOST_CHECK_EQUAL(request.path(), string("/index.html"));
+    BOOST_CHECK_EQUAL(request.path().as_string(), string("/index.html"));
     BOOST_CHECK_EQUAL(request.getVersion(), HttpRequest::kHttp11);
-    BOOST_CHECK_EQUAL(request.getHeader("Host"), string("www.chenshuo.com"));
-    BOOST_CHECK_EQUAL(request.getHeader("User-Agent"), string(""));
+    BOOST_CHECK_EQUAL(request.getHeader("Host").as_string(), string("www.chenshuo.com"));
+    BOOST_CHECK_EQUAL(request.getHeader("User-Agent").as_string(), string(""));
   }
 }
 
@@ -71,9 +71,273 @@ BOOST_AUTO_TEST_CASE(testParseRequestEmptyHeaderValue)
   BOOST_CHECK(context.gotAll());
   const HttpRequest& request = context.request();
   BOOST_CHECK_EQUAL(request.method(), HttpRequest::kGet);
-  BOOST_CHECK_EQUAL(request.path(), string("/index.html"));
+  BOOST_CHECK_EQUAL(request.path().as_string(), string("/index.html"));
   BOOST_CHECK_EQUAL(request.getVersion(), HttpRequest::kHttp11);
-  BOOST_CHECK_EQUAL(request.getHeader("Host"), string("www.chenshuo.com"));
-  BOOST_CHECK_EQUAL(request.getHeader("User-Agent"), string(""));
-  BOOST_CHECK_EQUAL(request.getHeader("Accept-Encoding"), string(""));
+  BOOST_CHECK_EQUAL(request.getHeader("Host").as_string(), string("www.chenshuo.com"));
+  BOOST_CHECK_EQUAL(request.getHeader("User-Agent").as_string(), string(""));
+  BOOST_CHECK_EQUAL(request.getHeader("Accept-Encoding").as_string(), string(""));
+}
+
+BOOST_AUTO_TEST_CASE(testParseRequestZeroCopy)
+{
+  HttpContext context;
+  Buffer input;
+  input.append("GET /search?q=muduo HTTP/1.1\r\n"
+       "Host: www.chenshuo.com\r\n"
+       "accept-encoding: gzip\r\n"
+       "X-Forwarded-For: 10.0.0.1\r\n"
+       "X-FORWARDED-FOR: 10.0.0.2\r\n"
+       "\r\n"
+       "GET /next HTTP/1.1\r\n");
+
+  BOOST_CHECK(context.parseRequest(&input, Timestamp::now()));
+  BOOST_CHECK(context.gotAll());
+  const HttpRequest& request = context.request();
+  // points into the input buffer
+  BOOST_CHECK(request.path().data() > input.peek());
+  BOOST_CHECK(request.path().end() < input.peek() + input.readableBytes());
+  BOOST_CHECK_EQUAL(request.path().as_string(), string("/search"));
+  BOOST_CHECK_EQUAL(request.query().as_string(), string("?q=muduo"));
+  // case-insensitive, the first one
+  BOOST_CHECK_EQUAL(request.getHeader("HOST").as_string(), string("www.chenshuo.com"));
+  BOOST_CHECK_EQUAL(request.getHeader("Accept-Encoding").as_string(), string("gzip"));
+  BOOST_CHECK_EQUAL(request.getHeader("x-forwarded-for").as_string(), string("10.0.0.1"));
+  BOOST_CHECK_EQUAL(request.headers().size(), 4u);
+  BOOST_CHECK_EQUAL(request.headers()[3].field.as_string(), string("X-FORWARDED-FOR"));
+
+  context.retrieveRequest(&input);
+  BOOST_CHECK_EQUAL(input.retrieveAllAsString(), string("GET /next HTTP/1.1\r\n"));
+  BOOST_CHECK(context.request().headers().empty());
+}
+
+BOOST_AUTO_TEST_CASE(testParseRequestBufferGrows)
+{
+  string header("X-Padding: ");
+  header += string(8000, 'x');
+  header += "\r\n";
+
+  HttpContext context;
+  Buffer input;
+  input.append("GET /index.html HTTP/1.1\r\nHost: www.chenshuo.com\r\n");
+  BOOST_CHECK(context.parseRequest(&input, Timestamp::now()));
+  BOOST_CHECK(!context.gotAll());
+  const char* before = input.peek();
+
+  // reallocates the buffer
+  input.append(header);
+  input.append("\r\n");
+  BOOST_CHECK(input.peek() != before);
+  BOOST_CHECK(context.parseRequest(&input, Timestamp::now()));
+  BOOST_CHECK(context.gotAll());
+  const HttpRequest& request = context.request();
+  BOOST_CHECK_EQUAL(request.path().as_string(), string("/index.html"));
+  BOOST_CHECK_EQUAL(request.getHeader("Host").as_string(), string("www.chenshuo.com"));
+  BOOST_CHECK_EQUAL(request.getHeader("X-Padding").size(), 8000);
+}
+
+BOOST_AUTO_TEST_CASE(testCopyOwnsBytes)
+{
+  HttpRequest copy;
+  {
+    HttpContext context;
+    Buffer input;
+    input.append("GET /index.html?a=b HTTP/1.1\r\n"
+         "Host: www.chenshuo.com\r\n"
+         "\r\n");
+    BOOST_CHECK(context.parseRequest(&input, Timestamp::now()));
+    BOOST_CHECK(context.gotAll());
+    copy = context.request();
+    context.retrieveRequest(&input);
+    input.append("XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX");
+  }
+  HttpRequest second(copy);
+  BOOST_CHECK(second.path().data() == copy.path().data());
+  BOOST_CHECK_EQUAL(second.method(), HttpRequest::kGet);
+  BOOST_CHECK_EQUAL(second.path().as_string(), string("/index.html"));
+  BOOST_CHECK_EQUAL(second.query().as_string(), string("?a=b"));
+  BOOST_CHECK_EQUAL(second.getHeader("host").as_string(), string("www.chenshuo.com"));
+}
+
+BOOST_AUTO_TEST_CASE(testParseBodyContentLength)
+{
+  string all("POST /upload HTTP/1.1\r\n"
+       "Content-Length: 11\r\n"
+       "\r\n"
+       "hello world"
+       "GET / HTTP/1.1\r\n");
+
+  for (size_t sz1 = 0; sz1 < all.size(); ++sz1)
+  {
+    HttpContext context;
+    Buffer input;
+    input.append(all.c_str(), sz1);
+    BOOST_CHECK(context.parseRequest(&input, Timestamp::now()));
+    BOOST_CHECK_EQUAL(context.gotAll(), sz1 >= all.size() - 16);
+
+    input.append(all.c_str() + sz1, all.size() - sz1);
+    BOOST_CHECK(context.parseRequest(&input, Timestamp::now()));
+    BOOST_CHECK(context.gotAll());
+    BOOST_CHECK_EQUAL(context.request().method(), HttpRequest::kPost);
+    BOOST_CHECK_EQUAL(context.request().body().as_string(), string("hello world"));
+    context.retrieveRequest(&input);
+    BOOST_CHECK_EQUAL(input.retrieveAllAsString(), string("GET / HTTP/1.1\r\n"));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testParseBodyChunked)
+{
+  string all("POST /upload HTTP/1.1\r\n"
+       "Transfer-Encoding: chunked\r\n"
+       "\r\n"
+       "5\r\nhello\r\n"
+       "1;name=value\r\n \r\n"
+       "A\r\n0123456789\r\n"
+       "0\r\n"
+       "Trailer: ignored\r\n"
+       "\r\n");
+
+  for (size_t sz1 = 0; sz1 < all.size(); ++sz1)
+  {
+    HttpContext context;
+    Buffer input;
+    input.append(all.c_str(), sz1);
+    BOOST_CHECK(context.parseRequest(&input, Timestamp::now()));
+    BOOST_CHECK(!context.gotAll());
+
+    input.append(all.c_str() + sz1, all.size() - sz1);
+    BOOST_CHECK(context.parseRequest(&input, Timestamp::now()));
+    BOOST_CHECK(context.gotAll());
+    BOOST_CHECK_EQUAL(context.request().body().as_string(), string("hello 0123456789"));
+    context.retrieveRequest(&input);
+    BOOST_CHECK_EQUAL(input.readableBytes(), 0);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testParseBodyChunkedAfterStreaming)
+{
+  string chunked("POST /upload HTTP/1.1\r\n"
+       "Transfer-Encoding: chunked\r\n"
+       "\r\n"
+       "5\r\nhello\r\n"
+       "0\r\n\r\n");
+  HttpContext context;
+  string received;
+  HttpContext::BodyCallback onBody = [&received](const HttpRequest&, muduo::StringPiece data)
+  {
+    received += data.as_string();
+  };
+  Buffer input;
+  input.append(chunked);
+  BOOST_CHECK(context.parseRequest(&input, Timestamp::now(), onBody));
+  BOOST_CHECK(context.gotAll());
+  BOOST_CHECK_EQUAL(received, string("hello"));
+  context.retrieveRequest(&input);
+
+  // kept in the request this time, twice
+  for (int i = 0; i < 2; ++i)
+  {
+    input.append(chunked);
+    BOOST_CHECK(context.parseRequest(&input, Timestamp::now()));
+    BOOST_CHECK(context.gotAll());
+    BOOST_CHECK_EQUAL(context.request().body().as_string(), string("hello"));
+    context.retrieveRequest(&input);
+    BOOST_CHECK_EQUAL(input.readableBytes(), 0);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testParseBodyStreaming)
+{
+  const char* bodies[] = {
+    "POST /upload HTTP/1.1\r\n"
+    "Content-Length: 16\r\n"
+    "\r\n"
+    "hello 0123456789",
+    "POST /upload HTTP/1.1\r\n"
+    "Transfer-Encoding: Chunked\r\n"
+    "\r\n"
+    "6\r\nhello \r\n"
+    "a\r\n0123456789\r\n"
+    "0\r\n\r\n",
+  };
+  for (const char* body : bodies)
+  {
+    // one byte at a time
+    string all(body);
+    HttpContext context;
+    context.setMaxBodySize(4);
+    string received;
+    int pieces = 0;
+    HttpContext::BodyCallback onBody = [&](const HttpRequest& req, muduo::StringPiece data)
+    {
+      BOOST_CHECK_EQUAL(req.path().as_string(), string("/upload"));
+      received += data.as_string();
+      ++pieces;
+    };
+    Buffer input;
+    for (size_t i = 0; i < all.size(); ++i)
+    {
+      input.append(all.c_str() + i, 1);
+      BOOST_CHECK(context.parseRequest(&input, Timestamp::now(), onBody));
+      BOOST_CHECK_EQUAL(context.gotAll(), i + 1 == all.size());
+    }
+    BOOST_CHECK_EQUAL(received, string("hello 0123456789"));
+    BOOST_CHECK_EQUAL(pieces, 16);
+    // passed on, and retrieved as it went
+    BOOST_CHECK(context.request().body().empty());
+    BOOST_CHECK_EQUAL(input.readableBytes(), 0);
+    BOOST_CHECK_EQUAL(context.request().getHeader("Transfer-Encoding").empty(),
+                      all.find("Chunked") == string::npos);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testParseBodyErrors)
+{
+  const char* requests[] = {
+    "POST / HTTP/1.1\r\nContent-Length: 12a\r\n\r\n",
+    "POST / HTTP/1.1\r\nContent-Length: 1234567890123456789\r\n\r\n",
+    "POST / HTTP/1.1\r\nTransfer-Encoding: gzip\r\n\r\n",
+    "POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\nx\r\n",
+    "POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n1234567890123456\r\n",
+    "POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n1\r\nab\r\n",
+  };
+  for (const char* request : requests)
+  {
+    HttpContext context;
+    Buffer input;
+    input.append(request);
+    BOOST_CHECK(!context.parseRequest(&input, Timestamp::now()));
+    BOOST_CHECK(!context.bodyTooLarge());
+  }
+
+  HttpContext context;
+  context.setMaxBodySize(10);
+  Buffer input;
+  input.append("POST / HTTP/1.1\r\nContent-Length: 11\r\n\r\n");
+  BOOST_CHECK(!context.parseRequest(&input, Timestamp::now()));
+  BOOST_CHECK(context.bodyTooLarge());
+
+  context.reset();
+  input.retrieveAll();
+  input.append("POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n"
+               "6\r\n012345\r\n5\r\n");
+  BOOST_CHECK(!context.parseRequest(&input, Timestamp::now()));
+  BOOST_CHECK(context.bodyTooLarge());
+}
+
+BOOST_AUTO_TEST_CASE(testExpectContinue)
+{
+  HttpContext context;
+  Buffer input;
+  input.append("PUT /file HTTP/1.1\r\n"
+               "Content-Length: 5\r\n"
+               "Expect: 100-continue\r\n"
+               "\r\n");
+  BOOST_CHECK(context.parseRequest(&input, Timestamp::now()));
+  BOOST_CHECK(!context.gotAll());
+  BOOST_CHECK(context.takeExpectContinue());
+  BOOST_CHECK(!context.takeExpectContinue());
+  input.append("12345");
+  BOOST_CHECK(context.parseRequest(&input, Timestamp::now()));
+  BOOST_CHECK(context.gotAll());
+  BOOST_CHECK_EQUAL(context.request().body().as_string(), string("12345"));
 }
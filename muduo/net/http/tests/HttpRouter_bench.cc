@@ -0,0 +1,112 @@
+// Lookups per second of HttpRouter, against splitting the path and looking
+// up maps under a mutex as Inspector did, with the commands of Inspector
+// and a few REST routes.
+//
+// Usage: httprouter_bench [lookups]
+
+#include "muduo/net/http/HttpRouter.h"
+#include "muduo/base/Mutex.h"
+#include "muduo/base/Timestamp.h"
+
+#include <map>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace muduo;
+using namespace muduo::net;
+
+const char* kCommands[][2] =
+{
+  { "proc", "overview" }, { "proc", "pid" }, { "proc", "status" },
+  { "proc", "opened_files" }, { "proc", "threads" },
+  { "sys", "overview" }, { "sys", "loadavg" }, { "sys", "version" },
+  { "sys", "cpuinfo" }, { "sys", "meminfo" }, { "sys", "stat" },
+  { "pprof", "heap" }, { "pprof", "growth" }, { "pprof", "profile" },
+  { "pprof", "cmdline" }, { "pprof", "memstats" },
+};
+
+const char* kPaths[] =
+{
+  "/proc/overview", "/sys/meminfo", "/pprof/profile/30", "/proc/threads",
+  "/sys/loadavg", "/pprof/heap",
+};
+
+typedef std::map<string, std::map<string, int>> Modules;
+
+// the old Inspector::onRequest
+std::vector<string> split(const string& str)
+{
+  std::vector<string> result;
+  size_t start = 0;
+  size_t pos = str.find('/');
+  while (pos != string::npos)
+  {
+    if (pos > start)
+    {
+      result.push_back(str.substr(start, pos-start));
+    }
+    start = pos+1;
+    pos = str.find('/', start);
+  }
+  if (start < str.length())
+  {
+    result.push_back(str.substr(start));
+  }
+  return result;
+}
+
+int main(int argc, char* argv[])
+{
+  int lookups = argc > 1 ? atoi(argv[1]) : 1000*1000;
+  const int kNumPaths = sizeof kPaths / sizeof kPaths[0];
+
+  MutexLock mutex;
+  Modules modules;
+  HttpRouter router;
+  int found = 0;
+  HttpRouter::Handler handler = [&found](const HttpRequest&, const HttpRouter::Params&, HttpResponse*)
+  {
+    ++found;
+  };
+  for (const auto& command : kCommands)
+  {
+    modules[command[0]][command[1]] = 1;
+    string path = string("/") + command[0] + "/" + command[1];
+    router.add(path, handler);
+    router.add(path + "/*args", handler);
+  }
+  router.add(HttpRequest::kGet, "/api/users/:id", handler);
+  router.add(HttpRequest::kGet, "/api/users/:id/posts/:post", handler);
+  router.add(HttpRequest::kGet, "/static/*path", handler);
+
+  Timestamp start(Timestamp::now());
+  for (int i = 0; i < lookups; ++i)
+  {
+    StringPiece path(kPaths[i % kNumPaths]);
+    std::vector<string> result = split(path.as_string());
+    MutexLockGuard lock(mutex);
+    Modules::const_iterator it = modules.find(result[0]);
+    if (it != modules.end() && it->second.count(result[1]))
+    {
+      ++found;
+    }
+  }
+  double seconds = timeDifference(Timestamp::now(), start);
+  printf("split and maps: %.0f lookups/s\n", lookups / seconds);
+
+  start = Timestamp::now();
+  for (int i = 0; i < lookups; ++i)
+  {
+    HttpRouter::Params params;
+    const HttpRouter::Handler* h = router.match(HttpRequest::kGet, kPaths[i % kNumPaths], &params);
+    if (h)
+    {
+      ++found;
+    }
+  }
+  seconds = timeDifference(Timestamp::now(), start);
+  printf("HttpRouter:     %.0f lookups/s\n", lookups / seconds);
+  printf("%d found\n", found);
+}
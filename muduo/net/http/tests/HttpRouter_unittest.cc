@@ -0,0 +1,170 @@
+#include "muduo/net/http/HttpRouter.h"
+#include "muduo/net/http/HttpResponse.h"
+#include "muduo/net/Buffer.h"
+
+#include <new>
+
+#include <stdlib.h>
+
+//#define BOOST_TEST_MODULE HttpRouterTest
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+using namespace muduo;
+using namespace muduo::net;
+
+int g_allocations = 0;
+
+void* operator new(size_t size)
+{
+  ++g_allocations;
+  void* p = ::malloc(size);
+  if (p == NULL)
+  {
+    throw std::bad_alloc();
+  }
+  return p;
+}
+
+void operator delete(void* p) noexcept
+{
+  ::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+  ::free(p);
+}
+
+// handlers tell themselves apart by the status message
+HttpRouter::Handler named(const char* name)
+{
+  return [name](const HttpRequest&, const HttpRouter::Params&, HttpResponse* resp)
+  {
+    resp->setStatusCode(HttpResponse::k200Ok);
+    resp->setStatusMessage(name);
+  };
+}
+
+// the name of the handler matched, with its parameters
+string match(const HttpRouter& router, HttpRequest::Method method, const char* path)
+{
+  HttpRouter::Params params;
+  const HttpRouter::Handler* handler = router.match(method, path, &params);
+  if (handler == NULL)
+  {
+    return "none";
+  }
+  HttpResponse resp(false);
+  (*handler)(HttpRequest(), params, &resp);
+  Buffer output;
+  resp.appendToBuffer(&output);
+  string result = output.retrieveAsString(output.findCRLF() - output.peek()).substr(13);
+  for (int i = 0; i < params.size(); ++i)
+  {
+    result += " " + params.name(i).as_string() + "=" + params.value(i).as_string();
+  }
+  return result;
+}
+
+string get(const HttpRouter& router, const char* path)
+{
+  return match(router, HttpRequest::kGet, path);
+}
+
+BOOST_AUTO_TEST_CASE(testStatic)
+{
+  HttpRouter router;
+  // in an order that splits nodes
+  router.add(HttpRequest::kGet, "/users/list", named("list"));
+  router.add(HttpRequest::kGet, "/users", named("users"));
+  router.add(HttpRequest::kGet, "/user", named("user"));
+  router.add(HttpRequest::kGet, "/", named("root"));
+  router.add(HttpRequest::kGet, "/usage", named("usage"));
+  router.add(HttpRequest::kGet, "/v1/models:predict", named("predict"));
+
+  BOOST_CHECK(get(router, "/") == "root");
+  BOOST_CHECK(get(router, "/user") == "user");
+  BOOST_CHECK(get(router, "/users") == "users");
+  BOOST_CHECK(get(router, "/users/list") == "list");
+  BOOST_CHECK(get(router, "/usage") == "usage");
+  BOOST_CHECK(get(router, "/v1/models:predict") == "predict");
+  BOOST_CHECK(get(router, "/use") == "none");
+  BOOST_CHECK(get(router, "/users/") == "none");
+  BOOST_CHECK(get(router, "/users/lists") == "none");
+  BOOST_CHECK(get(router, "") == "none");
+}
+
+BOOST_AUTO_TEST_CASE(testParams)
+{
+  HttpRouter router;
+  router.add(HttpRequest::kGet, "/users/:id", named("user"));
+  router.add(HttpRequest::kGet, "/users/:id/posts/:post", named("post"));
+  router.add(HttpRequest::kGet, "/users/new", named("new"));
+  router.add(HttpRequest::kGet, "/files/*path", named("file"));
+  router.add(HttpRequest::kGet, "/files/readme", named("readme"));
+  router.add(HttpRequest::kGet, "/:module/:command/*args", named("command"));
+
+  BOOST_CHECK(get(router, "/users/42") == "user id=42");
+  BOOST_CHECK(get(router, "/users/new") == "new");
+  BOOST_CHECK(get(router, "/users/newer") == "user id=newer");
+  BOOST_CHECK(get(router, "/users/42/posts/7") == "post id=42 post=7");
+  BOOST_CHECK(get(router, "/users/") == "none");
+  BOOST_CHECK(get(router, "/files/a/b/c.txt") == "file path=a/b/c.txt");
+  BOOST_CHECK(get(router, "/files/") == "file path=");
+  BOOST_CHECK(get(router, "/files/readme") == "readme");
+  BOOST_CHECK(get(router, "/files/readme/more") == "file path=readme/more");
+  // backtracks from the static "/users" to the parameters
+  BOOST_CHECK(get(router, "/users/42/threads") == "command module=users command=42 args=threads");
+  BOOST_CHECK(get(router, "/proc/status/") == "command module=proc command=status args=");
+  BOOST_CHECK(get(router, "/proc/status") == "none");
+}
+
+BOOST_AUTO_TEST_CASE(testMethods)
+{
+  HttpRouter router;
+  router.add(HttpRequest::kGet, "/items/:id", named("get"));
+  router.add(HttpRequest::kPut, "/items/:id", named("put"));
+  router.add(HttpRequest::kPost, "/items/new", named("new"));
+  router.add("/any", named("any"));
+  router.add(HttpRequest::kPost, "/any", named("post any"));
+
+  BOOST_CHECK(match(router, HttpRequest::kPut, "/items/1") == "put id=1");
+  BOOST_CHECK(match(router, HttpRequest::kHead, "/items/1") == "get id=1");
+  BOOST_CHECK(match(router, HttpRequest::kDelete, "/items/1") == "none");
+  // the parameter for another method
+  BOOST_CHECK(match(router, HttpRequest::kGet, "/items/new") == "get id=new");
+  BOOST_CHECK(match(router, HttpRequest::kPost, "/items/new") == "new");
+  BOOST_CHECK(match(router, HttpRequest::kDelete, "/any") == "any");
+  BOOST_CHECK(match(router, HttpRequest::kPost, "/any") == "post any");
+
+  HttpRequest req;
+  const char kDelete[] = "DELETE";
+  const char kPath[] = "/items/1";
+  req.setMethod(kDelete, kDelete + sizeof kDelete - 1);
+  req.setPath(kPath, kPath + sizeof kPath - 1);
+  HttpResponse resp(false);
+  router.route(req, &resp);
+  Buffer output;
+  resp.appendToBuffer(&output);
+  string response = output.retrieveAllAsString();
+  BOOST_CHECK(response.find("HTTP/1.1 405 Method Not Allowed\r\n") == 0);
+  BOOST_CHECK(response.find("\r\nAllow: GET, PUT\r\n") != string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(testNoAllocation)
+{
+  HttpRouter router;
+  router.add(HttpRequest::kGet, "/users/:id/posts/:post", named("post"));
+  router.add(HttpRequest::kGet, "/files/*path", named("file"));
+  router.add(HttpRequest::kGet, "/users/new", named("new"));
+
+  HttpRouter::Params params;
+  int allocations = g_allocations;
+  const HttpRouter::Handler* post = router.match(HttpRequest::kGet, "/users/42/posts/7", &params);
+  const HttpRouter::Handler* file = router.match(HttpRequest::kGet, "/files/a/b", &params);
+  const HttpRouter::Handler* none = router.match(HttpRequest::kGet, "/nothing", &params);
+  BOOST_CHECK(g_allocations == allocations);
+  BOOST_CHECK(post != NULL && file != NULL && none == NULL);
+}
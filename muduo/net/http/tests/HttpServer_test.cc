@@ -5,7 +5,6 @@
 #include "muduo/base/Logging.h"
 
 #include <iostream>
-#include <map>
 
 using namespace muduo;
 using namespace muduo::net;
@@ -15,13 +14,12 @@ bool benchmark = false;
 
 void onRequest(const HttpRequest& req, HttpResponse* resp)
 {
-  std::cout << "Headers " << req.methodString() << " " << req.path() << std::endl;
+  std::cout << "Headers " << req.methodString() << " " << req.path().as_string() << std::endl;
   if (!benchmark)
   {
-    const std::map<string, string>& headers = req.headers();
-    for (const auto& header : headers)
+    for (const auto& header : req.headers())
     {
-      std::cout << header.first << ": " << header.second << std::endl;
+      std::cout << header.field.as_string() << ": " << header.value.as_string() << std::endl;
     }
   }
 
@@ -0,0 +1,251 @@
+#include "muduo/net/http/HttpServer.h"
+#include "muduo/net/http/HttpRequest.h"
+#include "muduo/net/http/HttpResponse.h"
+#include "muduo/net/http/tests/HttpTestUtil.h"
+
+#include <algorithm>
+#include <memory>
+
+//#define BOOST_TEST_MODULE HttpServerTest
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+using namespace muduo;
+using namespace muduo::net;
+
+size_t g_streamed = 0;
+size_t g_maxPiece = 0;
+
+void onBody(const HttpRequest&, StringPiece data)
+{
+  g_streamed += data.size();
+  g_maxPiece = std::max(g_maxPiece, static_cast<size_t>(data.size()));
+}
+
+void onRequest(const HttpRequest& req, HttpResponse* resp)
+{
+  resp->setStatusCode(HttpResponse::k200Ok);
+  resp->setStatusMessage("OK");
+  if (req.path() == "/echo")
+  {
+    resp->setBody(req.body().as_string());
+  }
+  else if (req.path() == "/streamed")
+  {
+    resp->setBody(std::to_string(g_streamed));
+  }
+  else if (req.path() == "/big")
+  {
+    resp->setBody(string(1024 * 1024, 'z'));
+  }
+  else if (req.path() == "/chunked")
+  {
+    // 64 pieces of 64 KiB
+    resp->setBody("first ");
+    std::shared_ptr<int> written(new int(0));
+    resp->setChunkWriter([written](Buffer* piece)
+    {
+      piece->append(string(64 * 1024, static_cast<char>('a' + *written % 26)));
+      return ++*written < 64;
+    });
+  }
+  else
+  {
+    resp->setBody(req.path().as_string());
+  }
+}
+
+string exchange(const string& requests,
+                const HttpServer::HttpBodyCallback& bodyCallback = HttpServer::HttpBodyCallback())
+{
+  EventLoop loop;
+  InetAddress listenAddr("127.0.0.1", 2042);
+  HttpServer server(&loop, listenAddr, "HttpServer");
+  server.setHttpCallback(onRequest);
+  server.setHttpBodyCallback(bodyCallback);
+  server.setMaxBodySize(4 * 1024 * 1024);
+  server.start();
+  return exchange(&loop, listenAddr, requests);
+}
+
+int count(const string& str, const string& what)
+{
+  int n = 0;
+  for (size_t pos = str.find(what); pos != string::npos; pos = str.find(what, pos + 1))
+  {
+    ++n;
+  }
+  return n;
+}
+
+BOOST_AUTO_TEST_CASE(testPipelined)
+{
+  string received = exchange("GET /a HTTP/1.1\r\n\r\n"
+                             "GET /bb HTTP/1.1\r\nHost: localhost\r\n\r\n"
+                             "GET /ccc HTTP/1.1\r\nConnection: close\r\n\r\n");
+  BOOST_CHECK(count(received, "HTTP/1.1 200 OK\r\n") == 3);
+  // in order
+  size_t a = received.find("\r\n\r\n/a");
+  size_t b = received.find("\r\n\r\n/bb");
+  size_t c = received.find("\r\n\r\n/ccc");
+  BOOST_CHECK(a != string::npos && a < b && b != string::npos && b < c && c != string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(testCloseStopsPipeline)
+{
+  string received = exchange("GET /a HTTP/1.1\r\n\r\n"
+                             "GET /b HTTP/1.1\r\nConnection: close\r\n\r\n"
+                             "GET /c HTTP/1.1\r\n\r\n");
+  BOOST_CHECK(count(received, "HTTP/1.1 200 OK\r\n") == 2);
+  BOOST_CHECK(received.find("/c") == string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(testBadRequestAfterGood)
+{
+  string received = exchange("GET /a HTTP/1.1\r\n\r\n"
+                             "BREW /pot HTTP/1.1\r\n\r\n"
+                             "GET /c HTTP/1.1\r\n\r\n");
+  BOOST_CHECK(count(received, "HTTP/1.1 200 OK\r\n") == 1);
+  BOOST_CHECK(count(received, "HTTP/1.1 400 Bad Request\r\n") == 1);
+  BOOST_CHECK(received.find("/c") == string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(testBody)
+{
+  string received = exchange("POST /echo HTTP/1.1\r\nContent-Length: 5\r\n\r\nhello"
+                             "POST /echo HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n"
+                             "6\r\nworld!\r\n0\r\n\r\n"
+                             "GET /last HTTP/1.1\r\nConnection: close\r\n\r\n");
+  BOOST_CHECK(count(received, "HTTP/1.1 200 OK\r\n") == 3);
+  BOOST_CHECK(received.find("\r\n\r\nhello") != string::npos);
+  BOOST_CHECK(received.find("\r\n\r\nworld!") != string::npos);
+  BOOST_CHECK(received.find("\r\n\r\n/last") != string::npos);
+
+  // over the max body size
+  received = exchange("POST /echo HTTP/1.1\r\nContent-Length: 5000000\r\n\r\n");
+  BOOST_CHECK(received == "HTTP/1.1 413 Payload Too Large\r\n\r\n");
+
+  received = exchange("POST /echo HTTP/1.1\r\nContent-Length: 5\r\n"
+                      "Expect: 100-continue\r\nConnection: close\r\n\r\n");
+  BOOST_CHECK(received == "HTTP/1.1 100 Continue\r\n\r\n");
+}
+
+BOOST_AUTO_TEST_CASE(testStreamedBody)
+{
+  // 16 MiB, over the max body size, in pieces as they come
+  const size_t kBody = 16 * 1024 * 1024;
+  string requests = "POST /upload HTTP/1.1\r\nContent-Length: " + std::to_string(kBody) + "\r\n\r\n";
+  requests += string(kBody, 'x');
+  requests += "POST /upload HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n";
+  for (int i = 0; i < 16; ++i)
+  {
+    requests += "100000\r\n" + string(1024 * 1024, 'y') + "\r\n";
+  }
+  requests += "0\r\n\r\n";
+  requests += "GET /streamed HTTP/1.1\r\nConnection: close\r\n\r\n";
+
+  string received = exchange(requests, onBody);
+  BOOST_CHECK(count(received, "HTTP/1.1 200 OK\r\n") == 3);
+  BOOST_CHECK(received.find("\r\n\r\n" + std::to_string(2 * kBody)) != string::npos);
+  BOOST_CHECK(g_streamed == 2 * kBody);
+  // never buffered whole
+  BOOST_CHECK(g_maxPiece < kBody / 4);
+}
+
+BOOST_AUTO_TEST_CASE(testChunkedResponse)
+{
+  string received = exchange("GET /chunked HTTP/1.1\r\n\r\n"
+                             "GET /after HTTP/1.1\r\nConnection: close\r\n\r\n");
+  BOOST_CHECK(count(received, "HTTP/1.1 200 OK\r\n") == 2);
+  BOOST_CHECK(received.find("Transfer-Encoding: chunked\r\n") != string::npos);
+
+  // decode it
+  size_t pos = received.find("\r\n\r\n") + 4;
+  string body;
+  for (;;)
+  {
+    size_t crlf = received.find("\r\n", pos);
+    size_t size = strtoul(received.c_str() + pos, NULL, 16);
+    pos = crlf + 2;
+    if (size == 0)
+    {
+      BOOST_CHECK(received.compare(pos, 2, "\r\n") == 0);
+      pos += 2;
+      break;
+    }
+    body += received.substr(pos, size);
+    pos += size + 2;
+  }
+  BOOST_CHECK(body.size() == 6 + 64 * 64 * 1024);
+  BOOST_CHECK(body.compare(0, 7, "first a") == 0);
+  BOOST_CHECK(body[body.size() - 1] == 'a' + 63 % 26);
+  // the one behind it waited
+  BOOST_CHECK(received.compare(pos, 17, "HTTP/1.1 200 OK\r\n") == 0);
+  BOOST_CHECK(received.find("\r\n\r\n/after", pos) != string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(testChunkedHttp10)
+{
+  // sent as it is, ended by closing
+  string received = exchange("GET /chunked HTTP/1.0\r\n\r\n"
+                             "GET /after HTTP/1.0\r\n\r\n");
+  size_t pos = received.find("\r\n\r\n") + 4;
+  BOOST_CHECK(received.compare(0, 17, "HTTP/1.1 200 OK\r\n") == 0);
+  BOOST_CHECK(received.find("Transfer-Encoding") == string::npos);
+  BOOST_CHECK(received.find("Content-Length") == string::npos);
+  BOOST_CHECK(received.find("\r\nConnection: close\r\n") < pos);
+  string body = received.substr(pos);
+  BOOST_CHECK(body.size() == 6 + 64 * 64 * 1024);
+  BOOST_CHECK(body.compare(0, 7, "first a") == 0);
+  BOOST_CHECK(body[body.size() - 1] == 'a' + 63 % 26);
+}
+
+BOOST_AUTO_TEST_CASE(testResponseHead)
+{
+  // the example in RFC 7231
+  Timestamp now(Timestamp::fromUnixTime(784111777, 123));
+  Buffer output;
+  HttpResponse ok(false);
+  ok.setStatusCode(HttpResponse::k200Ok);
+  ok.setContentType("text/plain");
+  ok.addHeader("Server", "Muduo");
+  ok.addHeader("content-type", "text/html");
+  ok.setBody("hello");
+  ok.appendHeadToBuffer(&output, now);
+  BOOST_CHECK(output.retrieveAllAsString() ==
+         "HTTP/1.1 200 OK\r\n"
+         "Date: Sun, 06 Nov 1994 08:49:37 GMT\r\n"
+         "Content-Length: 5\r\n"
+         "Connection: Keep-Alive\r\n"
+         "Content-Type: text/html\r\n"
+         "Server: Muduo\r\n"
+         "\r\n");
+
+  HttpResponse custom(true);
+  custom.setStatusCode(HttpResponse::k404NotFound);
+  custom.setStatusMessage("Gone Fishing");
+  custom.appendToBuffer(&output);
+  BOOST_CHECK(output.retrieveAllAsString() ==
+         "HTTP/1.1 404 Gone Fishing\r\nContent-Length: 0\r\n"
+         "Connection: close\r\n\r\n");
+
+  HttpResponse empty(false);
+  empty.setStatusCode(HttpResponse::k204NoContent);
+  empty.appendToBuffer(&output);
+  BOOST_CHECK(output.retrieveAllAsString() ==
+         "HTTP/1.1 204 No Content\r\nConnection: Keep-Alive\r\n\r\n");
+}
+
+BOOST_AUTO_TEST_CASE(testLargeBody)
+{
+  string received = exchange("GET /big HTTP/1.1\r\n\r\n"
+                             "GET /after HTTP/1.1\r\nConnection: close\r\n\r\n");
+  BOOST_CHECK(count(received, "HTTP/1.1 200 OK\r\n") == 2);
+  BOOST_CHECK(count(received, "GMT\r\n") == 2);
+  BOOST_CHECK(received.find("Content-Length: 1048576\r\n") != string::npos);
+  size_t body = received.find("\r\n\r\n") + 4;
+  BOOST_CHECK(received.find_first_not_of('z', body) == body + 1024 * 1024);
+  BOOST_CHECK(received.compare(body + 1024 * 1024, 17, "HTTP/1.1 200 OK\r\n") == 0);
+  BOOST_CHECK(received.find("\r\n\r\n/after") != string::npos);
+}
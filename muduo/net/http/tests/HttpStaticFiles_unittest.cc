@@ -0,0 +1,245 @@
+#include "muduo/net/http/HttpStaticFiles.h"
+#include "muduo/net/http/HttpServer.h"
+#include "muduo/net/http/HttpRequest.h"
+#include "muduo/net/http/HttpResponse.h"
+#include "muduo/net/http/tests/HttpTestUtil.h"
+
+#include <stdio.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+//#define BOOST_TEST_MODULE HttpStaticFilesTest
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "muduo/base/tests/TempDir.h"
+
+using namespace muduo;
+using namespace muduo::net;
+
+HttpStaticFiles* g_files = NULL;
+
+void onRequest(const HttpRequest& req, HttpResponse* resp)
+{
+  if (!g_files->serve(req, resp))
+  {
+    resp->setStatusCode(HttpResponse::k404NotFound);
+  }
+}
+
+string exchange(const string& requests)
+{
+  EventLoop loop;
+  InetAddress listenAddr("127.0.0.1", 2044);
+  HttpServer server(&loop, listenAddr, "HttpServer");
+  server.setHttpCallback(onRequest);
+  server.start();
+  return exchange(&loop, listenAddr, requests);
+}
+
+string get(const string& path, const string& headers = "")
+{
+  return exchange("GET " + path + " HTTP/1.1\r\n" + headers + "Connection: close\r\n\r\n");
+}
+
+// the value of a header in the first response
+string header(const string& response, const string& field)
+{
+  size_t pos = response.find("\r\n" + field + ": ");
+  if (pos == string::npos || pos > response.find("\r\n\r\n"))
+  {
+    return "";
+  }
+  pos += field.size() + 4;
+  return response.substr(pos, response.find("\r\n", pos) - pos);
+}
+
+string body(const string& response)
+{
+  size_t pos = response.find("\r\n\r\n");
+  return pos == string::npos ? "" : response.substr(pos + 4);
+}
+
+void writeFile(const string& name, const string& content)
+{
+  FILE* fp = ::fopen(name.c_str(), "w");
+  ::fwrite(content.data(), 1, content.size(), fp);
+  ::fclose(fp);
+}
+
+string bigContent()
+{
+  string content;
+  for (int i = 0; content.size() < 3 * 1024 * 1024; ++i)
+  {
+    content += std::to_string(i) + " a line of a large file\n";
+  }
+  return content;
+}
+
+// the files served, in a temporary directory, for all test cases
+struct DocumentRoot : TempDir
+{
+  DocumentRoot()
+  {
+    writeFile("hello.txt", "hello, world!\n");
+    writeFile("index.html", "<html>\n");
+    writeFile("big.log", bigContent());
+    writeFile(".hidden", "secret");
+    ::mkdir("sub", 0755);
+    writeFile("sub/index.html", "<html>\n");
+    files.reset(new HttpStaticFiles(dir));
+    g_files = get_pointer(files);
+  }
+
+  ~DocumentRoot()
+  {
+    files.reset();
+    ::unlink("hello.txt");
+    ::unlink("index.html");
+    ::unlink("big.log");
+    ::unlink(".hidden");
+    ::unlink("sub/index.html");
+    ::rmdir("sub");
+  }
+
+  std::unique_ptr<HttpStaticFiles> files;
+};
+
+BOOST_GLOBAL_FIXTURE(DocumentRoot);
+
+BOOST_AUTO_TEST_CASE(testSmallFile)
+{
+  int64_t opened = g_files->openedFiles();
+  string received = exchange("GET /hello.txt HTTP/1.1\r\n\r\n"
+                             "GET /hello.txt HTTP/1.1\r\nConnection: close\r\n\r\n");
+  BOOST_CHECK(received.compare(0, 17, "HTTP/1.1 200 OK\r\n") == 0);
+  BOOST_CHECK(header(received, "Content-Type") == "text/plain; charset=utf-8");
+  BOOST_CHECK(header(received, "Content-Length") == "14");
+  BOOST_CHECK(header(received, "Accept-Ranges") == "bytes");
+  BOOST_CHECK(!header(received, "ETag").empty());
+  BOOST_CHECK(header(received, "Last-Modified").find(" GMT") != string::npos);
+  BOOST_CHECK(body(received).compare(0, 14, "hello, world!\n") == 0);
+  // read once, kept in memory
+  BOOST_CHECK(g_files->openedFiles() == opened + 1);
+  BOOST_CHECK(g_files->cachedBytes() >= 14);
+}
+
+BOOST_AUTO_TEST_CASE(testLargeFile)
+{
+  string content = bigContent();
+  size_t cachedBytes = g_files->cachedBytes();
+  string received = exchange("GET /big.log HTTP/1.1\r\n\r\n"
+                             "GET /index.html HTTP/1.1\r\nConnection: close\r\n\r\n");
+  BOOST_CHECK(header(received, "Content-Length") == std::to_string(content.size()));
+  BOOST_CHECK(header(received, "Content-Type") == "application/octet-stream");
+  size_t pos = received.find("\r\n\r\n") + 4;
+  BOOST_CHECK(received.compare(pos, content.size(), content) == 0);
+  // the one behind it
+  BOOST_CHECK(received.compare(pos + content.size(), 17, "HTTP/1.1 200 OK\r\n") == 0);
+  BOOST_CHECK(received.find("\r\n\r\n<html>", pos) != string::npos);
+  // sent from the file
+  BOOST_CHECK(g_files->cachedBytes() == cachedBytes + 7);
+}
+
+BOOST_AUTO_TEST_CASE(testNotModified)
+{
+  string etag = header(get("/big.log"), "ETag");
+  string received = get("/big.log", "If-None-Match: W/" + etag + "\r\n");
+  BOOST_CHECK(received.compare(0, 27, "HTTP/1.1 304 Not Modified\r\n") == 0);
+  BOOST_CHECK(header(received, "Content-Length").empty());
+  BOOST_CHECK(body(received).empty());
+  received = get("/big.log", "If-None-Match: \"0-0\"\r\n");
+  BOOST_CHECK(received.compare(0, 17, "HTTP/1.1 200 OK\r\n") == 0);
+}
+
+BOOST_AUTO_TEST_CASE(testRange)
+{
+  string content = bigContent();
+  string received = get("/big.log", "Range: bytes=1000000-1000009\r\n");
+  BOOST_CHECK(received.compare(0, 30, "HTTP/1.1 206 Partial Content\r\n") == 0);
+  BOOST_CHECK(header(received, "Content-Range") ==
+         "bytes 1000000-1000009/" + std::to_string(content.size()));
+  BOOST_CHECK(body(received) == content.substr(1000000, 10));
+
+  received = get("/hello.txt", "Range: bytes=-6\r\n");
+  BOOST_CHECK(header(received, "Content-Range") == "bytes 8-13/14");
+  BOOST_CHECK(body(received) == "orld!\n");
+
+  received = get("/hello.txt", "Range: bytes=7-\r\n");
+  BOOST_CHECK(body(received) == "world!\n");
+
+  received = get("/hello.txt", "Range: bytes=14-\r\n");
+  BOOST_CHECK(received.compare(0, 36, "HTTP/1.1 416 Range Not Satisfiable\r\n") == 0);
+  BOOST_CHECK(header(received, "Content-Range") == "bytes */14");
+
+  // several ranges, the whole file
+  received = get("/hello.txt", "Range: bytes=0-1,3-4\r\n");
+  BOOST_CHECK(body(received) == "hello, world!\n");
+
+  received = exchange("HEAD /big.log HTTP/1.1\r\nConnection: close\r\n\r\n");
+  BOOST_CHECK(header(received, "Content-Length") == std::to_string(content.size()));
+  BOOST_CHECK(body(received).empty());
+}
+
+BOOST_AUTO_TEST_CASE(testNotFound)
+{
+  const char* paths[] = { "/nothing", "/../etc/passwd", "/%2e%2e/etc/passwd",
+                          "/.hidden", "/sub/../hello.txt", "/hello.txt%00" };
+  for (const char* path : paths)
+  {
+    BOOST_CHECK(get(path).compare(0, 24, "HTTP/1.1 404 Not Found\r\n") == 0);
+  }
+  BOOST_CHECK(get("/").compare(0, 17, "HTTP/1.1 200 OK\r\n") == 0);
+  BOOST_CHECK(get("/sub/").compare(0, 17, "HTTP/1.1 200 OK\r\n") == 0);
+  BOOST_CHECK(body(get("/hello%2etxt")) == "hello, world!\n");
+}
+
+BOOST_AUTO_TEST_CASE(testChanged)
+{
+  g_files->setValidSeconds(0);
+  writeFile("changed.txt", "before");
+  BOOST_CHECK(body(get("/changed.txt")) == "before");
+  writeFile("changed.txt", "and after");
+  BOOST_CHECK(body(get("/changed.txt")) == "and after");
+  // rewritten at once with the same size
+  string etag = header(get("/changed.txt"), "ETag");
+  writeFile("changed.txt", "and later");
+  string received = get("/changed.txt", "If-None-Match: " + etag + "\r\n");
+  BOOST_CHECK(header(received, "ETag") != etag);
+  BOOST_CHECK(body(received) == "and later");
+  ::unlink("changed.txt");
+  BOOST_CHECK(get("/changed.txt").compare(0, 24, "HTTP/1.1 404 Not Found\r\n") == 0);
+  g_files->setValidSeconds(1.0);
+}
+
+BOOST_AUTO_TEST_CASE(testEviction)
+{
+  HttpStaticFiles* shared = g_files;
+  HttpStaticFiles files(".");
+  files.setMaxOpenFiles(2);
+  files.setMaxCachedBytes(32);
+  g_files = &files;
+  get("/hello.txt");
+  get("/index.html");
+  BOOST_CHECK(files.cachedFiles() == 2);
+  BOOST_CHECK(files.cachedBytes() == 14 + 7);
+  // a fresh hit doesn't move it
+  get("/hello.txt");
+  get("/big.log");
+  // the least recently validated goes
+  BOOST_CHECK(files.cachedFiles() == 2);
+  BOOST_CHECK(files.cachedBytes() == 7);
+  get("/hello.txt");
+  BOOST_CHECK(files.cachedBytes() == 14);
+  BOOST_CHECK(files.openedFiles() == 4);
+
+  // over the bytes
+  files.setMaxOpenFiles(10);
+  files.setMaxCachedBytes(16);
+  get("/index.html");
+  BOOST_CHECK(files.cachedBytes() == 7);
+  BOOST_CHECK(files.cachedFiles() == 2);
+  g_files = shared;
+}
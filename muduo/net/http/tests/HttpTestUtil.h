@@ -0,0 +1,48 @@
+#ifndef MUDUO_NET_HTTP_TESTS_HTTPTESTUTIL_H
+#define MUDUO_NET_HTTP_TESTS_HTTPTESTUTIL_H
+
+#include "muduo/net/EventLoop.h"
+#include "muduo/net/TcpClient.h"
+
+namespace muduo
+{
+namespace net
+{
+
+// Sends requests to the server listening on serverAddr in loop, in one
+// write, returns what the server sends back until it closes the
+// connection, or the client does after two seconds.  Both ends of the
+// connection are closed when it returns.
+inline string exchange(EventLoop* loop,
+                       const InetAddress& serverAddr,
+                       const string& requests)
+{
+  string received;
+  TcpClient client(loop, serverAddr, "Client");
+  client.setConnectionCallback([&](const TcpConnectionPtr& conn)
+  {
+    if (conn->connected())
+    {
+      conn->send(requests);
+    }
+    else
+    {
+      loop->quit();
+    }
+  });
+  client.setMessageCallback([&](const TcpConnectionPtr&, Buffer* buf, Timestamp)
+  {
+    received += buf->retrieveAllAsString();
+  });
+  client.connect();
+  // the server closes its end on EOF
+  TimerId timeout = loop->runAfter(2.0, [&client] { client.disconnect(); });
+  loop->loop();
+  loop->cancel(timeout);
+  return received;
+}
+
+}  // namespace net
+}  // namespace muduo
+
+#endif  // MUDUO_NET_HTTP_TESTS_HTTPTESTUTIL_H
@@ -18,11 +18,8 @@
 #include "muduo/net/inspect/PerformanceInspector.h"
 #include "muduo/net/inspect/SystemInspector.h"
 
-//#include <iostream>
-//#include <iterator>
-//#include <sstream>
-//#include <boost/algorithm/string/classification.hpp>
-//#include <boost/algorithm/string/split.hpp>
+#include <algorithm>
+#include <memory>
 
 using namespace muduo;
 using namespace muduo::net;
@@ -31,28 +28,27 @@ namespace
 {
 Inspector* g_globalInspector = 0;
 
-// Looks buggy
-std::vector<string> split(const string& str)
+// /module/command/args...
+void runCommand(const Inspector::Callback& cb,
+                const HttpRequest& req,
+                const HttpRouter::Params& params,
+                HttpResponse* resp)
 {
-  std::vector<string> result;
-  size_t start = 0;
-  size_t pos = str.find('/');
-  while (pos != string::npos)
+  Inspector::ArgList args;
+  StringPiece rest = params.get("args");
+  while (!rest.empty())
   {
-    if (pos > start)
+    const char* slash = std::find(rest.begin(), rest.end(), '/');
+    if (slash > rest.begin())
     {
-      result.push_back(str.substr(start, pos-start));
+      args.push_back(string(rest.begin(), slash));
     }
-    start = pos+1;
-    pos = str.find('/', start);
+    rest.remove_prefix(static_cast<int>(slash - rest.begin()) + (slash < rest.end() ? 1 : 0));
   }
-
-  if (start < str.length())
-  {
-    result.push_back(str.substr(start));
-  }
-
-  return result;
+  resp->setStatusCode(HttpResponse::k200Ok);
+  resp->setStatusMessage("OK");
+  resp->setContentType("text/plain");
+  resp->setBody(cb(req.method(), args));
 }
 
 }  // namespace
@@ -70,6 +66,10 @@ Inspector::Inspector(EventLoop* loop,
   assert(g_globalInspector == 0);
   g_globalInspector = this;
   server_.setHttpCallback(std::bind(&Inspector::onRequest, this, _1, _2));
+  {
+    MutexLockGuard lock(mutex_);
+    updateRouter();
+  }
   processInspector_->registerCommands(this);
   systemInspector_->registerCommands(this);
 #ifdef HAVE_TCMALLOC
@@ -93,6 +93,7 @@ void Inspector::add(const string& module,
   MutexLockGuard lock(mutex_);
   modules_[module][command] = cb;
   helps_[module][command] = help;
+  updateRouter();
 }
 
 void Inspector::remove(const string& module, const string& command)
@@ -103,6 +104,7 @@ void Inspector::remove(const string& module, const string& command)
   {
     it->second.erase(command);
     helps_[module].erase(command);
+    updateRouter();
   }
 }
 
@@ -113,94 +115,67 @@ void Inspector::start()
 
 void Inspector::onRequest(const HttpRequest& req, HttpResponse* resp)
 {
-  if (req.path() == "/")
+  std::shared_ptr<const HttpRouter> router = std::atomic_load(&router_);
+  router->route(req, resp);
+}
+
+// Commands are few and seldom change, requests don't look them up under
+// the lock but route with the router built here.
+void Inspector::updateRouter()
+{
+  string result;
+  for (std::map<string, HelpList>::const_iterator helpListI = helps_.begin();
+       helpListI != helps_.end();
+       ++helpListI)
   {
-    string result;
-    MutexLockGuard lock(mutex_);
-    for (std::map<string, HelpList>::const_iterator helpListI = helps_.begin();
-         helpListI != helps_.end();
-         ++helpListI)
+    const HelpList& list = helpListI->second;
+    for (const auto& it : list)
     {
-      const HelpList& list = helpListI->second;
-      for (const auto& it : list)
-      {
-        result += "/";
-        result += helpListI->first;
-        result += "/";
-        result += it.first;
-        size_t len = helpListI->first.size() + it.first.size();
-        result += string(len >= 25 ? 1 : 25 - len, ' ');
-        result += it.second;
-        result += "\n";
-      }
+      result += "/";
+      result += helpListI->first;
+      result += "/";
+      result += it.first;
+      size_t len = helpListI->first.size() + it.first.size();
+      result += string(len >= 25 ? 1 : 25 - len, ' ');
+      result += it.second;
+      result += "\n";
     }
+  }
+
+  std::shared_ptr<HttpRouter> router(new HttpRouter);
+  router->add("/", [result](const HttpRequest&, const HttpRouter::Params&, HttpResponse* resp)
+  {
     resp->setStatusCode(HttpResponse::k200Ok);
     resp->setStatusMessage("OK");
     resp->setContentType("text/plain");
     resp->setBody(result);
-  }
-  else
+  });
+  router->add("/favicon.ico", [](const HttpRequest&, const HttpRouter::Params&, HttpResponse* resp)
   {
-    std::vector<string> result = split(req.path());
-    // boost::split(result, req.path(), boost::is_any_of("/"));
-    //std::copy(result.begin(), result.end(), std::ostream_iterator<string>(std::cout, ", "));
-    //std::cout << "\n";
-    bool ok = false;
-    if (result.size() == 0)
-    {
-      LOG_DEBUG << req.path();
-    }
-    else if (result.size() == 1)
-    {
-      string module = result[0];
-      if (module == "favicon.ico")
-      {
-        resp->setStatusCode(HttpResponse::k200Ok);
-        resp->setStatusMessage("OK");
-        resp->setContentType("image/png");
-        resp->setBody(string(favicon, sizeof favicon));
-
-        ok = true;
-      }
-      else
-      {
-        LOG_ERROR << "Unimplemented " << module;
-      }
-    }
-    else
+    resp->setStatusCode(HttpResponse::k200Ok);
+    resp->setStatusMessage("OK");
+    resp->setContentType("image/png");
+    resp->setBody(string(favicon, sizeof favicon));
+  });
+  for (const auto& module : modules_)
+  {
+    for (const auto& command : module.second)
     {
-      string module = result[0];
-      MutexLockGuard lock(mutex_);
-      std::map<string, CommandList>::const_iterator commListI = modules_.find(module);
-      if (commListI != modules_.end())
+      if (command.second)
       {
-        string command = result[1];
-        const CommandList& commList = commListI->second;
-        CommandList::const_iterator it = commList.find(command);
-        if (it != commList.end())
-        {
-          ArgList args(result.begin()+2, result.end());
-          if (it->second)
-          {
-            resp->setStatusCode(HttpResponse::k200Ok);
-            resp->setStatusMessage("OK");
-            resp->setContentType("text/plain");
-            const Callback& cb = it->second;
-            resp->setBody(cb(req.method(), args));
-            ok = true;
-          }
-        }
+        string path = "/" + module.first + "/" + command.first;
+        HttpRouter::Handler handler = std::bind(runCommand, command.second, _1, _2, _3);
+        router->add(path, handler);
+        router->add(path + "/*args", handler);
       }
-
     }
-
-    if (!ok)
-    {
-      resp->setStatusCode(HttpResponse::k404NotFound);
-      resp->setStatusMessage("Not Found");
-    }
-    //resp->setCloseConnection(true);
   }
+  router->setNotFound([](const HttpRequest&, const HttpRouter::Params&, HttpResponse* resp)
+  {
+    resp->setStatusCode(HttpResponse::k404NotFound);
+    resp->setStatusMessage("Not Found");
+  });
+  std::atomic_store(&router_, std::shared_ptr<const HttpRouter>(router));
 }
 
 char favicon[1743] =
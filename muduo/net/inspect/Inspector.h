@@ -13,6 +13,7 @@
 
 #include "muduo/base/Mutex.h"
 #include "muduo/net/http/HttpRequest.h"
+#include "muduo/net/http/HttpRouter.h"
 #include "muduo/net/http/HttpServer.h"
 
 #include <map>
@@ -51,6 +52,7 @@ class Inspector : noncopyable
 
   void start();
   void onRequest(const HttpRequest& req, HttpResponse* resp);
+  void updateRouter() REQUIRES(mutex_);
 
   HttpServer server_;
   std::unique_ptr<ProcessInspector> processInspector_;
@@ -59,6 +61,9 @@ class Inspector : noncopyable
   MutexLock mutex_;
   std::map<string, CommandList> modules_ GUARDED_BY(mutex_);
   std::map<string, HelpList> helps_ GUARDED_BY(mutex_);
+  // rebuilt by add() and remove() under mutex_, published and read with
+  // std::atomic_store() and std::atomic_load(), requests take no lock
+  std::shared_ptr<const HttpRouter> router_;
 };
 
 }  // namespace net
@@ -17,6 +17,12 @@
 using namespace muduo;
 using namespace muduo::net;
 
+namespace
+{
+const ContextSlot<RpcChannelPtr> kRpcChannelSlot =
+    ConnectionContexts::registerSlot<RpcChannelPtr>();
+}  // namespace
+
 RpcServer::RpcServer(EventLoop* loop,
                      const InetAddress& listenAddr)
   : server_(loop, listenAddr, "RpcServer")
@@ -49,11 +55,11 @@ void RpcServer::onConnection(const TcpConnectionPtr& conn)
     channel->setServices(&services_);
     conn->setMessageCallback(
         std::bind(&RpcChannel::onMessage, get_pointer(channel), _1, _2, _3));
-    conn->setContext(channel);
+    conn->emplaceContext(kRpcChannelSlot, channel);
   }
   else
   {
-    conn->setContext(RpcChannelPtr());
+    conn->resetContext(kRpcChannelSlot);
     // FIXME:
   }
 }
@@ -62,7 +68,7 @@ void RpcServer::onConnection(const TcpConnectionPtr& conn)
 //                           Buffer* buf,
 //                           Timestamp time)
 // {
-//   RpcChannelPtr& channel = boost::any_cast<RpcChannelPtr&>(conn->getContext());
+//   RpcChannelPtr& channel = *conn->context(kRpcChannelSlot);
 //   channel->onMessage(conn, buf, time);
 // }
 
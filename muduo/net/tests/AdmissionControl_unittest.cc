@@ -0,0 +1,205 @@
+#include "muduo/net/TcpServer.h"
+
+#include "muduo/base/Logging.h"
+#include "muduo/net/EventLoop.h"
+#include "muduo/net/EventLoopThread.h"
+
+#include <vector>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+//#define BOOST_TEST_MODULE AdmissionControlTest
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+using namespace muduo;
+using namespace muduo::net;
+
+struct Counter
+{
+  AtomicInt32 up;
+  AtomicInt32 down;
+
+  void onConnection(const TcpConnectionPtr& conn)
+  {
+    if (conn->connected())
+      up.increment();
+    else
+      down.increment();
+  }
+};
+
+int connectTo(uint16_t port)
+{
+  InetAddress serverAddr("127.0.0.1", port);
+  int sockfd = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  // completes in the kernel backlog even if the server is paused
+  int ret = ::connect(sockfd, serverAddr.getSockAddr(),
+                      static_cast<socklen_t>(sizeof(struct sockaddr_in)));
+  BOOST_CHECK(ret == 0);
+  return sockfd;
+}
+
+void closeAll(std::vector<int>* sockfds)
+{
+  for (int sockfd : *sockfds)
+  {
+    ::close(sockfd);
+  }
+  sockfds->clear();
+}
+
+// the servers run in another thread, so the test can block
+struct ServerLoop
+{
+  ServerLoop()
+    : loop(loopThread.startLoop())
+  {
+    Logger::setLogLevel(Logger::WARN);
+  }
+
+  EventLoopThread loopThread;
+  EventLoop* loop;
+};
+
+BOOST_FIXTURE_TEST_CASE(testMaxConnections, ServerLoop)
+{
+  const uint16_t port = 2036;
+  Counter counter;
+  std::unique_ptr<TcpServer> server;
+  loop->runInLoop([&]
+  {
+    server.reset(new TcpServer(loop, InetAddress("127.0.0.1", port), "MaxConn"));
+    server->setConnectionCallback(std::bind(&Counter::onConnection, &counter, _1));
+    server->setMaxConnections(3);
+    server->start();
+  });
+  usleep(100 * 1000);
+
+  std::vector<int> sockfds;
+  for (int i = 0; i < 5; ++i)
+  {
+    sockfds.push_back(connectTo(port));
+  }
+  usleep(200 * 1000);
+  BOOST_CHECK(counter.up.get() == 3);
+
+  // one leaves, one more is taken from the backlog
+  ::close(sockfds.front());
+  sockfds.erase(sockfds.begin());
+  usleep(200 * 1000);
+  BOOST_CHECK(counter.down.get() == 1);
+  BOOST_CHECK(counter.up.get() == 4);
+
+  closeAll(&sockfds);
+  usleep(200 * 1000);
+  BOOST_CHECK(counter.up.get() == 5);
+  loop->runInLoop([&] { server.reset(); });
+  usleep(100 * 1000);
+}
+
+BOOST_FIXTURE_TEST_CASE(testMaxConnectionsPerIp, ServerLoop)
+{
+  const uint16_t port = 2037;
+  Counter counter;
+  std::unique_ptr<TcpServer> server;
+  loop->runInLoop([&]
+  {
+    server.reset(new TcpServer(loop, InetAddress("127.0.0.1", port), "PerIp"));
+    server->setConnectionCallback(std::bind(&Counter::onConnection, &counter, _1));
+    server->setMaxConnectionsPerIp(2);
+    server->start();
+  });
+  usleep(100 * 1000);
+
+  std::vector<int> sockfds;
+  for (int i = 0; i < 3; ++i)
+  {
+    sockfds.push_back(connectTo(port));
+  }
+  usleep(200 * 1000);
+  BOOST_CHECK(counter.up.get() == 2);
+  // the third one is closed by the server
+  char buf[16];
+  BOOST_CHECK(::read(sockfds.back(), buf, sizeof buf) == 0);
+
+  // a slot is freed when one leaves
+  ::close(sockfds.front());
+  usleep(200 * 1000);
+  sockfds.push_back(connectTo(port));
+  usleep(200 * 1000);
+  BOOST_CHECK(counter.up.get() == 3);
+
+  closeAll(&sockfds);
+  loop->runInLoop([&] { server.reset(); });
+  usleep(100 * 1000);
+}
+
+BOOST_FIXTURE_TEST_CASE(testAcceptRate, ServerLoop)
+{
+  const uint16_t port = 2038;
+  Counter counter;
+  std::unique_ptr<TcpServer> server;
+  loop->runInLoop([&]
+  {
+    server.reset(new TcpServer(loop, InetAddress("127.0.0.1", port), "Rate"));
+    server->setConnectionCallback(std::bind(&Counter::onConnection, &counter, _1));
+    server->setAcceptRate(10.0, 2);
+    server->start();
+  });
+  usleep(100 * 1000);
+
+  std::vector<int> sockfds;
+  for (int i = 0; i < 6; ++i)
+  {
+    sockfds.push_back(connectTo(port));
+  }
+  usleep(50 * 1000);
+  // the burst goes through, the rest trickle in at 10/s
+  int burst = counter.up.get();
+  BOOST_CHECK(burst >= 2 && burst <= 3);
+  usleep(800 * 1000);
+  BOOST_CHECK(counter.up.get() == 6);
+
+  closeAll(&sockfds);
+  loop->runInLoop([&] { server.reset(); });
+  usleep(100 * 1000);
+}
+
+BOOST_FIXTURE_TEST_CASE(testRejectedKeepTokens, ServerLoop)
+{
+  const uint16_t port = 2048;
+  Counter counter;
+  std::unique_ptr<TcpServer> server;
+  loop->runInLoop([&]
+  {
+    server.reset(new TcpServer(loop, InetAddress("127.0.0.1", port), "Both"));
+    server->setConnectionCallback(std::bind(&Counter::onConnection, &counter, _1));
+    server->setMaxConnectionsPerIp(1);
+    server->setAcceptRate(0.5, 2);
+    server->start();
+  });
+  usleep(100 * 1000);
+
+  std::vector<int> sockfds;
+  for (int i = 0; i < 4; ++i)
+  {
+    sockfds.push_back(connectTo(port));
+  }
+  usleep(200 * 1000);
+  BOOST_CHECK(counter.up.get() == 1);
+
+  // over the cap, closed without spending a token, one is left
+  ::close(sockfds.front());
+  sockfds.erase(sockfds.begin());
+  usleep(200 * 1000);
+  sockfds.push_back(connectTo(port));
+  usleep(200 * 1000);
+  BOOST_CHECK(counter.up.get() == 2);
+
+  closeAll(&sockfds);
+  loop->runInLoop([&] { server.reset(); });
+  usleep(100 * 1000);
+}
@@ -152,6 +152,65 @@ BOOST_AUTO_TEST_CASE(testBufferFindEOL)
   BOOST_CHECK_EQUAL(buf.findEOL(buf.peek()+90000), null);
 }
 
+BOOST_AUTO_TEST_CASE(testBufferFindCRLF)
+{
+  Buffer buf;
+  buf.append(string(100000, 'x'));
+  const char* null = NULL;
+  BOOST_CHECK_EQUAL(buf.findCRLF(), null);
+  BOOST_CHECK_EQUAL(buf.findCRLF(buf.peek()+90000), null);
+
+  // every position and length, across block boundaries,
+  // with lone CRs and LFs around
+  for (int len = 0; len < 100; ++len)
+  {
+    for (int pos = 0; pos + 1 < len; ++pos)
+    {
+      string data(len, 'x');
+      if (pos > 0) data[pos-1] = '\r';
+      data[pos] = '\r';
+      data[pos+1] = '\n';
+      if (pos + 2 < len) data[pos+2] = '\n';
+      const char* crlf = Buffer::findCRLF(data.data(), data.data() + len);
+      BOOST_CHECK_EQUAL(crlf, data.data() + pos);
+      // just before it
+      crlf = Buffer::findCRLF(data.data(), data.data() + pos + 1);
+      BOOST_CHECK_EQUAL(crlf, null);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testBufferFindAnyOf)
+{
+  const char* null = NULL;
+  for (int len = 0; len < 100; ++len)
+  {
+    string data(len, 'x');
+    BOOST_CHECK_EQUAL(Buffer::findAnyOf(data.data(), data.data() + len, " ?"), null);
+    for (int pos = 0; pos < len; ++pos)
+    {
+      data.assign(len, 'x');
+      data[pos] = '?';
+      for (int after = pos + 1; after < len; after += 7)
+      {
+        data[after] = ' ';
+      }
+      BOOST_CHECK_EQUAL(Buffer::findAnyOf(data.data(), data.data() + len, " ?"),
+                        data.data() + pos);
+      BOOST_CHECK_EQUAL(Buffer::findAnyOf(data.data(), data.data() + len, "?"),
+                        data.data() + pos);
+      BOOST_CHECK_EQUAL(Buffer::findAnyOf(data.data(), data.data() + pos, " ?"), null);
+    }
+  }
+
+  // 16 of them, and a high byte
+  string data(64, 'x');
+  data[40] = '\xFF';
+  BOOST_CHECK_EQUAL(Buffer::findAnyOf(data.data(), data.data() + data.size(),
+                                      "0123456789abc\xFF:;"),
+                    data.data() + 40);
+}
+
 void output(Buffer&& buf, const void* inner)
 {
   Buffer newbuf(std::move(buf));
@@ -38,12 +38,12 @@ void readTimerfd(int timerfd, Timestamp now);
 class PeriodicTimer
 {
  public:
-  PeriodicTimer(EventLoop* loop, double interval, const TimerCallback& cb)
+  PeriodicTimer(EventLoop* loop, double interval, TimerCallback cb)
     : loop_(loop),
       timerfd_(muduo::net::detail::createTimerfd()),
       timerfdChannel_(loop, timerfd_),
       interval_(interval),
-      cb_(cb)
+      cb_(std::move(cb))
   {
     timerfdChannel_.setReadCallback(
         std::bind(&PeriodicTimer::handleRead, this));
@@ -0,0 +1,126 @@
+#include "muduo/net/ConnectionContext.h"
+
+#include <memory>
+#include <string>
+
+#include <stdlib.h>
+
+//#define BOOST_TEST_MODULE ConnectionContextTest
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+using muduo::net::ConnectionContexts;
+using muduo::net::ContextSlot;
+
+int g_allocations = 0;
+
+void* operator new(size_t size)
+{
+  ++g_allocations;
+  void* p = malloc(size);
+  if (p == NULL)
+    throw std::bad_alloc();
+  return p;
+}
+
+void operator delete(void* p) noexcept
+{
+  free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+  free(p);
+}
+
+struct Session
+{
+  static int alive;
+  Session(int i, const char* n) : id(i), name(n) { ++alive; }
+  ~Session() { --alive; }
+  int id;
+  const char* name;
+};
+int Session::alive = 0;
+
+struct Huge
+{
+  static int alive;
+  Huge() { ++alive; buf[0] = 'h'; }
+  ~Huge() { --alive; }
+  char buf[ConnectionContexts::kInlineSize + 1];
+};
+int Huge::alive = 0;
+
+const ContextSlot<Session> kSessionSlot = ConnectionContexts::registerSlot<Session>();
+const ContextSlot<int64_t> kCounterSlot = ConnectionContexts::registerSlot<int64_t>();
+const ContextSlot<Huge> kHugeSlot = ConnectionContexts::registerSlot<Huge>();
+const ContextSlot<std::shared_ptr<int>> kSharedSlot =
+    ConnectionContexts::registerSlot<std::shared_ptr<int>>();
+
+BOOST_AUTO_TEST_CASE(testRegister)
+{
+  BOOST_CHECK(kSessionSlot.valid() && kHugeSlot.valid());
+  BOOST_CHECK(!ContextSlot<Session>().valid());
+}
+
+BOOST_AUTO_TEST_CASE(testInline)
+{
+  int before = g_allocations;
+  {
+    ConnectionContexts contexts;
+    BOOST_CHECK(!contexts.has(kSessionSlot));
+    Session* session = contexts.emplace(kSessionSlot, 42, "http");
+    BOOST_CHECK(contexts.has(kSessionSlot));
+    BOOST_CHECK(contexts.get(kSessionSlot) == session);
+    BOOST_CHECK(session->id == 42);
+    *contexts.emplace(kCounterSlot, 0) += 5;
+    ++*contexts.get(kCounterSlot);
+    BOOST_CHECK(*contexts.get(kCounterSlot) == 6);
+    BOOST_CHECK(contexts.get(kSessionSlot)->id == 42);
+    BOOST_CHECK(Session::alive == 1);
+
+    // replacing destroys the old one
+    contexts.emplace(kSessionSlot, 43, "rpc");
+    BOOST_CHECK(Session::alive == 1);
+    BOOST_CHECK(contexts.get(kSessionSlot)->id == 43);
+
+    contexts.reset(kSessionSlot);
+    BOOST_CHECK(!contexts.has(kSessionSlot));
+    BOOST_CHECK(Session::alive == 0);
+    contexts.reset(kSessionSlot);
+
+    contexts.emplace(kSessionSlot, 44, "again");
+  }
+  // destroyed with the contexts
+  BOOST_CHECK(Session::alive == 0);
+  BOOST_CHECK(g_allocations == before);
+}
+
+BOOST_AUTO_TEST_CASE(testHeap)
+{
+  int before = g_allocations;
+  {
+    ConnectionContexts contexts;
+    Huge* huge = contexts.emplace(kHugeSlot);
+    BOOST_CHECK(g_allocations == before + 1);
+    BOOST_CHECK(contexts.get(kHugeSlot) == huge && huge->buf[0] == 'h');
+    BOOST_CHECK(Huge::alive == 1);
+    contexts.emplace(kSessionSlot, 1, "both");
+  }
+  BOOST_CHECK(Huge::alive == 0);
+  BOOST_CHECK(Session::alive == 0);
+}
+
+BOOST_AUTO_TEST_CASE(testOwnership)
+{
+  std::shared_ptr<int> p(new int(1));
+  {
+    ConnectionContexts contexts;
+    contexts.emplace(kSharedSlot, p);
+    BOOST_CHECK(p.use_count() == 2);
+    BOOST_CHECK(*contexts.get(kSharedSlot) == p);
+  }
+  BOOST_CHECK(p.use_count() == 1);
+}
@@ -0,0 +1,106 @@
+// Connect/close storm against a TcpServer, measures connection setup and
+// teardown rate of the server.
+//
+// Usage: connectionstorm_bench [server_threads] [client_threads] [seconds]
+
+#include "muduo/base/Atomic.h"
+#include "muduo/base/Logging.h"
+#include "muduo/base/Thread.h"
+#include "muduo/net/EventLoop.h"
+#include "muduo/net/EventLoopThread.h"
+#include "muduo/net/TcpServer.h"
+
+#include <atomic>
+#include <vector>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+using namespace muduo;
+using namespace muduo::net;
+
+const uint16_t kPort = 2034;
+
+AtomicInt64 g_up;
+AtomicInt64 g_down;
+AtomicInt64 g_connects;
+std::atomic<bool> g_stop(false);
+
+// the resets show up as ERROR, which can't be filtered by log level
+void discardOutput(const char*, int)
+{
+}
+
+void onConnection(const TcpConnectionPtr& conn)
+{
+  if (conn->connected())
+    g_up.increment();
+  else
+    g_down.increment();
+}
+
+void connectStorm()
+{
+  InetAddress serverAddr("127.0.0.1", kPort);
+  while (!g_stop)
+  {
+    int sockfd = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (::connect(sockfd, serverAddr.getSockAddr(),
+                  static_cast<socklen_t>(sizeof(struct sockaddr_in))) == 0)
+    {
+      g_connects.increment();
+    }
+    // RST instead of FIN, so client ports never run out in TIME_WAIT
+    struct linger lg = { 1, 0 };
+    ::setsockopt(sockfd, SOL_SOCKET, SO_LINGER, &lg, static_cast<socklen_t>(sizeof lg));
+    ::close(sockfd);
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  int serverThreads = argc > 1 ? atoi(argv[1]) : 0;
+  int clientThreads = argc > 2 ? atoi(argv[2]) : 4;
+  int seconds = argc > 3 ? atoi(argv[3]) : 5;
+  Logger::setOutput(discardOutput);
+
+  EventLoopThread serverThread;
+  EventLoop* loop = serverThread.startLoop();
+  std::unique_ptr<TcpServer> server;
+  loop->runInLoop([&]
+  {
+    server.reset(new TcpServer(loop, InetAddress("127.0.0.1", kPort), "Storm"));
+    server->setConnectionCallback(onConnection);
+    server->setThreadNum(serverThreads);
+    server->start();
+  });
+  sleep(1);
+
+  std::vector<std::unique_ptr<Thread>> clients;
+  Timestamp start(Timestamp::now());
+  for (int i = 0; i < clientThreads; ++i)
+  {
+    clients.emplace_back(new Thread(connectStorm));
+    clients.back()->start();
+  }
+  sleep(seconds);
+  g_stop = true;
+  for (const auto& thr : clients)
+  {
+    thr->join();
+  }
+  double elapsed = timeDifference(Timestamp::now(), start);
+  sleep(1);  // let the server drain
+
+  printf("server threads %d, client threads %d, %.2f seconds\n",
+         serverThreads, clientThreads, elapsed);
+  printf("connects %" PRId64 ", server up %" PRId64 ", down %" PRId64 "\n",
+         g_connects.get(), g_up.get(), g_down.get());
+  printf("%.0f connections/s\n", static_cast<double>(g_down.get()) / elapsed);
+
+  loop->runInLoop([&] { server.reset(); });
+  sleep(1);
+}
@@ -0,0 +1,81 @@
+#include "muduo/net/TcpServer.h"
+
+#include "muduo/base/Logging.h"
+#include "muduo/net/EventLoop.h"
+#include "muduo/net/TcpClient.h"
+
+//#define BOOST_TEST_MODULE IdleTimeoutTest
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+using namespace muduo;
+using namespace muduo::net;
+
+const double kIdleSeconds = 0.5;
+
+Timestamp g_start;
+Timestamp g_silentClosed;
+Timestamp g_chattyClosed;
+bool g_chatting = true;
+
+void onClientConnection(Timestamp* closed, const TcpConnectionPtr& conn)
+{
+  if (conn->connected())
+  {
+    g_start = Timestamp::now();
+  }
+  else
+  {
+    *closed = Timestamp::now();
+    LOG_INFO << conn->name() << " closed after "
+             << timeDifference(*closed, g_start) << "s";
+  }
+}
+
+void chat(TcpClient* client)
+{
+  TcpConnectionPtr conn = client->connection();
+  if (g_chatting && conn)
+  {
+    conn->send("hello\n");
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testIdleTimeout)
+{
+  EventLoop loop;
+  InetAddress listenAddr("127.0.0.1", 2035);
+  TcpServer server(&loop, listenAddr, "IdleServer");
+  server.setThreadNum(2);
+  server.setIdleTimeout(kIdleSeconds);
+  server.setMessageCallback([](const TcpConnectionPtr&, Buffer* buf, Timestamp)
+                            { buf->retrieveAll(); });
+  server.start();
+
+  TcpClient silent(&loop, listenAddr, "Silent");
+  silent.setConnectionCallback(
+      std::bind(onClientConnection, &g_silentClosed, _1));
+  TcpClient chatty(&loop, listenAddr, "Chatty");
+  chatty.setConnectionCallback(
+      std::bind(onClientConnection, &g_chattyClosed, _1));
+  silent.connect();
+  chatty.connect();
+
+  loop.runEvery(kIdleSeconds * 0.4, std::bind(chat, &chatty));
+  loop.runAfter(2.0, [&]
+  {
+    // the chatty one survives as long as it talks
+    BOOST_CHECK(g_silentClosed.valid());
+    BOOST_CHECK(!g_chattyClosed.valid());
+    g_chatting = false;
+  });
+  loop.runAfter(3.0, [&] { loop.quit(); });
+  loop.loop();
+
+  double silentIdle = timeDifference(g_silentClosed, g_start);
+  BOOST_CHECK(silentIdle >= kIdleSeconds * 0.9);
+  // a wheel tick late at most, plus scheduling slack
+  BOOST_CHECK(silentIdle < kIdleSeconds * 1.5);
+  BOOST_CHECK(g_chattyClosed.valid());
+}
@@ -0,0 +1,227 @@
+#include "muduo/net/Resolver.h"
+
+#include "muduo/base/Logging.h"
+#include "muduo/net/Channel.h"
+#include "muduo/net/EventLoop.h"
+#include "muduo/net/SocketsOps.h"
+#include "muduo/net/TcpClient.h"
+#include "muduo/net/TcpServer.h"
+
+#include <map>
+
+#include <arpa/inet.h>
+#include <stdio.h>
+#include <sys/socket.h>
+
+//#define BOOST_TEST_MODULE ResolverTest
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+using namespace muduo;
+using namespace muduo::net;
+
+// A stub nameserver on loopback, it knows a few names under "test."
+class StubNameserver : noncopyable
+{
+ public:
+  explicit StubNameserver(EventLoop* loop)
+    : sockfd_(::socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0)),
+      channel_(loop, sockfd_)
+  {
+    InetAddress any(0, true);
+    sockets::bindOrDie(sockfd_, any.getSockAddr());
+    addr_ = InetAddress(sockets::getLocalAddr(sockfd_));
+    channel_.setReadCallback(std::bind(&StubNameserver::onRead, this));
+    channel_.enableReading();
+  }
+
+  ~StubNameserver()
+  {
+    channel_.disableAll();
+    channel_.remove();
+    sockets::close(sockfd_);
+  }
+
+  const InetAddress& address() const { return addr_; }
+  int queries(const string& name) { return queries_[name]; }
+
+ private:
+  void onRead()
+  {
+    char buf[512];
+    struct sockaddr_in6 peer;
+    socklen_t peerlen = static_cast<socklen_t>(sizeof peer);
+    ssize_t n = ::recvfrom(sockfd_, buf, sizeof buf, 0,
+                           sockets::sockaddr_cast(&peer), &peerlen);
+    if (n < 12)
+      return;
+
+    // question starts at offset 12, labels until a zero byte
+    string name;
+    size_t off = 12;
+    while (off < static_cast<size_t>(n) && buf[off] != 0)
+    {
+      size_t len = static_cast<unsigned char>(buf[off]);
+      if (!name.empty())
+        name += '.';
+      name.append(buf + off + 1, len);
+      off += len + 1;
+    }
+    size_t questionEnd = off + 1 + 4;
+    ++queries_[name];
+
+    if (name == "drop.test")
+      return;
+
+    string response(buf, questionEnd);
+    response[2] = static_cast<char>(0x81);
+    if (name == "a.test" || name == "local.test" || name == "spoof.test")
+    {
+      response[3] = static_cast<char>(0x80);
+      response[7] = 1;  // ANCOUNT
+      if (name == "spoof.test")
+      {
+        // the right id, but another name, then another type
+        string otherName(response);
+        otherName[13] = 'x';
+        send(otherName, "\x06\x06\x06\x06", 60, peer, peerlen);
+        string otherType(response);
+        otherType[questionEnd - 3] = 28;  // AAAA
+        send(otherType, "\x06\x06\x06\x06", 60, peer, peerlen);
+      }
+      const char ttl = static_cast<char>(name == "a.test" ? 1 : 60);
+      send(response, name == "a.test" ? "\x0a\x01\x02\x03" :
+                     name == "local.test" ? "\x7f\x00\x00\x01" : "\x0a\x04\x05\x06",
+           ttl, peer, peerlen);
+    }
+    else
+    {
+      response[3] = static_cast<char>(0x83);  // NXDOMAIN
+      send(response, NULL, 0, peer, peerlen);
+    }
+  }
+
+  // with an A record of ip if not NULL
+  void send(string response, const char* ip, char ttl,
+            const struct sockaddr_in6& peer, socklen_t peerlen)
+  {
+    if (ip)
+    {
+      const char answer[] = { '\xC0', 12, 0, 1, 0, 1, 0, 0, 0, ttl, 0, 4 };
+      response.append(answer, sizeof answer);
+      response.append(ip, 4);
+    }
+    ::sendto(sockfd_, response.data(), response.size(), 0,
+             sockets::sockaddr_cast(&peer), peerlen);
+  }
+
+  const int sockfd_;
+  Channel channel_;
+  InetAddress addr_;
+  std::map<string, int> queries_;
+};
+
+string g_log;
+
+void output(const char* msg, int len)
+{
+  g_log.append(msg, len);
+  ::fwrite(msg, 1, len, stdout);
+}
+
+EventLoop* g_loop;
+StubNameserver* g_stub;
+Resolver* g_resolver;
+int g_answers = 0;
+bool g_connected = false;
+
+void expectFound(const string& ip, bool found, const InetAddress& addr)
+{
+  ++g_answers;
+  BOOST_CHECK(found);
+  BOOST_CHECK(addr.toIp() == ip);
+}
+
+void expectNotFound(bool found, const InetAddress&)
+{
+  ++g_answers;
+  BOOST_CHECK(!found);
+}
+
+void afterTtl()
+{
+  int answers = g_answers;
+  g_resolver->resolve("a.test", std::bind(expectFound, "10.1.2.3", _1, _2));
+  BOOST_CHECK(g_answers == answers);  // cache expired, query sent
+}
+
+void onConnection(const TcpConnectionPtr& conn)
+{
+  if (conn->connected())
+  {
+    g_connected = true;
+    conn->shutdown();
+  }
+}
+
+void finish()
+{
+  BOOST_CHECK(g_answers == 10);
+  BOOST_CHECK(g_stub->queries("a.test") == 2);
+  BOOST_CHECK(g_stub->queries("nx.test") == 1);
+  BOOST_CHECK(g_stub->queries("drop.test") == 2);
+  BOOST_CHECK(g_stub->queries("local.test") == 1);
+  BOOST_CHECK(g_stub->queries("spoof.test") == 1);
+  BOOST_CHECK(g_connected);
+  // names the host it can't resolve
+  BOOST_CHECK(g_log.find("Retry connecting to gone.test:2033 in") != string::npos);
+  g_loop->quit();
+}
+
+BOOST_AUTO_TEST_CASE(testResolve)
+{
+  EventLoop loop;
+  g_loop = &loop;
+  StubNameserver stub(&loop);
+  g_stub = &stub;
+  Resolver resolver(&loop, stub.address());
+  g_resolver = &resolver;
+  resolver.setTimeout(0.1, 2);
+
+  // numeric address never goes to the nameserver
+  resolver.resolve("127.0.0.1", std::bind(expectFound, "127.0.0.1", _1, _2));
+  BOOST_CHECK(g_answers == 1);
+
+  // concurrent queries are merged
+  resolver.resolve("a.test", std::bind(expectFound, "10.1.2.3", _1, _2));
+  resolver.resolve("a.test", std::bind(expectFound, "10.1.2.3", _1, _2));
+  resolver.resolve("nx.test", expectNotFound);
+  resolver.resolve("drop.test", expectNotFound);
+  // answers to other questions are ignored
+  resolver.resolve("spoof.test", std::bind(expectFound, "10.4.5.6", _1, _2));
+
+  loop.runAfter(0.5, [&resolver]
+  {
+    // answered from cache, including negative answer
+    int answers = g_answers;
+    resolver.resolve("a.test", std::bind(expectFound, "10.1.2.3", _1, _2));
+    resolver.resolve("nx.test", expectNotFound);
+    resolver.resolve("spoof.test", std::bind(expectFound, "10.4.5.6", _1, _2));
+    BOOST_CHECK(g_answers == answers + 3);
+  });
+  loop.runAfter(1.5, afterTtl);
+
+  // connects by name, local.test is 127.0.0.1
+  TcpServer server(&loop, InetAddress("127.0.0.1", 2033), "Server");
+  server.start();
+  TcpClient client(&loop, &resolver, "local.test", 2033, "Client");
+  client.setConnectionCallback(onConnection);
+  client.connect();
+  Logger::setOutput(output);
+  TcpClient gone(&loop, &resolver, "gone.test", 2033, "Gone");
+  gone.connect();
+
+  loop.runAfter(2.0, finish);
+  loop.loop();
+}
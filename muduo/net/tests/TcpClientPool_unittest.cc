@@ -0,0 +1,203 @@
+#include "muduo/net/TcpClientPool.h"
+
+#include "muduo/base/Logging.h"
+#include "muduo/net/EventLoop.h"
+#include "muduo/net/TcpServer.h"
+
+#include <map>
+#include <set>
+#include <vector>
+
+//#define BOOST_TEST_MODULE TcpClientPoolTest
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+using namespace muduo;
+using namespace muduo::net;
+
+const InetAddress kAddr1("127.0.0.1", 2031);
+const InetAddress kAddr2("127.0.0.1", 2032);
+const InetAddress kSilentAddr("127.0.0.1", 2046);
+
+EventLoop* g_loop;
+TcpClientPool* g_pool;
+AtomicInt32 g_pings;
+AtomicInt32 g_closed;
+
+void onServerMessage(const TcpConnectionPtr& conn, Buffer* buf, Timestamp)
+{
+  string msg(buf->retrieveAllAsString());
+  if (msg == "ping\n")
+  {
+    g_pings.increment();
+  }
+  conn->send(msg);
+}
+
+void checkBalancing()
+{
+  std::set<TcpConnection*> conns;
+  std::set<string> peers;
+  std::vector<TcpConnectionPtr> acquired;
+  for (int i = 0; i < 4; ++i)
+  {
+    TcpConnectionPtr conn = g_pool->acquire();
+    BOOST_CHECK(conn);
+    if (conn)
+    {
+      conns.insert(get_pointer(conn));
+      peers.insert(conn->peerAddress().toIpPort());
+      acquired.push_back(conn);
+    }
+  }
+  // least-outstanding hands out every idle connection before reusing one
+  BOOST_CHECK(conns.size() == 4);
+  BOOST_CHECK(peers.size() == 2);
+
+  TcpConnectionPtr fifth = g_pool->acquire();
+  BOOST_CHECK(fifth);
+  acquired.push_back(fifth);
+  for (const auto& conn : acquired)
+  {
+    g_pool->release(conn);
+  }
+}
+
+void checkRoundRobin()
+{
+  std::map<TcpConnection*, int> uses;
+  string lastPeer;
+  for (int i = 0; i < 8; ++i)
+  {
+    TcpConnectionPtr conn = g_pool->acquire();
+    BOOST_CHECK(conn);
+    if (conn)
+    {
+      // backends take turns, and so do the connections of each
+      string peer = conn->peerAddress().toIpPort();
+      BOOST_CHECK(peer != lastPeer);
+      lastPeer = peer;
+      ++uses[get_pointer(conn)];
+      g_pool->release(conn);
+    }
+  }
+  BOOST_CHECK(uses.size() == 4);
+  for (const auto& use : uses)
+  {
+    BOOST_CHECK(use.second == 2);
+  }
+}
+
+std::function<void ()> g_whenAllConnected;
+
+void onClientConnection(const TcpConnectionPtr& conn)
+{
+  if (conn->connected() && g_pool->numConnected() == 4 && g_whenAllConnected)
+  {
+    g_loop->runInLoop(g_whenAllConnected);
+    g_whenAllConnected = std::function<void ()>();
+  }
+  else if (!conn->connected())
+  {
+    g_closed.increment();
+  }
+}
+
+void sendPing(const TcpConnectionPtr& conn)
+{
+  conn->send("ping\n");
+}
+
+// two echo servers and one that never answers, for all test cases
+struct Backends
+{
+  Backends()
+    : server1(&loop, kAddr1, "Server1"),
+      server2(&loop, kAddr2, "Server2"),
+      silent(&loop, kSilentAddr, "Silent")
+  {
+    g_loop = &loop;
+    server1.setMessageCallback(onServerMessage);
+    server2.setMessageCallback(onServerMessage);
+    silent.setMessageCallback([](const TcpConnectionPtr&, Buffer* buf, Timestamp)
+    {
+      buf->retrieveAll();
+    });
+    server1.start();
+    server2.start();
+    silent.start();
+  }
+
+  EventLoop loop;
+  TcpServer server1;
+  TcpServer server2;
+  TcpServer silent;
+};
+
+BOOST_GLOBAL_FIXTURE(Backends);
+
+BOOST_AUTO_TEST_CASE(testNotStarted)
+{
+  // nothing to tear down
+  TcpClientPool pool(g_loop, "Idle");
+  pool.addBackend(kAddr1);
+  pool.setThreadNum(2);
+}
+
+BOOST_AUTO_TEST_CASE(testLeastOutstanding)
+{
+  TcpClientPool pool(g_loop, "Pool");
+  g_pool = &pool;
+  g_whenAllConnected = checkBalancing;
+  pool.addBackend(kAddr1);
+  pool.addBackend(kAddr2);
+  pool.setConnectionsPerBackend(2);
+  pool.setThreadNum(2);
+  pool.setBalancing(TcpClientPool::kLeastOutstanding);
+  pool.setHealthCheck(sendPing, 0.2, 1.0);
+  pool.setConnectionCallback(onClientConnection);
+  pool.start();
+
+  g_loop->runAfter(1.5, std::bind(&EventLoop::quit, g_loop));
+  g_loop->loop();
+
+  BOOST_CHECK(pool.numConnected() == 4);
+  // every idle connection should have been probed at least once
+  BOOST_CHECK(g_pings.get() >= 4);
+}
+
+BOOST_AUTO_TEST_CASE(testRoundRobin)
+{
+  TcpClientPool pool(g_loop, "RoundRobin");
+  g_pool = &pool;
+  g_whenAllConnected = checkRoundRobin;
+  pool.addBackend(kAddr1);
+  pool.addBackend(kAddr2);
+  pool.setConnectionsPerBackend(2);
+  pool.setThreadNum(2);
+  pool.setBalancing(TcpClientPool::kRoundRobin);
+  pool.setConnectionCallback(onClientConnection);
+  pool.start();
+
+  g_loop->runAfter(0.5, std::bind(&EventLoop::quit, g_loop));
+  g_loop->loop();
+  BOOST_CHECK(!g_whenAllConnected);
+}
+
+BOOST_AUTO_TEST_CASE(testHealthCheckCloses)
+{
+  TcpClientPool pool(g_loop, "Silent");
+  g_pool = &pool;
+  g_closed.getAndSet(0);
+  pool.addBackend(kSilentAddr);
+  // in the base loop
+  pool.setHealthCheck(sendPing, 0.1, 0.2);
+  pool.setConnectionCallback(onClientConnection);
+  pool.start();
+
+  g_loop->runAfter(1.0, std::bind(&EventLoop::quit, g_loop));
+  g_loop->loop();
+  // closed for not answering the probe, then reconnected by retry
+  BOOST_CHECK(g_closed.get() >= 1);
+}
@@ -89,3 +89,63 @@ BOOST_AUTO_TEST_CASE(testZlibOutputStream5)
   printf("total %zd\n", output.readableBytes());
   BOOST_CHECK_EQUAL(stream.zlibErrorCode(), Z_STREAM_END);
 }
+
+BOOST_AUTO_TEST_CASE(testZlibOutputStreamGzip)
+{
+  muduo::net::Buffer output;
+  muduo::string input;
+  for (int i = 0; i < 1000; ++i)
+  {
+    input += "{\"id\": 12345, \"name\": \"muduo\"},";
+  }
+  {
+    muduo::net::ZlibOutputStream stream(&output, Z_BEST_SPEED, true);
+    BOOST_CHECK(stream.write(input));
+    BOOST_CHECK(stream.finish());
+  }
+  // the gzip magic
+  BOOST_CHECK_EQUAL(output.peekInt8() & 0xff, 0x1f);
+  BOOST_CHECK_LT(output.readableBytes(), input.size() / 10);
+
+  z_stream zstream;
+  muduo::memZero(&zstream, sizeof zstream);
+  BOOST_CHECK_EQUAL(inflateInit2(&zstream, MAX_WBITS + 16), Z_OK);
+  muduo::string inflated(input.size() + 1, '\0');
+  zstream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(output.peek()));
+  zstream.avail_in = static_cast<uInt>(output.readableBytes());
+  zstream.next_out = reinterpret_cast<Bytef*>(&inflated[0]);
+  zstream.avail_out = static_cast<uInt>(inflated.size());
+  BOOST_CHECK_EQUAL(inflate(&zstream, Z_FINISH), Z_STREAM_END);
+  inflated.resize(zstream.total_out);
+  inflateEnd(&zstream);
+  BOOST_CHECK(inflated == input);
+}
+
+BOOST_AUTO_TEST_CASE(testZlibOutputStreamReset)
+{
+  muduo::net::Buffer output;
+  muduo::net::ZlibOutputStream stream(&output, Z_DEFAULT_COMPRESSION, true);
+  muduo::string input(4096, 'x');
+  for (int level = 1; level <= 9; ++level)
+  {
+    BOOST_CHECK(stream.setLevel(level));
+    BOOST_CHECK(stream.write(input));
+    BOOST_CHECK(stream.finishAndReset());
+
+    muduo::string inflated(input.size(), '\0');
+    uLongf inflatedSize = static_cast<uLongf>(inflated.size());
+    z_stream zstream;
+    muduo::memZero(&zstream, sizeof zstream);
+    inflateInit2(&zstream, MAX_WBITS + 16);
+    zstream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(output.peek()));
+    zstream.avail_in = static_cast<uInt>(output.readableBytes());
+    zstream.next_out = reinterpret_cast<Bytef*>(&inflated[0]);
+    zstream.avail_out = static_cast<uInt>(inflatedSize);
+    BOOST_CHECK_EQUAL(inflate(&zstream, Z_FINISH), Z_STREAM_END);
+    // one gzip member each time
+    BOOST_CHECK_EQUAL(zstream.avail_in, 0u);
+    inflateEnd(&zstream);
+    BOOST_CHECK(inflated == input);
+    output.retrieveAll();
+  }
+}